@@ -10,6 +10,7 @@
 #include <fwk_arch.h>
 #include <fwk_assert.h>
 #include <fwk_macros.h>
+#include <fwk_status.h>
 
 #include <arch_nvic.h>
 
@@ -35,8 +36,41 @@ void _exit(int status)
 }
 #endif
 
+#ifdef BUILD_HAS_MM_ARENA
+/*
+ * The memory region of the arena allocator is reserved by the linker script
+ * when the firmware defines FMW_MM_ARENA_SIZE.
+ */
+#    ifdef __ARMCC_VERSION
+extern char Image$$ER_ARENA$$ZI$$Base;
+extern char Image$$ER_ARENA$$ZI$$Limit;
+
+#        define ARCH_MM_ARENA_START (&Image$$ER_ARENA$$ZI$$Base)
+#        define ARCH_MM_ARENA_END (&Image$$ER_ARENA$$ZI$$Limit)
+#    else
+extern char __arena_start__;
+extern char __arena_end__;
+
+#        define ARCH_MM_ARENA_START (&__arena_start__)
+#        define ARCH_MM_ARENA_END (&__arena_end__)
+#    endif
+
+static int arch_mm_init(struct fwk_arch_mm_data *data)
+{
+    *data = (struct fwk_arch_mm_data){
+        .start = (uintptr_t)ARCH_MM_ARENA_START,
+        .size = (size_t)(ARCH_MM_ARENA_END - ARCH_MM_ARENA_START),
+    };
+
+    return FWK_SUCCESS;
+}
+#endif
+
 static const struct fwk_arch_init_driver arch_init_driver = {
     .interrupt = arch_nvic_init,
+#ifdef BUILD_HAS_MM_ARENA
+    .mm = arch_mm_init,
+#endif
 };
 
 #ifndef ARMV6M
@@ -11,9 +11,30 @@
 
 #include <arch_interrupt.h>
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+#ifdef BUILD_HAS_MM_ARENA
+/* Size of the memory region of the arena allocator */
+#    ifndef FMW_MM_ARENA_SIZE
+#        define FMW_MM_ARENA_SIZE (1024 * 1024)
+#    endif
+
+static _Alignas(max_align_t) uint8_t arch_mm_arena[FMW_MM_ARENA_SIZE];
+
+static int arch_mm_init(struct fwk_arch_mm_data *data)
+{
+    *data = (struct fwk_arch_mm_data){
+        .start = (uintptr_t)arch_mm_arena,
+        .size = sizeof(arch_mm_arena),
+    };
+
+    return FWK_SUCCESS;
+}
+#endif
+
 /*
  * Catches early failures in the initialization.
  */
@@ -25,6 +46,9 @@ static noreturn void panic(void)
 
 static const struct fwk_arch_init_driver arch_init_driver = {
     .interrupt = arch_interrupt_init,
+#ifdef BUILD_HAS_MM_ARENA
+    .mm = arch_mm_init,
+#endif
 };
 
 int main(void)
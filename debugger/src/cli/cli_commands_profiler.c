@@ -0,0 +1,197 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifdef BUILD_HAS_EVENT_PROFILER
+
+#    include <cli.h>
+
+#    include <fwk_id.h>
+#    include <fwk_module_idx.h>
+#    include <fwk_profiler.h>
+#    include <fwk_status.h>
+
+#    include <stdint.h>
+#    include <stdlib.h>
+
+const char profiler_call[] = "profiler";
+const char profiler_help[] =
+    "  Show the dispatch latency of the events, in ns, per module.\n"
+    "    Usage: profiler\n"
+    "  Show the dispatch latency of the events and notifications of a module\n"
+    "  and its latency histogram.\n"
+    "    Usage: profiler <module idx>\n"
+    "  Show the latency between interrupt handlers and event dispatch.\n"
+    "    Usage: profiler isr\n"
+    "  Show the depth of the event queues.\n"
+    "    Usage: profiler queue\n"
+    "  Reset all the statistics.\n"
+    "    Usage: profiler reset";
+
+/* The CLI formatted print does not support 64-bit decimal values */
+static uint32_t to_u32(fwk_duration_ns_t duration)
+{
+    return (duration > UINT32_MAX) ? UINT32_MAX : (uint32_t)duration;
+}
+
+static void print_latency(
+    const char *name,
+    const struct fwk_profiler_latency *latency)
+{
+    cli_printf(
+        NONE,
+        "%s: count %u min %u avg %u max %u\n",
+        name,
+        latency->count,
+        to_u32(latency->min),
+        to_u32(latency->total / latency->count),
+        to_u32(latency->max));
+}
+
+static void print_histogram(const struct fwk_profiler_latency *latency)
+{
+    unsigned int bucket;
+
+    cli_printf(NONE, "  < 1us: %u\n", latency->histogram[0]);
+    for (bucket = 1; bucket < FMW_EVENT_PROFILER_BUCKET_COUNT; bucket++) {
+        cli_printf(
+            NONE,
+            "  >= %uus: %u\n",
+            1U << (bucket - 1),
+            latency->histogram[bucket]);
+    }
+}
+
+static void print_modules(void)
+{
+    struct fwk_profiler_latency latency;
+    unsigned int module_idx;
+    fwk_id_t id;
+
+    for (module_idx = 0; module_idx < (unsigned int)FWK_MODULE_IDX_COUNT;
+         module_idx++) {
+        id = FWK_ID_MODULE(module_idx);
+
+        if ((fwk_profiler_get_dispatch_latency(id, &latency) == FWK_SUCCESS) &&
+            (latency.count > 0)) {
+            cli_printf(NONE, "%u ", module_idx);
+            print_latency(FWK_ID_STR(id), &latency);
+        }
+    }
+}
+
+/* Print the statistics of the events or notifications of a module */
+static void print_ids(unsigned int module_idx, enum fwk_id_type type)
+{
+    struct fwk_profiler_latency latency;
+    unsigned int idx;
+    fwk_id_t id;
+
+    /* The statistics are only available for the identifiers that exist */
+    for (idx = 0;; idx++) {
+        if (type == FWK_ID_TYPE_EVENT) {
+            id = FWK_ID_EVENT(module_idx, idx);
+        } else {
+            id = FWK_ID_NOTIFICATION(module_idx, idx);
+        }
+
+        if (fwk_profiler_get_dispatch_latency(id, &latency) != FWK_SUCCESS) {
+            return;
+        }
+
+        if (latency.count > 0) {
+            print_latency(FWK_ID_STR(id), &latency);
+        }
+    }
+}
+
+static int32_t print_module(unsigned int module_idx)
+{
+    struct fwk_profiler_latency latency;
+    fwk_id_t id;
+
+    if (module_idx >= (unsigned int)FWK_MODULE_IDX_COUNT) {
+        cli_print("Module index out of range.\n");
+        return FWK_E_PARAM;
+    }
+
+    id = FWK_ID_MODULE(module_idx);
+    if (fwk_profiler_get_dispatch_latency(id, &latency) != FWK_SUCCESS) {
+        return FWK_E_STATE;
+    }
+
+    if (latency.count == 0) {
+        cli_print("No event processed.\n");
+        return FWK_SUCCESS;
+    }
+
+    print_latency(FWK_ID_STR(id), &latency);
+    print_histogram(&latency);
+
+    print_ids(module_idx, FWK_ID_TYPE_EVENT);
+    print_ids(module_idx, FWK_ID_TYPE_NOTIFICATION);
+
+    return FWK_SUCCESS;
+}
+
+int32_t profiler_f(int32_t argc, char **argv)
+{
+    struct fwk_profiler_latency latency;
+    struct fwk_profiler_queue_stats stats;
+
+    if (argc == 1) {
+        print_modules();
+        return FWK_SUCCESS;
+    }
+
+    else if ((argc == 2) && (cli_strncmp(argv[1], "isr", 3) == 0)) {
+        if (fwk_profiler_get_isr_latency(&latency) != FWK_SUCCESS) {
+            return FWK_E_STATE;
+        }
+
+        if (latency.count == 0) {
+            cli_print("No ISR event processed.\n");
+            return FWK_SUCCESS;
+        }
+
+        print_latency("isr", &latency);
+        print_histogram(&latency);
+        return FWK_SUCCESS;
+    }
+
+    else if ((argc == 2) && (cli_strncmp(argv[1], "queue", 5) == 0)) {
+        if (fwk_profiler_get_queue_stats(&stats) != FWK_SUCCESS) {
+            return FWK_E_STATE;
+        }
+
+        cli_printf(
+            NONE,
+            "event queue: depth %u peak %u\n",
+            stats.event_queue_depth,
+            stats.event_queue_peak);
+        cli_printf(
+            NONE,
+            "isr event queue: depth %u peak %u\n",
+            stats.isr_event_queue_depth,
+            stats.isr_event_queue_peak);
+        return FWK_SUCCESS;
+    }
+
+    else if ((argc == 2) && (cli_strncmp(argv[1], "reset", 5) == 0)) {
+        fwk_profiler_reset();
+        return FWK_SUCCESS;
+    }
+
+    else if (argc == 2) {
+        return print_module((unsigned int)strtoul(argv[1], NULL, 0));
+    }
+
+    cli_print("CLI: Invalid command received.\n");
+
+    return FWK_E_PARAM;
+}
+
+#endif
@@ -188,6 +188,17 @@ struct fwk_arch_interrupt_driver {
     bool (*is_interrupt_context)(void);
 };
 
+/*!
+ * \brief Memory region of the arena allocator.
+ */
+struct fwk_arch_mm_data {
+    /*! Start address of the region */
+    uintptr_t start;
+
+    /*! Size of the region in bytes */
+    size_t size;
+};
+
 /*!
  * \brief Initialization driver interface.
  *
@@ -208,6 +219,22 @@ struct fwk_arch_init_driver {
      * \retval ::FWK_E_PANIC Unrecoverable initialization error.
      */
     int (*interrupt)(const struct fwk_arch_interrupt_driver **driver);
+
+    /*!
+     * \brief Memory region initialization.
+     *
+     * \details This handler is used by the framework library to request the
+     *      memory region the arena allocator allocates from. It is only
+     *      required when the framework is built with the arena allocator
+     *      (`BUILD_HAS_MM_ARENA`).
+     *
+     * \param [out] data Description of the memory region.
+     *
+     * \retval ::FWK_SUCCESS Operation succeeded.
+     * \retval ::FWK_E_PARAM The parameter received by the handler is invalid.
+     * \retval ::FWK_E_PANIC Unrecoverable initialization error.
+     */
+    int (*mm)(struct fwk_arch_mm_data *data);
 };
 
 /*!
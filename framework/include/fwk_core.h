@@ -30,6 +30,37 @@
  * \{
  */
 
+/*!
+ * \def FMW_ISR_EVENT_BATCH_MAX
+ *
+ * \brief Maximum number of events moved at once from the ISR event queue to
+ *      the event queue.
+ *
+ * \details Events raised by interrupt handlers are moved to the event queue in
+ *      batches, each under a single critical section. When zero, the whole ISR
+ *      event queue is moved at once in constant time. Otherwise, at most this
+ *      number of events are moved before the events already queued are
+ *      processed, bounding the time interrupts are masked and letting the
+ *      events raised by the thread run between batches.
+ */
+#ifndef FMW_ISR_EVENT_BATCH_MAX
+#    define FMW_ISR_EVENT_BATCH_MAX 0
+#endif
+
+/*!
+ * \def FMW_LIGHT_EVENT_COUNT
+ *
+ * \brief Number of events of the light event pool.
+ *
+ * \details Light events are queued in a compact form taken from a dedicated
+ *      pool, without the parameters of standard events. When this pool is
+ *      exhausted, light events are taken from the event pool instead, subject
+ *      to the event quotas of the modules.
+ */
+#ifndef FMW_LIGHT_EVENT_COUNT
+#    define FMW_LIGHT_EVENT_COUNT 16
+#endif
+
 /*!
  * \brief Put an event in one of the event queues.
  *
@@ -58,6 +89,10 @@
  * \retval ::FWK_E_PARAM An invalid parameter was encountered:
  *      - The `event` parameter was a null pointer value.
  *      - One or more fields of the event were invalid.
+ * \retval ::FWK_E_BUSY The event quota of the source module and the shared
+ *      events of the event pool are exhausted. The event was not queued and
+ *      may be sent again later.
+ * \retval ::FWK_E_NOMEM The event pool is exhausted.
  * \retval ::FWK_E_OS Operating system error.
  *
  * \return Status code representing the result of the operation.
@@ -72,6 +107,41 @@
  */
 void fwk_process_event_queue(void);
 
+/*!
+ * \brief Event pool occupancy statistics.
+ */
+struct fwk_event_pool_stats {
+    /*! Number of events of the pool, or of the quota of the module */
+    unsigned int event_count;
+
+    /*! Number of events currently allocated */
+    unsigned int used_count;
+
+    /*! Highest number of events allocated at the same time */
+    unsigned int peak_count;
+
+    /*! Number of event allocations refused with ::FWK_E_BUSY */
+    unsigned int busy_count;
+};
+
+/*!
+ * \brief Get the occupancy statistics of the event pool.
+ *
+ * \details When \p id is ::FWK_ID_NONE, the statistics cover the whole event
+ *      pool. When \p id is a module identifier, they cover the events allocated
+ *      on behalf of the module, and the event count is the quota of the module.
+ *
+ * \param[in] id ::FWK_ID_NONE or identifier of a module.
+ * \param[out] stats The occupancy statistics.
+ *
+ * \retval ::FWK_SUCCESS The statistics were returned.
+ * \retval ::FWK_E_INIT The core framework component is not initialized.
+ * \retval ::FWK_E_PARAM One or more parameters were invalid.
+ *
+ * \return Status code representing the result of the operation.
+ */
+int fwk_get_event_pool_stats(fwk_id_t id, struct fwk_event_pool_stats *stats);
+
 /*!
  * \brief Get a copy of a delayed response event.
  *
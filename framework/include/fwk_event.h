@@ -16,6 +16,7 @@
 #include <fwk_align.h>
 #include <fwk_id.h>
 #include <fwk_list.h>
+#include <fwk_time.h>
 
 #include <stdbool.h>
 #include <stddef.h>
@@ -37,6 +38,42 @@
  */
 #define FWK_EVENT_PARAMETERS_SIZE 16
 
+/*!
+ * \def FMW_EVENT_PRIORITY_STARVATION_LIMIT
+ *
+ * \brief Maximum number of times a pending event class may be skipped in favour
+ *      of a higher priority class before one of its events is dispatched.
+ *
+ * \details Only used when the framework is built with event priority
+ *      scheduling (`BUILD_HAS_EVENT_PRIORITY`).
+ */
+#ifndef FMW_EVENT_PRIORITY_STARVATION_LIMIT
+#    define FMW_EVENT_PRIORITY_STARVATION_LIMIT 16
+#endif
+
+/*!
+ * \brief Event priority classes.
+ *
+ * \details When the framework is built with event priority scheduling
+ *      (`BUILD_HAS_EVENT_PRIORITY`), events are queued per class and the
+ *      highest non-empty class is always dispatched first, subject to
+ *      ::FMW_EVENT_PRIORITY_STARVATION_LIMIT. Otherwise all the events share a
+ *      single FIFO queue and the class is ignored.
+ */
+enum fwk_event_priority {
+    /*! Default class, for events without particular latency requirements */
+    FWK_EVENT_PRIORITY_NORMAL,
+
+    /*! Latency-critical events (e.g. performance or power state requests) */
+    FWK_EVENT_PRIORITY_HIGH,
+
+    /*! Background events (e.g. sensor sampling, statistics) */
+    FWK_EVENT_PRIORITY_LOW,
+
+    /*! Number of event priority classes */
+    FWK_EVENT_PRIORITY_COUNT
+};
+
 /*!
  * \brief Event.
  *
@@ -87,6 +124,15 @@ struct fwk_event {
      */
     fwk_id_t id;
 
+#ifdef BUILD_HAS_EVENT_PROFILER
+    /*!
+     * \internal
+     * \brief Time the event was put in the ISR event queue, zero if the event
+     *      was not raised by an interrupt handler.
+     */
+    fwk_timestamp_t isr_timestamp;
+#endif
+
     /*! Table of event parameters */
     alignas(max_align_t) uint8_t params[FWK_EVENT_PARAMETERS_SIZE];
 };
@@ -98,9 +144,11 @@ struct fwk_event {
  *      is needed by the target module and in a use case where creating and
  *      initializing a <tt> struct fwk_event </tt> type object can affect
  *      the performance of the use case(e.g. DVFS).
- *      The framework copies the light event information in a pre-allocated
- *      <tt> struct fwk_event </tt> type object before it starts processing
- *      the event.
+ *      The framework queues light events in a compact form, without
+ *      parameters, taken from a dedicated pool (see ::FMW_LIGHT_EVENT_COUNT),
+ *      and copies the light event information in a pre-allocated
+ *      <tt> struct fwk_event </tt> type object with zeroed parameters when it
+ *      starts processing the event.
  */
 struct fwk_event_light {
     /*! Identifier of the event source */
@@ -428,9 +428,20 @@ bool fwk_id_type_is_valid(fwk_id_t id) FWK_CONST FWK_LEAF FWK_NOTHROW;
  *
  * \retval true The identifier is of the type specified.
  * \retval false The identifier is not of the type specified.
+ *
+ * \note Since this function is used very frequently, inlining is useful
+ *     to avoid function call overhead. The inlining is applicable only in
+ *     release build.
  */
+#if !defined(NDEBUG)
 bool fwk_id_is_type(fwk_id_t id, enum fwk_id_type type) FWK_CONST FWK_LEAF
     FWK_NOTHROW;
+#else
+inline static bool fwk_id_is_type(fwk_id_t id, enum fwk_id_type type)
+{
+    return id.common.type == (uint32_t)type;
+}
+#endif
 
 /*!
  * \brief Retrieve the type of an identifier.
@@ -438,8 +449,19 @@ bool fwk_id_is_type(fwk_id_t id, enum fwk_id_type type) FWK_CONST FWK_LEAF
  * \param id Identifier.
  *
  * \return Identifier type.
+ *
+ * \note Since this function is used very frequently, inlining is useful
+ *     to avoid function call overhead. The inlining is applicable only in
+ *     release build.
  */
+#if !defined(NDEBUG)
 enum fwk_id_type fwk_id_get_type(fwk_id_t id) FWK_CONST FWK_LEAF FWK_NOTHROW;
+#else
+inline static enum fwk_id_type fwk_id_get_type(fwk_id_t id)
+{
+    return (enum fwk_id_type)id.common.type;
+}
+#endif
 
 /*!
  * \brief Check if two identifiers refer to the same entity.
@@ -449,9 +471,20 @@ enum fwk_id_type fwk_id_get_type(fwk_id_t id) FWK_CONST FWK_LEAF FWK_NOTHROW;
  *
  * \retval true The identifiers refer to the same entity.
  * \retval false The identifiers do not refer to the same entity.
+ *
+ * \note Since this function is used very frequently, inlining is useful
+ *     to avoid function call overhead. The inlining is applicable only in
+ *     release build.
  */
+#if !defined(NDEBUG)
 bool fwk_id_is_equal(fwk_id_t left, fwk_id_t right) FWK_CONST FWK_LEAF
     FWK_NOTHROW;
+#else
+inline static bool fwk_id_is_equal(fwk_id_t left, fwk_id_t right)
+{
+    return left.value == right.value;
+}
+#endif
 
 /*!
  * \brief Check if an optional identifier is defined.
@@ -473,8 +506,19 @@ bool fwk_optional_id_is_defined(fwk_optional_id_t id) FWK_CONST FWK_LEAF
  * \param id Identifier.
  *
  * \return Identifier of the owning module.
+ *
+ * \note Since this function is used very frequently, inlining is useful
+ *     to avoid function call overhead. The inlining is applicable only in
+ *     release build.
  */
+#if !defined(NDEBUG)
 fwk_id_t fwk_id_build_module_id(fwk_id_t id) FWK_CONST FWK_LEAF FWK_NOTHROW;
+#else
+inline static fwk_id_t fwk_id_build_module_id(fwk_id_t id)
+{
+    return FWK_ID_MODULE(id.common.module_idx);
+}
+#endif
 
 /*!
  * \brief Retrieve the identifier of an element for a given identifier and
@@ -492,9 +536,22 @@ fwk_id_t fwk_id_build_module_id(fwk_id_t id) FWK_CONST FWK_LEAF FWK_NOTHROW;
  * \param element_idx Element index.
  *
  * \return Element identifier associated with the element index for the module.
+ *
+ * \note Since this function is used very frequently, inlining is useful
+ *     to avoid function call overhead. The inlining is applicable only in
+ *     release build.
  */
+#if !defined(NDEBUG)
 fwk_id_t fwk_id_build_element_id(fwk_id_t id, unsigned int element_idx)
     FWK_CONST FWK_LEAF FWK_NOTHROW;
+#else
+inline static fwk_id_t fwk_id_build_element_id(
+    fwk_id_t id,
+    unsigned int element_idx)
+{
+    return FWK_ID_ELEMENT(id.common.module_idx, element_idx);
+}
+#endif
 
 /*!
  * \brief Retrieve the identifier of a sub-element for a given element
@@ -509,9 +566,23 @@ fwk_id_t fwk_id_build_element_id(fwk_id_t id, unsigned int element_idx)
  *
  * \return Sub-element identifier associated with the sub-element index for the
  *      element.
+ *
+ * \note Since this function is used very frequently, inlining is useful
+ *     to avoid function call overhead. The inlining is applicable only in
+ *     release build.
  */
+#if !defined(NDEBUG)
 fwk_id_t fwk_id_build_sub_element_id(fwk_id_t id, unsigned int sub_element_idx)
     FWK_CONST FWK_LEAF FWK_NOTHROW;
+#else
+inline static fwk_id_t fwk_id_build_sub_element_id(
+    fwk_id_t id,
+    unsigned int sub_element_idx)
+{
+    return FWK_ID_SUB_ELEMENT(
+        id.common.module_idx, id.element.element_idx, sub_element_idx);
+}
+#endif
 
 /*!
  * \brief Retrieve the identifier of an API for a given identifier and
@@ -529,9 +600,20 @@ fwk_id_t fwk_id_build_sub_element_id(fwk_id_t id, unsigned int sub_element_idx)
  * \param api_idx API index.
  *
  * \return API identifier associated with the API index for the module.
+ *
+ * \note Since this function is used very frequently, inlining is useful
+ *     to avoid function call overhead. The inlining is applicable only in
+ *     release build.
  */
+#if !defined(NDEBUG)
 fwk_id_t fwk_id_build_api_id(fwk_id_t id, unsigned int api_idx)
     FWK_CONST FWK_LEAF FWK_NOTHROW;
+#else
+inline static fwk_id_t fwk_id_build_api_id(fwk_id_t id, unsigned int api_idx)
+{
+    return FWK_ID_API(id.common.module_idx, api_idx);
+}
+#endif
 
 /*!
  * \brief Retrieve the module index of an identifier.
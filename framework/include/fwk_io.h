@@ -164,6 +164,36 @@ struct fwk_io_adapter {
      */
     int (*getch)(const struct fwk_io_stream *stream, char *ch);
 
+    /*!
+     * \brief Read characters from the stream.
+     *
+     * \details Fetch up to `size` characters from the stream without waiting
+     *      for more characters to become available. The function may return
+     *      ::FWK_PENDING to indicate that there are no more characters to
+     *      fetch.
+     *
+     *      The `stream`, `buffer` and `read` parameters are guaranteed to be
+     *      non-null, and `size` is guaranteed to be non-zero.
+     *
+     * \note This field may be set to a null pointer value, in which case the
+     *      characters are read one at a time through ::fwk_io_adapter::getch.
+     *
+     * \param[in] stream Stream to read from.
+     * \param[out] buffer Characters read from the stream.
+     * \param[in] size Maximum number of characters to read.
+     * \param[out] read Number of characters read from the stream.
+     *
+     * \return Status code representing the result of the operation.
+     *
+     * \retval ::FWK_SUCCESS At least one character was successfully read.
+     * \retval ::FWK_PENDING There are no more characters to read.
+     */
+    int (*read)(
+        const struct fwk_io_stream *stream,
+        char *buffer,
+        size_t size,
+        size_t *read);
+
     /*!
      * \brief Write a character to the stream.
      *
@@ -182,6 +212,36 @@ struct fwk_io_adapter {
      */
     int (*putch)(const struct fwk_io_stream *stream, char ch);
 
+    /*!
+     * \brief Write characters to the stream.
+     *
+     * \details Write as many of the `size` characters of `buffer` as the
+     *      stream can accept without waiting.
+     *
+     *      The `stream`, `buffer` and `written` parameters are guaranteed to be
+     *      non-null, and `size` is guaranteed to be non-zero.
+     *
+     * \note This field may be set to a null pointer value, in which case the
+     *      characters are written one at a time through
+     *      ::fwk_io_adapter::putch.
+     *
+     * \param[in] stream Stream to write to.
+     * \param[in] buffer Characters to write to the stream.
+     * \param[in] size Number of characters to write.
+     * \param[out] written Number of characters written to the stream.
+     *
+     * \return Status code representing the result of the operation.
+     *
+     * \retval ::FWK_SUCCESS At least one character was successfully written.
+     * \retval ::FWK_E_BUSY The resource is currently unavailable and it cannot
+     *      accept new characters.
+     */
+    int (*write)(
+        const struct fwk_io_stream *stream,
+        const char *buffer,
+        size_t size,
+        size_t *written);
+
     /*!
      * \brief Close the stream.
      *
@@ -339,6 +399,37 @@ int fwk_io_putch(const struct fwk_io_stream *stream, char ch);
  */
 int fwk_io_putch_nowait(const struct fwk_io_stream *stream, char ch);
 
+/*!
+ * \brief Write characters to a stream without waiting.
+ *
+ * \details Writes as many of the `size` characters of `buffer` as the output
+ *      stream `stream` can accept without waiting. If the driver is busy and
+ *      cannot accept any character `FWK_E_BUSY` will be returned.
+ *
+ * \param[in] stream Stream to write to.
+ * \param[out] written Number of characters written.
+ * \param[in] buffer Characters to write.
+ * \param[in] size Number of characters to write.
+ *
+ * \return Status code representing the result of the operation.
+ *
+ * \retval ::FWK_SUCCESS At least one character was successfully written, or
+ *      `size` is zero.
+ * \retval ::FWK_E_BUSY The `stream` resource is currently busy.
+ * \retval ::FWK_E_PARAM An invalid parameter was encountered:
+ *      - The `stream` parameter was a null pointer value.
+ *      - The `written` parameter was a null pointer value.
+ *      - The `buffer` parameter was a null pointer value.
+ * \retval ::FWK_E_STATE The `stream` has already been closed.
+ * \retval ::FWK_E_SUPPORT The `stream` was not opened with write access.
+ * \retval ::FWK_E_HANDLER The `stream` adapter encountered an error.
+ */
+int fwk_io_write_nowait(
+    const struct fwk_io_stream *restrict stream,
+    size_t *restrict written,
+    const char *restrict buffer,
+    size_t size);
+
 /*!
  * \brief Read data from a stream.
  *
@@ -353,6 +444,9 @@ int fwk_io_putch_nowait(const struct fwk_io_stream *stream, char ch);
  *      the number of objects read is less than `count`. This error is not
  *      returned if the `read` parameter is not a null pointer value.
  *
+ *      Stream adapters that implement ::fwk_io_adapter::read are given the
+ *      whole buffer at once.
+ *
  * \param[in] stream Input stream.
  * \param[out] read Number of objects read.
  * \param[out] buffer Pointer to the array of uninitialized objects to write to.
@@ -386,6 +480,9 @@ int fwk_io_read(
  *      `size` times for each object, in order. The `written` parameter is
  *      optional, and may be set to a null pointer value.
  *
+ *      Stream adapters that implement ::fwk_io_adapter::write are given the
+ *      whole buffer at once.
+ *
  * \param[in] stream Output stream.
  * \param[out] written Number of objects written.
  * \param[in] buffer Pointer to the first object in the array to be written.
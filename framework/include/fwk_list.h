@@ -186,6 +186,23 @@
         struct fwk_dlist * : __fwk_dlist_insert \
     )(list, new, node)
 
+/*!
+ * \brief Move all the nodes of a linked list to the end of another.
+ *
+ * \details The nodes keep their order and \p src is left empty. The operation
+ *      takes constant time whatever the number of nodes moved.
+ *
+ * \param dst Pointer to the list to add to. Must not be \c NULL.
+ * \param src Pointer to the list to move the nodes from. Must not be \c NULL
+ *      and must be different from \p dst.
+ *
+ * \return None.
+ */
+#define fwk_list_splice(dst, src) \
+    _Generic((dst), \
+        struct fwk_slist * : __fwk_slist_splice \
+    )(dst, src)
+
 /*!
  * \brief Check if a node is in a list.
  *
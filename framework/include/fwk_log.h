@@ -59,6 +59,11 @@
  *      If a message is too large to fit into the remaining space of the
  *      internal buffer, the message will be dropped.
  *
+ *      When the framework is built with the `SCP_ENABLE_FWK_LOG_BINARY`
+ *      option, buffered messages are stored as binary records holding the
+ *      address of their format string and the raw value of their arguments,
+ *      and are only formatted when they are written to the log drain.
+ *
  *      Note that log messages are terminated at the column dictated by
  *      ::FMW_LOG_COLUMNS, or the earliest newline.
  * \{
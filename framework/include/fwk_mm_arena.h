@@ -0,0 +1,104 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FWK_MM_ARENA_H
+#define FWK_MM_ARENA_H
+
+#include <fwk_id.h>
+
+#include <stddef.h>
+
+/*!
+ * \addtogroup GroupLibFramework Framework
+ * \{
+ */
+
+/*!
+ * \defgroup GroupMMArena Arena Allocator
+ *
+ * \details The arena allocator is an alternative backend of the memory
+ *      management interface, used when the framework is built with the
+ *      `SCP_ENABLE_FWK_MM_ARENA` option. Memory is allocated linearly from a
+ *      single region provided by the architecture layer instead of the standard
+ *      library heap, and every allocation is charged to the module being
+ *      initialized, bound or started at the time of the allocation, or to the
+ *      framework otherwise.
+ *
+ *      Freed memory is only reclaimed when it belongs to the most recent
+ *      allocation. When the framework is also built with the
+ *      `SCP_ENABLE_FWK_MM_ARENA_SEAL` option, the arena is sealed once all the
+ *      modules have started, and any later allocation fails.
+ *
+ * \{
+ */
+
+/*!
+ * \def FMW_MM_ARENA_ALIGNMENT
+ *
+ * \brief Minimum alignment of the allocations from the arena, in bytes.
+ */
+#ifndef FMW_MM_ARENA_ALIGNMENT
+#    define FMW_MM_ARENA_ALIGNMENT (_Alignof(max_align_t))
+#endif
+
+/*!
+ * \brief Arena usage statistics.
+ */
+struct fwk_mm_arena_stats {
+    /*! Size of the arena in bytes, zero for the statistics of a module */
+    size_t size;
+
+    /*! Number of bytes currently allocated */
+    size_t used;
+
+    /*!
+     * \brief Highest number of bytes in use.
+     *
+     * \details For the arena, this is the highest amount of the arena ever
+     *      consumed, allocation overheads and unreclaimed memory included. For
+     *      a module, this is the highest number of bytes allocated at the same
+     *      time.
+     */
+    size_t peak;
+
+    /*!
+     * \brief Number of bytes consumed from the arena that do not hold an
+     *      allocation: freed memory that could not be reclaimed, alignment
+     *      padding and allocation headers. Zero for the statistics of a
+     *      module.
+     */
+    size_t fragmented;
+
+    /*! Number of allocations currently alive */
+    unsigned int block_count;
+};
+
+/*!
+ * \brief Get the usage statistics of the arena or of a module.
+ *
+ * \param[in] id ::FWK_ID_NONE to get the statistics of the whole arena, or
+ *      identifier of a module to get the statistics of the memory allocated on
+ *      behalf of this module.
+ * \param[out] stats The usage statistics.
+ *
+ * \retval ::FWK_SUCCESS The statistics were returned.
+ * \retval ::FWK_E_INIT The arena is not initialized.
+ * \retval ::FWK_E_PARAM One or more parameters were invalid.
+ *
+ * \return Status code representing the result of the operation.
+ */
+int fwk_mm_arena_get_stats(fwk_id_t id, struct fwk_mm_arena_stats *stats);
+
+/*!
+ * \}
+ */
+
+/*!
+ * \}
+ */
+
+#endif /* FWK_MM_ARENA_H */
@@ -86,6 +86,25 @@ struct fwk_module {
     unsigned int notification_count;
     #endif
 
+    /*!
+     * \brief Priority class of the events and notifications defined by the
+     *      module.
+     *
+     * \details Responses are queued with the class of the event they respond
+     *      to. This field is ignored unless the framework is built with event
+     *      priority scheduling.
+     */
+    enum fwk_event_priority event_priority;
+
+    /*!
+     * \brief Optional table of per-event priority classes.
+     *
+     * \details When not \c NULL, the table must hold ::fwk_module::event_count
+     *      entries indexed by event index, and overrides
+     *      ::fwk_module::event_priority for the events of the module.
+     */
+    const enum fwk_event_priority *event_priority_table;
+
     /*!
      * \brief Stream adapter.
      *
@@ -435,6 +454,19 @@ struct fwk_module_config {
 
     /*! Element table */
     struct fwk_module_elements elements;
+
+    /*!
+     * \brief Number of events of the event pool reserved to the module.
+     *
+     * \details Events sent by the module are first taken from its reserved
+     *      events, then from the events of the pool that are not reserved to
+     *      any module. Once both are exhausted, sending an event fails with
+     *      ::FWK_E_BUSY instead of draining the pool for the other modules.
+     *
+     * \note The sum of the quotas of all the modules must not exceed the size
+     *      of the event pool.
+     */
+    unsigned int event_quota;
 };
 
 /*!
@@ -37,6 +37,21 @@
 #    define FMW_NOTIFICATION_MAX 64
 #endif
 
+/*!
+ * \def FMW_NOTIFICATION_HANDLE_COUNT
+ *
+ * \brief Number of notification handles.
+ *
+ * \details Once the modules have started, a notification is queued as a single
+ *      copy of the notification event shared by all its subscribers, taken from
+ *      the event pool, and one handle per subscriber. When the handles are
+ *      exhausted, the remaining subscribers are sent their own copy of the
+ *      notification event instead.
+ */
+#ifndef FMW_NOTIFICATION_HANDLE_COUNT
+#    define FMW_NOTIFICATION_HANDLE_COUNT 32
+#endif
+
 /*!
  * \brief Subscribe to a notification.
  *
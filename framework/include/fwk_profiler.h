@@ -0,0 +1,152 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FWK_PROFILER_H
+#define FWK_PROFILER_H
+
+#include <fwk_id.h>
+#include <fwk_time.h>
+
+#include <stdint.h>
+
+/*!
+ * \addtogroup GroupLibFramework Framework
+ * \{
+ */
+
+/*!
+ * \defgroup GroupProfiler Event Profiler
+ *
+ * \details The event profiler timestamps the dispatch of every event and
+ *      notification to its handler, and accumulates latency statistics per
+ *      handling module and per event or notification identifier. It also
+ *      measures the time events raised by interrupt handlers spend waiting to
+ *      be dispatched, and tracks the depth of the event queues.
+ *
+ *      The profiler is only available when the framework is built with the
+ *      `SCP_ENABLE_FWK_EVENT_PROFILER` option.
+ *
+ * \{
+ */
+
+/*!
+ * \def FMW_EVENT_PROFILER_BUCKET_COUNT
+ *
+ * \brief Number of buckets of the latency histograms.
+ *
+ * \details Bucket 0 counts the latencies below one microsecond, bucket \c n
+ *      counts the latencies in [2^(n-1), 2^n) microseconds, and the last bucket
+ *      also counts all the latencies above its lower bound.
+ */
+#ifndef FMW_EVENT_PROFILER_BUCKET_COUNT
+#    define FMW_EVENT_PROFILER_BUCKET_COUNT 16
+#endif
+
+/*!
+ * \brief Latency statistics.
+ */
+struct fwk_profiler_latency {
+    /*! Number of measured latencies */
+    uint32_t count;
+
+    /*! Lowest latency */
+    fwk_duration_ns_t min;
+
+    /*! Highest latency */
+    fwk_duration_ns_t max;
+
+    /*! Sum of all the measured latencies */
+    fwk_duration_ns_t total;
+
+    /*! Log2 histogram, see ::FMW_EVENT_PROFILER_BUCKET_COUNT */
+    uint32_t histogram[FMW_EVENT_PROFILER_BUCKET_COUNT];
+};
+
+/*!
+ * \brief Event queue depth statistics.
+ */
+struct fwk_profiler_queue_stats {
+    /*! Number of events awaiting processing */
+    unsigned int event_queue_depth;
+
+    /*! Highest number of events awaiting processing at the same time */
+    unsigned int event_queue_peak;
+
+    /*! Number of events raised by interrupt handlers not pulled yet */
+    unsigned int isr_event_queue_depth;
+
+    /*! Highest number of events raised by interrupt handlers not pulled yet */
+    unsigned int isr_event_queue_peak;
+};
+
+/*!
+ * \brief Get the dispatch latency statistics of a module, event or
+ *      notification.
+ *
+ * \details The dispatch latency is the time spent in the handler of the
+ *      module the event or notification is targeted at.
+ *
+ * \param[in] id Identifier of a module, to get the statistics of all the events
+ *      and notifications processed by the module, or identifier of an event or
+ *      notification, to get the statistics of that event or notification
+ *      whichever module processed it.
+ * \param[out] latency The latency statistics.
+ *
+ * \retval ::FWK_SUCCESS The statistics were returned.
+ * \retval ::FWK_E_INIT The profiler is not initialized.
+ * \retval ::FWK_E_PARAM One or more parameters were invalid.
+ *
+ * \return Status code representing the result of the operation.
+ */
+int fwk_profiler_get_dispatch_latency(
+    fwk_id_t id,
+    struct fwk_profiler_latency *latency);
+
+/*!
+ * \brief Get the latency statistics of the events raised by interrupt
+ *      handlers.
+ *
+ * \details The latency is measured from the time the event is put in the ISR
+ *      event queue to the time its handler is called.
+ *
+ * \param[out] latency The latency statistics.
+ *
+ * \retval ::FWK_SUCCESS The statistics were returned.
+ * \retval ::FWK_E_INIT The profiler is not initialized.
+ * \retval ::FWK_E_PARAM One or more parameters were invalid.
+ *
+ * \return Status code representing the result of the operation.
+ */
+int fwk_profiler_get_isr_latency(struct fwk_profiler_latency *latency);
+
+/*!
+ * \brief Get the event queue depth statistics.
+ *
+ * \param[out] stats The queue depth statistics.
+ *
+ * \retval ::FWK_SUCCESS The statistics were returned.
+ * \retval ::FWK_E_INIT The profiler is not initialized.
+ * \retval ::FWK_E_PARAM One or more parameters were invalid.
+ *
+ * \return Status code representing the result of the operation.
+ */
+int fwk_profiler_get_queue_stats(struct fwk_profiler_queue_stats *stats);
+
+/*!
+ * \brief Reset all the latency statistics and the queue depth peaks.
+ */
+void fwk_profiler_reset(void);
+
+/*!
+ * \}
+ */
+
+/*!
+ * \}
+ */
+
+#endif /* FWK_PROFILER_H */
@@ -0,0 +1,243 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FWK_RING_SPSC_H
+#define FWK_RING_SPSC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*!
+ * \addtogroup GroupLibFramework Framework
+ * \{
+ */
+
+/*!
+ * \addtogroup GroupRing Ring Buffers
+ * \{
+ */
+
+/*!
+ * \defgroup GroupRingSpsc Single-Producer Single-Consumer Ring Buffers
+ *
+ * \brief Lock-free ring buffer interface.
+ *
+ * \details A single-producer single-consumer ring buffer can be written by
+ *      one execution context while it is read by another one, for example an
+ *      interrupt handler receiving data and the thread processing it, without
+ *      masking interrupts or taking a lock.
+ *
+ *      Unlike ::fwk_ring, the buffer never overwrites old data: data that does
+ *      not fit in the free space of the buffer is not pushed. The capacity of
+ *      the buffer must be a power of two.
+ *
+ *      Only the producer may call the functions that write to the buffer
+ *      (::fwk_ring_spsc_push, ::fwk_ring_spsc_acquire_write and
+ *      ::fwk_ring_spsc_commit_write), and only the consumer may call the
+ *      functions that read from the buffer (::fwk_ring_spsc_pop,
+ *      ::fwk_ring_spsc_peek, ::fwk_ring_spsc_acquire_read and
+ *      ::fwk_ring_spsc_release_read). The other functions may be called from
+ *      either side, but the value they return may be outdated by the time it is
+ *      used.
+ *
+ * \{
+ */
+
+/*!
+ * \brief Single-producer single-consumer ring buffer.
+ */
+struct fwk_ring_spsc {
+    /*!
+     * \brief Internal storage.
+     */
+    char *storage;
+
+    /*!
+     * \brief Size of ::fwk_ring_spsc::storage in bytes, a power of two.
+     */
+    size_t capacity;
+
+    /*!
+     * \brief Number of bytes ever read from the buffer.
+     *
+     * \details This index is only written by the consumer. It is not bounded
+     *      by the capacity of the buffer and wraps around on overflow.
+     */
+    size_t head;
+
+    /*!
+     * \brief Number of bytes ever written to the buffer.
+     *
+     * \details This index is only written by the producer. It is not bounded
+     *      by the capacity of the buffer and wraps around on overflow.
+     */
+    size_t tail;
+};
+
+/*!
+ * \brief Initialize a single-producer single-consumer ring buffer.
+ *
+ * \details The buffer must be initialized before the producer and the consumer
+ *      start using it.
+ *
+ * \param[out] ring Ring buffer to initialize.
+ * \param[in] storage Storage memory.
+ * \param[in] storage_size Size of \p storage in bytes. It must be a power of
+ *      two.
+ */
+void fwk_ring_spsc_init(
+    struct fwk_ring_spsc *ring,
+    char *storage,
+    size_t storage_size);
+
+/*!
+ * \brief Get the capacity of a ring buffer.
+ *
+ * \param[in] ring Ring buffer.
+ *
+ * \return Capacity of the ring buffer in bytes.
+ */
+size_t fwk_ring_spsc_get_capacity(const struct fwk_ring_spsc *ring);
+
+/*!
+ * \brief Get the number of bytes in a ring buffer.
+ *
+ * \param[in] ring Ring buffer.
+ *
+ * \return Number of bytes that can be read from the ring buffer.
+ */
+size_t fwk_ring_spsc_get_length(const struct fwk_ring_spsc *ring);
+
+/*!
+ * \brief Get the number of free bytes in a ring buffer.
+ *
+ * \param[in] ring Ring buffer.
+ *
+ * \return Number of bytes that can be written to the ring buffer.
+ */
+size_t fwk_ring_spsc_get_free(const struct fwk_ring_spsc *ring);
+
+/*!
+ * \brief Check whether a ring buffer is empty.
+ *
+ * \param[in] ring Ring buffer.
+ *
+ * \retval true The ring buffer is empty.
+ * \retval false The ring buffer has data in it.
+ */
+bool fwk_ring_spsc_is_empty(const struct fwk_ring_spsc *ring);
+
+/*!
+ * \brief Push data to the end of a ring buffer.
+ *
+ * \details Only the bytes that fit in the free space of the ring buffer are
+ *      written.
+ *
+ * \param[in, out] ring Ring buffer.
+ * \param[in] buffer Buffer to read data from.
+ * \param[in] buffer_size Size of \p buffer in bytes.
+ *
+ * \return Number of bytes written to \p ring.
+ */
+size_t fwk_ring_spsc_push(
+    struct fwk_ring_spsc *ring,
+    const char *buffer,
+    size_t buffer_size);
+
+/*!
+ * \brief Pop data from the beginning of a ring buffer.
+ *
+ * \param[in, out] ring Ring buffer.
+ * \param[out] buffer Buffer to write the data to, or \c NULL to discard it.
+ * \param[in] buffer_size Size of \p buffer in bytes.
+ *
+ * \return Number of bytes read from \p ring.
+ */
+size_t fwk_ring_spsc_pop(
+    struct fwk_ring_spsc *ring,
+    char *buffer,
+    size_t buffer_size);
+
+/*!
+ * \brief Read data from the beginning of a ring buffer without consuming it.
+ *
+ * \param[in] ring Ring buffer.
+ * \param[out] buffer Buffer to write the data to.
+ * \param[in] buffer_size Size of \p buffer in bytes.
+ *
+ * \return Number of bytes read from \p ring.
+ */
+size_t fwk_ring_spsc_peek(
+    const struct fwk_ring_spsc *ring,
+    char *buffer,
+    size_t buffer_size);
+
+/*!
+ * \brief Get the largest contiguous span of free space of a ring buffer.
+ *
+ * \details The producer fills the span in place, then makes the data available
+ *      to the consumer with ::fwk_ring_spsc_commit_write. The span does not
+ *      cross the end of the storage, so it may be shorter than the free space
+ *      of the ring buffer.
+ *
+ * \param[in] ring Ring buffer.
+ * \param[out] span Start of the span.
+ *
+ * \return Size of the span in bytes.
+ */
+size_t fwk_ring_spsc_acquire_write(
+    const struct fwk_ring_spsc *ring,
+    char **span);
+
+/*!
+ * \brief Make data written in place available to the consumer.
+ *
+ * \param[in, out] ring Ring buffer.
+ * \param[in] size Number of bytes written at the start of the span returned by
+ *      ::fwk_ring_spsc_acquire_write.
+ */
+void fwk_ring_spsc_commit_write(struct fwk_ring_spsc *ring, size_t size);
+
+/*!
+ * \brief Get the largest contiguous span of data of a ring buffer.
+ *
+ * \details The consumer reads the span in place, then gives the space back to
+ *      the producer with ::fwk_ring_spsc_release_read. The span does not cross
+ *      the end of the storage, so it may be shorter than the length of the ring
+ *      buffer.
+ *
+ * \param[in] ring Ring buffer.
+ * \param[out] span Start of the span.
+ *
+ * \return Size of the span in bytes.
+ */
+size_t fwk_ring_spsc_acquire_read(
+    const struct fwk_ring_spsc *ring,
+    const char **span);
+
+/*!
+ * \brief Give space read in place back to the producer.
+ *
+ * \param[in, out] ring Ring buffer.
+ * \param[in] size Number of bytes read at the start of the span returned by
+ *      ::fwk_ring_spsc_acquire_read.
+ */
+void fwk_ring_spsc_release_read(struct fwk_ring_spsc *ring, size_t size);
+
+/*!
+ * \}
+ */
+
+/*!
+ * \}
+ */
+
+/*!
+ * \}
+ */
+
+#endif /* FWK_RING_SPSC_H */
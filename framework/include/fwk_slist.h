@@ -148,6 +148,16 @@ void __fwk_slist_remove(struct fwk_slist *list, struct fwk_slist_node *node)
     FWK_LEAF FWK_NOTHROW FWK_NONNULL(1) FWK_NONNULL(2) FWK_READ_WRITE1(1)
         FWK_READ_ONLY1(2);
 
+/*
+ * Move all the nodes of a singly-linked list to the end of another.
+ *
+ * For internal use only.
+ * See fwk_list_splice(dst, src) for the public interface.
+ */
+void __fwk_slist_splice(struct fwk_slist *dst, struct fwk_slist *src)
+    FWK_LEAF FWK_NOTHROW FWK_NONNULL(1) FWK_NONNULL(2) FWK_READ_WRITE1(1)
+        FWK_READ_WRITE1(2);
+
 /*
  * Test if a node is in a singly-linked list.
  *
@@ -13,6 +13,51 @@
 
 #include <stdbool.h>
 
+/*
+ * Light event awaiting processing. Light events are queued in this compact
+ * form, without the parameters of standard events, alongside the standard
+ * events in the event queues. Exposed for testing purposes only.
+ */
+struct __fwk_light_event {
+    /* Linked list node */
+    struct fwk_slist_node slist_node;
+
+    /* Light event as put by its source */
+    struct fwk_event_light event;
+
+#ifdef BUILD_HAS_EVENT_PROFILER
+    /* Time the event was put in the ISR event queue, see fwk_event */
+    fwk_timestamp_t isr_timestamp;
+#endif
+};
+
+#ifdef BUILD_HAS_NOTIFICATION
+/*
+ * Notification awaiting processing by one of its targets. The notification
+ * event itself is shared by all the targets and kept in the event pool until
+ * all the handles referencing it have been processed. Exposed for testing
+ * purposes only.
+ */
+struct __fwk_notification_handle {
+    /* Linked list node */
+    struct fwk_slist_node slist_node;
+
+    /* Identifier of the target */
+    fwk_id_t target_id;
+
+    /* Cookie of the notification sent to the target */
+    uint32_t cookie;
+
+    /* Shared notification event */
+    struct fwk_event *event;
+
+#    ifdef BUILD_HAS_EVENT_PROFILER
+    /* Time the handle was put in the ISR event queue, see fwk_event */
+    fwk_timestamp_t isr_timestamp;
+#    endif
+};
+#endif
+
 /*
  * Context component context. Exposed for testing purposes only.
  */
@@ -32,14 +77,81 @@ struct __fwk_ctx {
      */
     struct fwk_slist free_event_queue;
 
+    /* Table of the light events */
+    struct __fwk_light_event *light_event_table;
+
+    /* Number of light events in the light event table */
+    unsigned int light_event_count;
+
+    /* Queue of light events that are free to be filled in and queued */
+    struct fwk_slist free_light_event_queue;
+
+    /*
+     * Standard event the light event being processed is expanded into. Its
+     * parameters are never written and stay zeroed.
+     */
+    struct fwk_event light_dispatch_event;
+
+#ifdef BUILD_HAS_NOTIFICATION
+    /* Table of the event pool */
+    struct fwk_event *event_table;
+
+    /*
+     * Number of notification handles referencing each event of the event pool,
+     * indexed as the event table.
+     */
+    unsigned int *event_ref_count_table;
+
+    /* Table of the notification handles */
+    struct __fwk_notification_handle *notification_handle_table;
+
+    /* Number of notification handles in the notification handle table */
+    unsigned int notification_handle_count;
+
+    /* Queue of notification handles that are free to be used */
+    struct fwk_slist free_notification_handle_queue;
+#endif
+
     /* Queue of events, generated by ISRs, that are awaiting processing */
     struct fwk_slist isr_event_queue;
 
+#ifdef BUILD_HAS_EVENT_PRIORITY
+    /*
+     * Queues of events that are awaiting processing, one per priority class,
+     * from the highest priority class to the lowest.
+     */
+    struct fwk_slist event_queue_table[FWK_EVENT_PRIORITY_COUNT];
+
+    /*
+     * Number of dispatches a non-empty class has been skipped in favour of a
+     * higher priority class, indexed as the event queue table.
+     */
+    unsigned int event_queue_skip_count[FWK_EVENT_PRIORITY_COUNT];
+#else
     /* Queue of events that are awaiting processing */
     struct fwk_slist event_queue;
+#endif
 
     /* The event currently being processed */
     struct fwk_event *current_event;
+
+    /* Number of events in the event pool */
+    unsigned int event_count;
+
+    /* Number of events of the pool not reserved to a module */
+    unsigned int shared_event_count;
+
+    /* Number of shared events currently allocated */
+    unsigned int shared_event_used_count;
+
+    /* Number of events currently allocated */
+    unsigned int event_used_count;
+
+    /* Highest number of events allocated at the same time */
+    unsigned int event_peak_count;
+
+    /* Number of allocations refused because a quota was exhausted */
+    unsigned int event_busy_count;
 };
 
 /*
@@ -59,6 +59,31 @@ const struct fwk_event *__fwk_get_current_event(void);
  */
 int __fwk_put_notification(struct fwk_event *event);
 
+/*
+ * \brief Put a notification event in the event queues for each of its targets.
+ *
+ * \details The notification event is copied once into an event of the event
+ *      pool, shared by all the targets, and a notification handle referencing
+ *      this copy is queued per target. The copy is freed once the notification
+ *      has been processed by all its targets. When the event pool or the
+ *      notification handles are exhausted, the remaining targets are sent their
+ *      own copy of the notification event, as with __fwk_put_notification().
+ *
+ *      The cookie of the notification event is updated with the cookie of the
+ *      notification put for the last target.
+ *
+ * \param event Pointer to the notification event to queue. Its target
+ *      identifier is ignored.
+ * \param target_table Identifiers of the targets, in fan-out order.
+ * \param target_count Number of targets.
+ * \param[out] count Number of notifications queued.
+ */
+void __fwk_put_notification_fanout(
+    struct fwk_event *event,
+    const fwk_id_t *target_table,
+    unsigned int target_count,
+    unsigned int *count);
+
 /*!
  * \brief Put an event in one of the event queues.
  *
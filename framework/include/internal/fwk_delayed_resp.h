@@ -8,10 +8,55 @@
 #ifndef FWK_INTERNAL_DELAYED_RESP_H
 #define FWK_INTERNAL_DELAYED_RESP_H
 
+#include <fwk_event.h>
 #include <fwk_id.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
+/*!
+ * \internal
+ *
+ * \brief Initialize the delayed response component.
+ *
+ * \details Allocate the index used to look up delayed responses by cookie.
+ *      Delayed responses are taken from the event pool so the index is sized
+ *      from the number of events in the pool.
+ *
+ * \param event_count The number of events in the event pool.
+ *
+ * \retval ::FWK_SUCCESS The delayed response component was initialized.
+ */
+int __fwk_delayed_response_init(size_t event_count);
+
+/*!
+ * \internal
+ *
+ * \brief Store a delayed response.
+ *
+ * \details The delayed response is appended to the list of delayed responses
+ *      of the entity and indexed by its cookie.
+ *
+ * \note The function assumes the validity of all its input parameters.
+ *
+ * \param id Identifier of the module or element that delayed the response.
+ * \param event Delayed response event, allocated from the event pool.
+ */
+void __fwk_add_delayed_response(fwk_id_t id, struct fwk_event *event);
+
+/*!
+ * \internal
+ *
+ * \brief Remove a delayed response.
+ *
+ * \note The function assumes the validity of all its input parameters.
+ *
+ * \param id Identifier of the module or element that delayed the response.
+ * \param event Delayed response event, as returned by
+ *      ::__fwk_search_delayed_response.
+ */
+void __fwk_remove_delayed_response(fwk_id_t id, struct fwk_event *event);
+
 /*!
  * \internal
  *
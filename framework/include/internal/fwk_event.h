@@ -27,9 +27,10 @@ enum fwk_event_type {
      *  Light event does not include 'params' and few other attributes as
      *  <tt> struct fwk_event </tt> type object and are only used to send
      *  directional event to target module. The object of these types
-     *  are converted to \c FWK_EVENT_TYPE_STD type objects in a preallocated
-     *  <tt> struct fwk_event </tt> type event before processing by the
-     *  target module's <tt> process_event </tt> function.
+     *  are queued in a compact form and converted to \c FWK_EVENT_TYPE_STD
+     *  type objects in a preallocated <tt> struct fwk_event </tt> type event
+     *  before processing by the target module's <tt> process_event </tt>
+     *  function.
      */
     FWK_EVENT_TYPE_LIGHT,
 
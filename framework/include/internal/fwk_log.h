@@ -0,0 +1,99 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FWK_INTERNAL_LOG_H
+#define FWK_INTERNAL_LOG_H
+
+#include <fwk_time.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+
+/*
+ * Binary log records.
+ *
+ * A record holds the duration since boot at which the message was logged, the
+ * address of its format string and the raw value of each of its arguments, in
+ * the native representation of the target. Strings are copied into the record,
+ * including their null terminator.
+ *
+ * When written undecoded to the log drain, each record is preceded by
+ * FWK_LOG_RECORD_MAGIC and by the size of the record in a single byte.
+ */
+
+/*!
+ * \internal
+ *
+ * \brief Byte marking the start of a binary log record in the log drain.
+ */
+#define FWK_LOG_RECORD_MAGIC ((char)0x1E)
+
+/*!
+ * \internal
+ *
+ * \brief Encode a log message into a binary log record.
+ *
+ * \param record_size Size of \p record in bytes.
+ * \param[out] record Record.
+ * \param timestamp Duration since boot at which the message was logged.
+ * \param format Format string, which must outlive the record.
+ * \param[in, out] args Arguments of the format string.
+ *
+ * \return Size of the record in bytes, or zero if the message uses a
+ *      conversion that cannot be encoded or does not fit in \p record.
+ */
+size_t __fwk_log_encode(
+    size_t record_size,
+    char record[record_size],
+    fwk_duration_ns_t timestamp,
+    const char *format,
+    va_list *args);
+
+/*!
+ * \internal
+ *
+ * \brief Encode a formatted log message into a binary log record.
+ *
+ * \details The message is truncated to fit in \p record.
+ *
+ * \param record_size Size of \p record in bytes.
+ * \param[out] record Record.
+ * \param timestamp Duration since boot at which the message was logged.
+ * \param message Formatted message.
+ *
+ * \return Size of the record in bytes.
+ */
+size_t __fwk_log_encode_text(
+    size_t record_size,
+    char record[record_size],
+    fwk_duration_ns_t timestamp,
+    const char *message);
+
+/*!
+ * \internal
+ *
+ * \brief Format the message held by a binary log record.
+ *
+ * \details The message is truncated to fit in \p buffer, and is always null
+ *      terminated.
+ *
+ * \param record_size Size of \p record in bytes.
+ * \param[in] record Record.
+ * \param[out] timestamp Duration since boot at which the message was logged.
+ * \param buffer_size Size of \p buffer in bytes.
+ * \param[out] buffer Formatted message.
+ *
+ * \return Length of the formatted message.
+ */
+size_t __fwk_log_decode(
+    size_t record_size,
+    const char record[record_size],
+    fwk_duration_ns_t *timestamp,
+    size_t buffer_size,
+    char buffer[buffer_size]);
+
+#endif /* FWK_INTERNAL_LOG_H */
@@ -0,0 +1,56 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FWK_INTERNAL_MM_H
+#define FWK_INTERNAL_MM_H
+
+#include <fwk_id.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef BUILD_HAS_MM_ARENA
+
+/*!
+ * \internal
+ *
+ * \brief Initialize the arena allocator.
+ *
+ * \param start Start address of the arena.
+ * \param size Size of the arena in bytes.
+ *
+ * \retval ::FWK_SUCCESS The arena was initialized.
+ * \retval ::FWK_E_PARAM The arena is empty.
+ */
+int __fwk_mm_arena_init(uintptr_t start, size_t size);
+
+/*!
+ * \internal
+ *
+ * \brief Set the module the following allocations are charged to.
+ *
+ * \param id Identifier of the module or of one of its elements, or
+ *      ::FWK_ID_NONE to charge the allocations to the framework.
+ */
+void __fwk_mm_set_owner(fwk_id_t id);
+
+/*!
+ * \internal
+ *
+ * \brief Seal the arena, making any later allocation fail.
+ */
+void __fwk_mm_arena_seal(void);
+
+#else
+
+static inline void __fwk_mm_set_owner(fwk_id_t id)
+{
+}
+
+#endif
+
+#endif /* FWK_INTERNAL_MM_H */
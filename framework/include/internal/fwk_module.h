@@ -47,10 +47,25 @@ struct fwk_module_context {
      * notification defined by the module.
      */
     struct fwk_dlist *subscription_dlist_table;
+
+    /*
+     * Table of notification fan-outs, indexed as the subscription lists.
+     * Allocated once the modules have started.
+     */
+    struct __fwk_notification_fanout *fanout_table;
     #endif
 
     /* List of delayed response events */
     struct fwk_slist delayed_response_list;
+
+    /* Number of events of the event pool currently allocated by the module */
+    unsigned int event_used_count;
+
+    /* Highest number of events allocated by the module at the same time */
+    unsigned int event_peak_count;
+
+    /* Number of allocations refused because the quota was exhausted */
+    unsigned int event_busy_count;
 };
 
 /*
@@ -72,6 +87,12 @@ struct fwk_element_ctx {
      * notification defined by the element's module.
      */
     struct fwk_dlist *subscription_dlist_table;
+
+    /*
+     * Table of notification fan-outs, indexed as the subscription lists.
+     * Allocated once the modules have started.
+     */
+    struct __fwk_notification_fanout *fanout_table;
     #endif
 
     /* List of delayed response events */
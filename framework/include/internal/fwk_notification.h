@@ -24,6 +24,19 @@ struct __fwk_notification_subscription {
     fwk_id_t target_id;
 };
 
+/*
+ * Fan-out of a notification emitted by an entity: the targets of its
+ * subscriptions, in subscription order, stored contiguously in the fan-out
+ * table of the notification component.
+ */
+struct __fwk_notification_fanout {
+    /* Index of the first target in the fan-out table */
+    unsigned int first;
+
+    /* Number of targets */
+    unsigned int count;
+};
+
 /*
  * \brief Initialize the notification framework component.
  *
@@ -38,6 +51,18 @@ struct __fwk_notification_subscription {
  */
 int __fwk_notification_init(size_t notification_count);
 
+/*
+ * \brief Freeze the subscriptions of the pre-runtime stages.
+ *
+ * \details Precompute the fan-out of every notification of every entity from
+ *      its subscription list. Notifications are then sent to the precomputed
+ *      targets with a single shared notification event. Subscriptions made or
+ *      removed afterwards update the fan-out of the notification concerned.
+ *
+ * \note Must be called once all the modules have started.
+ */
+void __fwk_notification_freeze(void);
+
 /*
  * \brief Reset the notification framework component.
  *
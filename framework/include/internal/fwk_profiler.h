@@ -0,0 +1,106 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FWK_INTERNAL_PROFILER_H
+#define FWK_INTERNAL_PROFILER_H
+
+#include <fwk_event.h>
+#include <fwk_status.h>
+#include <fwk_time.h>
+
+#include <stdbool.h>
+
+#ifdef BUILD_HAS_EVENT_PROFILER
+
+/*!
+ * \internal
+ *
+ * \brief Initialize the event profiler.
+ *
+ * \details Allocate the per-event and per-notification statistics of all the
+ *      modules. Must be called once the module contexts are initialized.
+ *
+ * \retval ::FWK_SUCCESS The profiler was initialized.
+ */
+int __fwk_profiler_init(void);
+
+/*!
+ * \internal
+ *
+ * \brief Record that an event was put in one of the event queues.
+ *
+ * \param is_isr_event Whether the event was put in the ISR event queue.
+ *
+ * \return Time the event was put in the ISR event queue, zero if the event was
+ *      put in the event queue.
+ */
+fwk_timestamp_t __fwk_profiler_event_queued(bool is_isr_event);
+
+/*!
+ * \internal
+ *
+ * \brief Record that events were moved from the ISR event queue to the event
+ *      queues.
+ *
+ * \param count Number of events moved.
+ */
+void __fwk_profiler_isr_events_pulled(unsigned int count);
+
+/*!
+ * \internal
+ *
+ * \brief Record the start of the dispatch of an event to its handler.
+ *
+ * \param event Event about to be processed.
+ *
+ * \return Time the dispatch started.
+ */
+fwk_timestamp_t __fwk_profiler_dispatch_start(const struct fwk_event *event);
+
+/*!
+ * \internal
+ *
+ * \brief Record the end of the dispatch of an event to its handler.
+ *
+ * \param event Event that was processed.
+ * \param start Time the dispatch started.
+ */
+void __fwk_profiler_dispatch_end(
+    const struct fwk_event *event,
+    fwk_timestamp_t start);
+
+#else
+
+static inline int __fwk_profiler_init(void)
+{
+    return FWK_SUCCESS;
+}
+
+static inline fwk_timestamp_t __fwk_profiler_event_queued(bool is_isr_event)
+{
+    return 0;
+}
+
+static inline void __fwk_profiler_isr_events_pulled(unsigned int count)
+{
+}
+
+static inline fwk_timestamp_t __fwk_profiler_dispatch_start(
+    const struct fwk_event *event)
+{
+    return 0;
+}
+
+static inline void __fwk_profiler_dispatch_end(
+    const struct fwk_event *event,
+    fwk_timestamp_t start)
+{
+}
+
+#endif
+
+#endif /* FWK_INTERNAL_PROFILER_H */
@@ -19,6 +19,7 @@
 #endif
 
 #include <internal/fwk_core.h>
+#include <internal/fwk_mm.h>
 
 #include <fwk_io.h>
 #include <fwk_log.h>
@@ -55,6 +56,28 @@ static int fwk_arch_interrupt_init(int (*interrupt_init_handler)(
     return FWK_SUCCESS;
 }
 
+#ifdef BUILD_HAS_MM_ARENA
+static int fwk_arch_mm_init(int (*mm_init_handler)(
+    struct fwk_arch_mm_data *data))
+{
+    int status;
+    struct fwk_arch_mm_data data;
+
+    /* Retrieve the memory region of the arena from the architecture layer */
+    status = mm_init_handler(&data);
+    if (status != FWK_SUCCESS) {
+        return FWK_E_PANIC;
+    }
+
+    status = __fwk_mm_arena_init(data.start, data.size);
+    if (status != FWK_SUCCESS) {
+        return FWK_E_PANIC;
+    }
+
+    return FWK_SUCCESS;
+}
+#endif
+
 int fwk_arch_init(const struct fwk_arch_init_driver *driver)
 {
     int status;
@@ -67,6 +90,18 @@ int fwk_arch_init(const struct fwk_arch_init_driver *driver)
         return FWK_E_PARAM;
     }
 
+#ifdef BUILD_HAS_MM_ARENA
+    if (driver->mm == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    /* The arena must be ready before the first allocation */
+    status = fwk_arch_mm_init(driver->mm);
+    if (!fwk_expect(status == FWK_SUCCESS)) {
+        return FWK_E_PANIC;
+    }
+#endif
+
     fwk_module_init();
 
     status = fwk_io_init();
@@ -12,6 +12,7 @@
 #include <internal/fwk_core.h>
 #include <internal/fwk_delayed_resp.h>
 #include <internal/fwk_module.h>
+#include <internal/fwk_profiler.h>
 
 #include <fwk_assert.h>
 #include <fwk_core.h>
@@ -27,7 +28,9 @@
 #include <fwk_log.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
+#include <fwk_module_idx.h>
 #include <fwk_noreturn.h>
+#include <fwk_notification.h>
 #include <fwk_status.h>
 #include <fwk_string.h>
 
@@ -51,54 +54,531 @@ enum interrupt_states {
  * Static functions
  */
 
+#ifdef BUILD_HAS_EVENT_PRIORITY
+/*
+ * Position of each priority class in the event queue table, from the highest
+ * priority class to the lowest.
+ */
+static const unsigned int event_priority_rank[FWK_EVENT_PRIORITY_COUNT] = {
+    [FWK_EVENT_PRIORITY_HIGH] = 0,
+    [FWK_EVENT_PRIORITY_NORMAL] = 1,
+    [FWK_EVENT_PRIORITY_LOW] = 2,
+};
+
+/*
+ * Get the priority class of an event.
+ *
+ * \details The class is defined by the module owning the event identifier, so
+ *      that a response is queued with the class of the event it responds to.
+ *
+ * \param id Identifier of the event.
+ * \param is_notification Whether the event is a notification.
+ *
+ * \return The priority class of the event.
+ */
+static enum fwk_event_priority get_event_priority(
+    fwk_id_t id,
+    bool is_notification)
+{
+    const struct fwk_module *module;
+    enum fwk_event_priority priority;
+    unsigned int event_idx;
+
+    module = fwk_module_get_ctx(id)->desc;
+    priority = module->event_priority;
+
+    if ((!is_notification) && (module->event_priority_table != NULL)) {
+        event_idx = fwk_id_get_event_idx(id);
+        if (event_idx < module->event_count) {
+            priority = module->event_priority_table[event_idx];
+        }
+    }
+
+    fwk_assert(priority < FWK_EVENT_PRIORITY_COUNT);
+
+    return priority;
+}
+#endif
+
+/*
+ * Get the queue an event awaiting processing must be put in.
+ *
+ * \param id Identifier of the event.
+ * \param is_notification Whether the event is a notification.
+ *
+ * \return The pointer to the event queue.
+ */
+static struct fwk_slist *get_event_queue(fwk_id_t id, bool is_notification)
+{
+#ifdef BUILD_HAS_EVENT_PRIORITY
+    return &ctx.event_queue_table[event_priority_rank[get_event_priority(
+        id, is_notification)]];
+#else
+    (void)id;
+    (void)is_notification;
+
+    return &ctx.event_queue;
+#endif
+}
+
+static bool is_event_queue_empty(void)
+{
+#ifdef BUILD_HAS_EVENT_PRIORITY
+    unsigned int rank;
+
+    for (rank = 0; rank < FWK_EVENT_PRIORITY_COUNT; rank++) {
+        if (!fwk_list_is_empty(&ctx.event_queue_table[rank])) {
+            return false;
+        }
+    }
+
+    return true;
+#else
+    return fwk_list_is_empty(&ctx.event_queue);
+#endif
+}
+
+/*
+ * Get the light event a queued node belongs to.
+ *
+ * \param node Node of a queued event.
+ *
+ * \return The pointer to the light event, NULL if the node belongs to a
+ *      standard event.
+ */
+static struct __fwk_light_event *get_light_event(struct fwk_slist_node *node)
+{
+    uintptr_t address = (uintptr_t)node;
+    uintptr_t table_start = (uintptr_t)ctx.light_event_table;
+    uintptr_t table_end = (uintptr_t)(
+        ctx.light_event_table + ctx.light_event_count);
+
+    if ((address < table_start) || (address >= table_end)) {
+        return NULL;
+    }
+
+    return FWK_LIST_GET(node, struct __fwk_light_event, slist_node);
+}
+
+#ifdef BUILD_HAS_NOTIFICATION
+/*
+ * Get the notification handle a queued node belongs to.
+ *
+ * \param node Node of a queued event.
+ *
+ * \return The pointer to the notification handle, NULL if the node belongs to
+ *      a standard or light event.
+ */
+static struct __fwk_notification_handle *get_notification_handle(
+    struct fwk_slist_node *node)
+{
+    uintptr_t address = (uintptr_t)node;
+    uintptr_t table_start = (uintptr_t)ctx.notification_handle_table;
+    uintptr_t table_end = (uintptr_t)(
+        ctx.notification_handle_table + ctx.notification_handle_count);
+
+    if ((address < table_start) || (address >= table_end)) {
+        return NULL;
+    }
+
+    return FWK_LIST_GET(node, struct __fwk_notification_handle, slist_node);
+}
+#endif
+
+/*
+ * Get the queue a queued standard or light event must be moved to.
+ *
+ * \param node Node of the queued event.
+ *
+ * \return The pointer to the event queue.
+ */
+static struct fwk_slist *get_node_event_queue(struct fwk_slist_node *node)
+{
+    struct __fwk_light_event *light_event;
+    struct fwk_event *event;
+#ifdef BUILD_HAS_NOTIFICATION
+    struct __fwk_notification_handle *handle;
+#endif
+
+    light_event = get_light_event(node);
+    if (light_event != NULL) {
+        return get_event_queue(light_event->event.id, false);
+    }
+
+#ifdef BUILD_HAS_NOTIFICATION
+    handle = get_notification_handle(node);
+    if (handle != NULL) {
+        return get_event_queue(handle->event->id, true);
+    }
+#endif
+
+    event = FWK_LIST_GET(node, struct fwk_event, slist_node);
+
+    return get_event_queue(event->id, event->is_notification);
+}
+
+/*
+ * Remove the next event to process from the event queues.
+ *
+ * \details With event priority scheduling, the event is taken from the highest
+ *      priority non-empty queue unless a lower priority non-empty queue has
+ *      been skipped more than FMW_EVENT_PRIORITY_STARVATION_LIMIT times, in
+ *      which case the event is taken from this queue instead.
+ *
+ * \return The node of the standard or light event, NULL if all the event
+ *      queues are empty.
+ */
+static struct fwk_slist_node *pop_next_event(void)
+{
+#ifdef BUILD_HAS_EVENT_PRIORITY
+    unsigned int rank;
+    unsigned int selected = FWK_EVENT_PRIORITY_COUNT;
+    unsigned int aged = FWK_EVENT_PRIORITY_COUNT;
+
+    for (rank = 0; rank < FWK_EVENT_PRIORITY_COUNT; rank++) {
+        if (fwk_list_is_empty(&ctx.event_queue_table[rank])) {
+            ctx.event_queue_skip_count[rank] = 0;
+            continue;
+        }
+
+        if (selected == FWK_EVENT_PRIORITY_COUNT) {
+            selected = rank;
+        } else if (
+            (aged == FWK_EVENT_PRIORITY_COUNT) &&
+            (ctx.event_queue_skip_count[rank] >=
+             FMW_EVENT_PRIORITY_STARVATION_LIMIT)) {
+            aged = rank;
+        }
+
+        ctx.event_queue_skip_count[rank]++;
+    }
+
+    if (aged != FWK_EVENT_PRIORITY_COUNT) {
+        selected = aged;
+    }
+
+    if (selected == FWK_EVENT_PRIORITY_COUNT) {
+        return NULL;
+    }
+
+    ctx.event_queue_skip_count[selected] = 0;
+
+    return fwk_list_pop_head(&ctx.event_queue_table[selected]);
+#else
+    return fwk_list_pop_head(&ctx.event_queue);
+#endif
+}
+
+/*
+ * Get the identifier of the entity an event of the event pool is charged to.
+ *
+ * \details Events are charged to the entity that sends them, except responses
+ *      that are charged to the entity that requested them.
+ *
+ * \param event Event of the event pool.
+ *
+ * \return The identifier of the entity the event is charged to.
+ */
+static fwk_id_t get_event_charged_id(const struct fwk_event *event)
+{
+    return event->is_response ? event->target_id : event->source_id;
+}
+
+/*
+ * Allocate an event from the event pool on behalf of a module.
+ *
+ * \details The event is taken from the events reserved to the module when its
+ *      quota is not exhausted, otherwise from the events shared by all the
+ *      modules. A response is not throttled: it is allocated as long as the
+ *      event pool is not empty, even if both the quota of the module and the
+ *      shared events are exhausted.
+ *
+ * \param charged_id Identifier of the entity the event is allocated for.
+ * \param is_response Whether the event is a response.
+ * \param[out] event The allocated event.
+ *
+ * \retval ::FWK_SUCCESS The event was allocated.
+ * \retval ::FWK_E_BUSY Both the quota of the module and the shared events are
+ *      exhausted. The allocation may be retried once events have been freed.
+ * \retval ::FWK_E_NOMEM The event pool is empty.
+ */
+static int alloc_event(
+    fwk_id_t charged_id,
+    bool is_response,
+    struct fwk_event **event)
+{
+    struct fwk_module_context *module_ctx;
+    bool is_shared = false;
+    unsigned int flags;
+
+    module_ctx = fwk_module_get_ctx(charged_id);
+
+    flags = fwk_interrupt_global_disable();
+
+    if (module_ctx->event_used_count >= module_ctx->config->event_quota) {
+        if ((ctx.shared_event_used_count >= ctx.shared_event_count) &&
+            !is_response) {
+            module_ctx->event_busy_count++;
+            ctx.event_busy_count++;
+            (void)fwk_interrupt_global_enable(flags);
+
+            return FWK_E_BUSY;
+        }
+
+        is_shared = true;
+    }
+
+    *event = FWK_LIST_GET(
+        fwk_list_pop_head(&ctx.free_event_queue), struct fwk_event, slist_node);
+    if (*event == NULL) {
+        (void)fwk_interrupt_global_enable(flags);
+
+        return FWK_E_NOMEM;
+    }
+
+    if (is_shared) {
+        ctx.shared_event_used_count++;
+    }
+
+    if (++module_ctx->event_used_count > module_ctx->event_peak_count) {
+        module_ctx->event_peak_count = module_ctx->event_used_count;
+    }
+
+    if (++ctx.event_used_count > ctx.event_peak_count) {
+        ctx.event_peak_count = ctx.event_used_count;
+    }
+
+    (void)fwk_interrupt_global_enable(flags);
+
+    return FWK_SUCCESS;
+}
+
 /*
  * Duplicate an event.
  *
  * \param event Pointer to the event to duplicate.
  * \param event_type Type of the event structure as defined in
  *     \c fwk_event_type
+ * \param[out] allocated_event The pointer to the duplicated event.
  *
  * \pre \p event must not be NULL
  *
- * \return The pointer to the duplicated event, NULL if the allocation to
- *      duplicate the event failed.
+ * \retval ::FWK_SUCCESS The event was duplicated.
+ * \retval ::FWK_E_BUSY The event quota of the source is exhausted.
+ * \retval ::FWK_E_NOMEM The event pool is empty.
  */
-static struct fwk_event *duplicate_event(
+static int duplicate_event(
     void *event,
-    enum fwk_event_type event_type)
+    enum fwk_event_type event_type,
+    struct fwk_event **allocated_event)
 {
-    struct fwk_event *allocated_event = NULL;
-    unsigned int flags;
+    int status;
+    fwk_id_t charged_id;
+    bool is_response = false;
 
     fwk_assert(event != NULL);
 
-    flags = fwk_interrupt_global_disable();
-    allocated_event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx.free_event_queue), struct fwk_event, slist_node);
-    (void)fwk_interrupt_global_enable(flags);
+    if (event_type == FWK_EVENT_TYPE_LIGHT) {
+        charged_id = ((struct fwk_event_light *)event)->source_id;
+    } else {
+        charged_id = get_event_charged_id((struct fwk_event *)event);
+        is_response = ((struct fwk_event *)event)->is_response;
+    }
 
-    if (allocated_event == NULL) {
-        FWK_LOG_CRIT(err_msg_func, FWK_E_NOMEM, __func__);
+    status = alloc_event(charged_id, is_response, allocated_event);
+    if (status == FWK_E_BUSY) {
+        FWK_LOG_WARN(err_msg_func, status, __func__);
+
+        return status;
+    } else if (status != FWK_SUCCESS) {
+        FWK_LOG_CRIT(err_msg_func, status, __func__);
         fwk_unexpected();
 
-        return NULL;
+        return status;
     }
+
     if (event_type == FWK_EVENT_TYPE_LIGHT) {
         struct fwk_event_light *light_event = (struct fwk_event_light *)event;
-        allocated_event->id = light_event->id;
-        allocated_event->source_id = light_event->source_id;
-        allocated_event->target_id = light_event->target_id;
-        allocated_event->is_notification = false;
-        allocated_event->response_requested = light_event->response_requested;
-        allocated_event->is_delayed_response = false;
-        allocated_event->is_response = false;
+        (*allocated_event)->id = light_event->id;
+        (*allocated_event)->source_id = light_event->source_id;
+        (*allocated_event)->target_id = light_event->target_id;
+        (*allocated_event)->is_notification = false;
+        (*allocated_event)->response_requested =
+            light_event->response_requested;
+        (*allocated_event)->is_delayed_response = false;
+        (*allocated_event)->is_response = false;
     } else {
-        *allocated_event = *((struct fwk_event *)event);
+        **allocated_event = *((struct fwk_event *)event);
     }
 
-    allocated_event->slist_node = (struct fwk_slist_node){ 0 };
+    (*allocated_event)->slist_node = (struct fwk_slist_node){ 0 };
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Allocate a light event from the light event pool.
+ *
+ * \return The pointer to the light event, NULL if the light event pool is
+ *      exhausted.
+ */
+static struct __fwk_light_event *alloc_light_event(void)
+{
+    struct __fwk_light_event *light_event;
+    unsigned int flags;
+
+    flags = fwk_interrupt_global_disable();
+    light_event = FWK_LIST_GET(
+        fwk_list_pop_head(&ctx.free_light_event_queue),
+        struct __fwk_light_event,
+        slist_node);
+    (void)fwk_interrupt_global_enable(flags);
 
-    return allocated_event;
+    return light_event;
+}
+
+#ifdef BUILD_HAS_NOTIFICATION
+/*
+ * Allocate a notification handle.
+ *
+ * \return The pointer to the notification handle, NULL if the notification
+ *      handles are exhausted.
+ */
+static struct __fwk_notification_handle *alloc_notification_handle(void)
+{
+    struct __fwk_notification_handle *handle;
+    unsigned int flags;
+
+    flags = fwk_interrupt_global_disable();
+    handle = FWK_LIST_GET(
+        fwk_list_pop_head(&ctx.free_notification_handle_queue),
+        struct __fwk_notification_handle,
+        slist_node);
+    (void)fwk_interrupt_global_enable(flags);
+
+    return handle;
+}
+#endif
+
+#if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
+/*
+ * Log an action on a standard or light event.
+ *
+ * \param action Description of the action.
+ * \param node Node of the event.
+ */
+static void log_event(const char *action, struct fwk_slist_node *node)
+{
+    struct __fwk_light_event *light_event;
+    struct fwk_event *event;
+#    ifdef BUILD_HAS_NOTIFICATION
+    struct __fwk_notification_handle *handle;
+#    endif
+
+    light_event = get_light_event(node);
+    if (light_event != NULL) {
+        FWK_LOG_DEBUG(
+            "[FWK] %s light event: %s @ %s -> %s",
+            action,
+            FWK_ID_STR(light_event->event.id),
+            FWK_ID_STR(light_event->event.source_id),
+            FWK_ID_STR(light_event->event.target_id));
+
+        return;
+    }
+
+#    ifdef BUILD_HAS_NOTIFICATION
+    handle = get_notification_handle(node);
+    if (handle != NULL) {
+        FWK_LOG_DEBUG(
+            "[FWK] %s %" PRIu32 ": %s @ %s -> %s",
+            action,
+            handle->cookie,
+            FWK_ID_STR(handle->event->id),
+            FWK_ID_STR(handle->event->source_id),
+            FWK_ID_STR(handle->target_id));
+
+        return;
+    }
+#    endif
+
+    event = FWK_LIST_GET(node, struct fwk_event, slist_node);
+
+    FWK_LOG_DEBUG(
+        "[FWK] %s %" PRIu32 ": %s @ %s -> %s",
+        action,
+        event->cookie,
+        FWK_ID_STR(event->id),
+        FWK_ID_STR(event->source_id),
+        FWK_ID_STR(event->target_id));
+}
+#endif
+
+/*
+ * Put an allocated standard or light event in the ISR event queue or in its
+ * event queue.
+ *
+ * \param node Node of the event.
+ * \param intr_state Whether the caller runs in interrupt context, if known.
+ */
+static void queue_event(
+    struct fwk_slist_node *node,
+    enum interrupt_states intr_state)
+{
+    struct fwk_slist *event_queue;
+    fwk_timestamp_t isr_timestamp;
+#ifdef BUILD_HAS_EVENT_PROFILER
+    struct __fwk_light_event *light_event;
+#    ifdef BUILD_HAS_NOTIFICATION
+    struct __fwk_notification_handle *handle;
+#    endif
+#endif
+
+    if (intr_state == UNKNOWN_STATE) {
+        if (fwk_is_interrupt_context()) {
+            intr_state = INTERRUPT_STATE;
+        } else {
+            intr_state = NOT_INTERRUPT_STATE;
+        }
+    }
+
+    isr_timestamp = __fwk_profiler_event_queued(intr_state == INTERRUPT_STATE);
+#ifdef BUILD_HAS_EVENT_PROFILER
+    light_event = get_light_event(node);
+#    ifdef BUILD_HAS_NOTIFICATION
+    handle = get_notification_handle(node);
+#    endif
+    if (light_event != NULL) {
+        light_event->isr_timestamp = isr_timestamp;
+#    ifdef BUILD_HAS_NOTIFICATION
+    } else if (handle != NULL) {
+        handle->isr_timestamp = isr_timestamp;
+#    endif
+    } else {
+        FWK_LIST_GET(node, struct fwk_event, slist_node)->isr_timestamp =
+            isr_timestamp;
+    }
+#else
+    (void)isr_timestamp;
+#endif
+
+    if (intr_state == NOT_INTERRUPT_STATE) {
+        event_queue = get_node_event_queue(node);
+        fwk_list_push_tail(event_queue, node);
+
+        FWK_TRACE("[FWK] event_queue peak: %d", fwk_list_get_max(event_queue));
+
+    } else {
+        fwk_list_push_tail(&ctx.isr_event_queue, node);
+
+        FWK_TRACE(
+            "[FWK] isr_event_queue peak: %d",
+            fwk_list_get_max(&ctx.isr_event_queue));
+    }
+
+#if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
+    log_event("Sent", node);
+#endif
 }
 
 static int put_event(
@@ -106,12 +586,25 @@ static int put_event(
     enum interrupt_states intr_state,
     enum fwk_event_type event_type)
 {
+    int status;
     struct fwk_event *allocated_event;
+    struct __fwk_light_event *light_event = NULL;
 
     struct fwk_event *std_event = NULL;
 
     if (event_type == FWK_EVENT_TYPE_STD) {
         std_event = (struct fwk_event *)event;
+    } else {
+        light_event = alloc_light_event();
+    }
+
+    if (light_event != NULL) {
+        light_event->event = *((struct fwk_event_light *)event);
+        light_event->slist_node = (struct fwk_slist_node){ 0 };
+
+        queue_event(&light_event->slist_node, intr_state);
+
+        return FWK_SUCCESS;
     }
 
     if (std_event != NULL && std_event->is_delayed_response) {
@@ -122,9 +615,7 @@ static int put_event(
             return FWK_E_PARAM;
         }
 
-        fwk_list_remove(
-            __fwk_get_delayed_response_list(std_event->source_id),
-            &allocated_event->slist_node);
+        __fwk_remove_delayed_response(std_event->source_id, allocated_event);
 
         (void)memcpy(
             allocated_event->params,
@@ -132,112 +623,288 @@ static int put_event(
             sizeof(allocated_event->params));
 
     } else {
-        allocated_event = duplicate_event(event, event_type);
-        if (allocated_event == NULL) {
-            return FWK_E_NOMEM;
+        /* Light events are expanded when the light event pool is exhausted */
+        status = duplicate_event(event, event_type, &allocated_event);
+        if (status != FWK_SUCCESS) {
+            return status;
         }
     }
 
+    allocated_event->cookie = ctx.event_cookie_counter++;
     if (std_event != NULL) {
-        allocated_event->cookie = ctx.event_cookie_counter++;
         std_event->cookie = allocated_event->cookie;
     }
 
-    if (intr_state == UNKNOWN_STATE) {
-        if (fwk_is_interrupt_context()) {
-            intr_state = INTERRUPT_STATE;
-        } else {
-            intr_state = NOT_INTERRUPT_STATE;
-        }
-    }
-    if (intr_state == NOT_INTERRUPT_STATE) {
-        fwk_list_push_tail(&ctx.event_queue, &allocated_event->slist_node);
+    queue_event(&allocated_event->slist_node, intr_state);
 
-        FWK_TRACE(
-            "[FWK] event_queue peak: %d", fwk_list_get_max(&ctx.event_queue));
+    return FWK_SUCCESS;
+}
 
-    } else {
-        fwk_list_push_tail(&ctx.isr_event_queue, &allocated_event->slist_node);
+/*
+ * Give an event back to the event pool.
+ *
+ * \param event Event of the event pool.
+ */
+static void free_pool_event(struct fwk_event *event)
+{
+    struct fwk_module_context *module_ctx;
+    unsigned int flags;
 
-        FWK_TRACE(
-            "[FWK] isr_event_queue peak: %d",
-            fwk_list_get_max(&ctx.isr_event_queue));
+    module_ctx = fwk_module_get_ctx(get_event_charged_id(event));
+
+    flags = fwk_interrupt_global_disable();
+
+    /* Events beyond the quota of the module were taken from the shared ones */
+    if (module_ctx->event_used_count > 0) {
+        if ((module_ctx->event_used_count > module_ctx->config->event_quota) &&
+            (ctx.shared_event_used_count > 0)) {
+            ctx.shared_event_used_count--;
+        }
+        module_ctx->event_used_count--;
     }
 
-#if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
-    FWK_LOG_DEBUG(
-        "[FWK] Sent %" PRIu32 ": %s @ %s -> %s",
-        std_event != NULL ? std_event->cookie : 0,
-        FWK_ID_STR(allocated_event->id),
-        FWK_ID_STR(allocated_event->source_id),
-        FWK_ID_STR(allocated_event->target_id));
-#endif
+    if (ctx.event_used_count > 0) {
+        ctx.event_used_count--;
+    }
 
-    return FWK_SUCCESS;
+    fwk_list_push_tail(&ctx.free_event_queue, &event->slist_node);
+    (void)fwk_interrupt_global_enable(flags);
+}
+
+#ifdef BUILD_HAS_NOTIFICATION
+/*
+ * Get the number of references to a shared notification event.
+ *
+ * \param event Shared notification event, from the event pool.
+ *
+ * \return The pointer to the reference count of the event.
+ */
+static unsigned int *get_event_ref_count(const struct fwk_event *event)
+{
+    return &ctx.event_ref_count_table[event - ctx.event_table];
 }
 
-static void free_event(struct fwk_event *event)
+/*
+ * Drop a reference to a shared notification event, giving the event back to
+ * the event pool once it is no longer referenced.
+ *
+ * \param event Shared notification event.
+ */
+static void release_notification_event(struct fwk_event *event)
 {
     unsigned int flags;
+    unsigned int ref_count;
 
     flags = fwk_interrupt_global_disable();
-    fwk_list_push_tail(&ctx.free_event_queue, &event->slist_node);
+    ref_count = --(*get_event_ref_count(event));
     (void)fwk_interrupt_global_enable(flags);
+
+    if (ref_count == 0) {
+        free_pool_event(event);
+    }
+}
+
+/*
+ * Direct the shared notification event referenced by a handle to the target
+ * of the handle.
+ *
+ * \param handle Notification handle.
+ *
+ * \return The pointer to the shared notification event.
+ */
+static struct fwk_event *bind_notification_handle(
+    const struct __fwk_notification_handle *handle)
+{
+    struct fwk_event *event = handle->event;
+
+    event->target_id = handle->target_id;
+    event->cookie = handle->cookie;
+#    ifdef BUILD_HAS_EVENT_PROFILER
+    event->isr_timestamp = handle->isr_timestamp;
+#    endif
+
+    return event;
+}
+#endif
+
+static void free_event(struct fwk_slist_node *node)
+{
+    unsigned int flags;
+#ifdef BUILD_HAS_NOTIFICATION
+    struct __fwk_notification_handle *handle;
+    struct fwk_event *event;
+#endif
+
+    if (get_light_event(node) != NULL) {
+        flags = fwk_interrupt_global_disable();
+        fwk_list_push_tail(&ctx.free_light_event_queue, node);
+        (void)fwk_interrupt_global_enable(flags);
+
+        return;
+    }
+
+#ifdef BUILD_HAS_NOTIFICATION
+    handle = get_notification_handle(node);
+    if (handle != NULL) {
+        event = handle->event;
+
+        flags = fwk_interrupt_global_disable();
+        fwk_list_push_tail(&ctx.free_notification_handle_queue, node);
+        (void)fwk_interrupt_global_enable(flags);
+
+        release_notification_event(event);
+
+        return;
+    }
+#endif
+
+    free_pool_event(FWK_LIST_GET(node, struct fwk_event, slist_node));
+}
+
+/*
+ * Expand a light event into the standard event given to its handler.
+ *
+ * \details Only the header of the event is written, the parameters of the
+ *      standard event stay zeroed.
+ *
+ * \param light_event Light event to expand.
+ *
+ * \return The pointer to the standard event.
+ */
+static struct fwk_event *expand_light_event(
+    const struct __fwk_light_event *light_event)
+{
+    struct fwk_event *event = &ctx.light_dispatch_event;
+
+    event->source_id = light_event->event.source_id;
+    event->target_id = light_event->event.target_id;
+    event->id = light_event->event.id;
+    event->cookie = ctx.event_cookie_counter++;
+    event->is_response = false;
+    event->response_requested = light_event->event.response_requested;
+    event->is_notification = false;
+    event->is_delayed_response = false;
+#ifdef BUILD_HAS_EVENT_PROFILER
+    event->isr_timestamp = light_event->isr_timestamp;
+#endif
+
+    return event;
+}
+
+/*
+ * Initialize the response to an event.
+ *
+ * \details The response starts with the parameters of the event it responds
+ *      to, or with zeroed parameters when responding to a light event.
+ *
+ * \param event Event to respond to.
+ * \param is_light_event Whether the event was expanded from a light event.
+ * \param[out] response_event The response event.
+ */
+static void init_response_event(
+    const struct fwk_event *event,
+    bool is_light_event,
+    struct fwk_event *response_event)
+{
+    response_event->slist_node = (struct fwk_slist_node){ 0 };
+    response_event->source_id = event->target_id;
+    response_event->target_id = event->source_id;
+    response_event->cookie = event->cookie;
+    response_event->is_response = event->is_response;
+    response_event->response_requested = event->response_requested;
+    response_event->is_notification = event->is_notification;
+    response_event->is_delayed_response = false;
+    response_event->id = event->id;
+
+    if (is_light_event) {
+        fwk_str_memset(
+            response_event->params, 0, sizeof(response_event->params));
+    } else {
+        (void)memcpy(
+            response_event->params,
+            event->params,
+            sizeof(response_event->params));
+    }
 }
 
 static void process_next_event(void)
 {
     int status;
-    struct fwk_event *event, *allocated_event, async_response_event;
+    struct fwk_slist_node *node;
+    struct __fwk_light_event *light_event;
+#ifdef BUILD_HAS_NOTIFICATION
+    struct __fwk_notification_handle *handle;
+#endif
+    struct fwk_event *event, *response_event, async_response_event;
     const struct fwk_module *module;
+    fwk_timestamp_t dispatch_start;
     int (*process_event)(
         const struct fwk_event *event, struct fwk_event *resp_event);
 
-    ctx.current_event = event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx.event_queue), struct fwk_event, slist_node);
+    node = pop_next_event();
 
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
-    FWK_LOG_DEBUG(
-        "[FWK] Processing %" PRIu32 ": %s @ %s -> %s",
-        event->cookie,
-        FWK_ID_STR(event->id),
-        FWK_ID_STR(event->source_id),
-        FWK_ID_STR(event->target_id));
+    log_event("Processing", node);
 #endif
 
+    light_event = get_light_event(node);
+#ifdef BUILD_HAS_NOTIFICATION
+    handle = get_notification_handle(node);
+#endif
+    if (light_event != NULL) {
+        event = expand_light_event(light_event);
+#ifdef BUILD_HAS_NOTIFICATION
+    } else if (handle != NULL) {
+        event = bind_notification_handle(handle);
+#endif
+    } else {
+        event = FWK_LIST_GET(node, struct fwk_event, slist_node);
+    }
+
+    ctx.current_event = event;
+
     module = fwk_module_get_ctx(event->target_id)->desc;
     process_event = event->is_notification ? module->process_notification :
                                              module->process_event;
 
+    dispatch_start = __fwk_profiler_dispatch_start(event);
+
     if (event->response_requested) {
-        fwk_str_memset(&async_response_event, 0, sizeof(async_response_event));
-        async_response_event = *event;
-        async_response_event.source_id = event->target_id;
-        async_response_event.target_id = event->source_id;
-        async_response_event.is_delayed_response = false;
+        /*
+         * The response is built in place in an event of the pool, charged to
+         * the requester.
+         */
+        status = alloc_event(event->source_id, true, &response_event);
+        if (status != FWK_SUCCESS) {
+            /* The response cannot be allocated, it is lost */
+            FWK_LOG_CRIT(err_msg_line, status, __func__, __LINE__);
+            fwk_unexpected();
 
-        status = process_event(event, &async_response_event);
+            response_event = &async_response_event;
+        }
+
+        init_response_event(event, light_event != NULL, response_event);
+
+        status = process_event(event, response_event);
+        __fwk_profiler_dispatch_end(event, dispatch_start);
         if (status != FWK_SUCCESS) {
             FWK_LOG_CRIT(err_msg_line, status, __func__, __LINE__);
         }
 
-        async_response_event.is_response = true;
-        async_response_event.response_requested = false;
-        if (!async_response_event.is_delayed_response) {
-            (void)put_event(
-                &async_response_event, UNKNOWN_STATE, FWK_EVENT_TYPE_STD);
-        } else {
-            allocated_event =
-                duplicate_event(&async_response_event, FWK_EVENT_TYPE_STD);
-            if (allocated_event != NULL) {
-                fwk_list_push_tail(
-                    __fwk_get_delayed_response_list(
-                        async_response_event.source_id),
-                    &allocated_event->slist_node);
+        if (response_event != &async_response_event) {
+            response_event->is_response = true;
+            response_event->response_requested = false;
+            if (!response_event->is_delayed_response) {
+                response_event->cookie = ctx.event_cookie_counter++;
+                queue_event(&response_event->slist_node, UNKNOWN_STATE);
+            } else {
+                __fwk_add_delayed_response(
+                    response_event->source_id, response_event);
             }
         }
     } else {
         status = process_event(event, &async_response_event);
+        __fwk_profiler_dispatch_end(event, dispatch_start);
         if ((status != FWK_SUCCESS) && (status != FWK_PENDING)) {
             FWK_LOG_CRIT(
                 "[FWK] Process event (%s: %s -> %s) (%d)",
@@ -249,35 +916,65 @@ static void process_next_event(void)
     }
 
     ctx.current_event = NULL;
-    free_event(event);
+    free_event(node);
     return;
 }
 
+/*
+ * Move a batch of events out of the ISR event queue.
+ *
+ * Must be called with the interrupts disabled.
+ */
+static void pull_isr_events(struct fwk_slist *isr_events)
+{
+#if FMW_ISR_EVENT_BATCH_MAX == 0
+    fwk_list_splice(isr_events, &ctx.isr_event_queue);
+#else
+    struct fwk_slist_node *node;
+    unsigned int count;
+
+    for (count = 0; count < FMW_ISR_EVENT_BATCH_MAX; count++) {
+        node = fwk_list_pop_head(&ctx.isr_event_queue);
+        if (node == NULL) {
+            break;
+        }
+
+        fwk_list_push_tail(isr_events, node);
+    }
+#endif
+}
+
 static bool process_isr(void)
 {
-    struct fwk_event *isr_event;
-    unsigned int flags;
+    struct fwk_slist_node *node;
+    struct fwk_slist *event_queue;
+    struct fwk_slist isr_events;
+    unsigned int flags, count = 0;
+
+    fwk_list_init(&isr_events);
 
     flags = fwk_interrupt_global_disable();
-    isr_event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx.isr_event_queue), struct fwk_event, slist_node);
+    pull_isr_events(&isr_events);
     (void)fwk_interrupt_global_enable(flags);
 
-    if (isr_event == NULL) {
-        return false;
-    }
-
+    while ((node = fwk_list_pop_head(&isr_events)) != NULL) {
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
-    FWK_LOG_DEBUG(
-        "[FWK] Pulled ISR event (%s: %s -> %s)",
-        FWK_ID_STR(isr_event->id),
-        FWK_ID_STR(isr_event->source_id),
-        FWK_ID_STR(isr_event->target_id));
+        log_event("Pulled ISR event", node);
 #endif
 
-    fwk_list_push_tail(&ctx.event_queue, &isr_event->slist_node);
+        event_queue = get_node_event_queue(node);
+        fwk_list_push_tail(event_queue, node);
 
-    FWK_TRACE("[FWK] event_queue peak: %d", fwk_list_get_max(&ctx.event_queue));
+        FWK_TRACE("[FWK] event_queue peak: %d", fwk_list_get_max(event_queue));
+
+        count++;
+    }
+
+    if (count == 0) {
+        return false;
+    }
+
+    __fwk_profiler_isr_events_pulled(count);
 
     return true;
 }
@@ -288,19 +985,106 @@ static bool process_isr(void)
 
 int __fwk_init(size_t event_count)
 {
+    int status;
     struct fwk_event *event_table, *event;
+    struct __fwk_light_event *light_event;
+#ifdef BUILD_HAS_NOTIFICATION
+    struct __fwk_notification_handle *handle;
+#endif
+    struct fwk_module_context *module_ctx;
+    size_t reserved_event_count = 0;
+
+    /* Carve the event quotas of the modules from the event pool */
+    for (unsigned int i = 0U; i < (unsigned int)FWK_MODULE_IDX_COUNT; i++) {
+        module_ctx = fwk_module_get_ctx(FWK_ID_MODULE(i));
+
+        module_ctx->event_used_count = 0;
+        module_ctx->event_peak_count = 0;
+        module_ctx->event_busy_count = 0;
+
+        reserved_event_count += module_ctx->config->event_quota;
+    }
+
+    if (reserved_event_count > event_count) {
+        FWK_LOG_CRIT(err_msg_func, FWK_E_NOMEM, __func__);
+        return FWK_E_NOMEM;
+    }
+
+    ctx.event_count = (unsigned int)event_count;
+    ctx.shared_event_count = (unsigned int)(event_count - reserved_event_count);
+    ctx.shared_event_used_count = 0;
+    ctx.event_used_count = 0;
+    ctx.event_peak_count = 0;
+    ctx.event_busy_count = 0;
+
+    status = __fwk_delayed_response_init(event_count);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    /* All the light events are free to be used */
+    fwk_list_init(&ctx.free_light_event_queue);
+    ctx.light_event_table = NULL;
+    ctx.light_event_count = FMW_LIGHT_EVENT_COUNT;
+    if (ctx.light_event_count > 0) {
+        ctx.light_event_table = fwk_mm_calloc(
+            ctx.light_event_count, sizeof(struct __fwk_light_event));
+    }
+
+    for (light_event = ctx.light_event_table;
+         light_event < (ctx.light_event_table + ctx.light_event_count);
+         light_event++) {
+        fwk_list_push_tail(
+            &ctx.free_light_event_queue, &light_event->slist_node);
+    }
+
+    fwk_str_memset(
+        &ctx.light_dispatch_event, 0, sizeof(ctx.light_dispatch_event));
+
+#ifdef BUILD_HAS_NOTIFICATION
+    /* All the notification handles are free to be used */
+    fwk_list_init(&ctx.free_notification_handle_queue);
+    ctx.notification_handle_count = FMW_NOTIFICATION_HANDLE_COUNT;
+    ctx.notification_handle_table = fwk_mm_calloc(
+        ctx.notification_handle_count,
+        sizeof(struct __fwk_notification_handle));
+
+    for (unsigned int i = 0U; i < ctx.notification_handle_count; i++) {
+        handle = &ctx.notification_handle_table[i];
+        fwk_list_push_tail(
+            &ctx.free_notification_handle_queue, &handle->slist_node);
+    }
+
+    ctx.event_ref_count_table =
+        fwk_mm_calloc(event_count, sizeof(ctx.event_ref_count_table[0]));
+#endif
 
     event_table = fwk_mm_calloc(event_count, sizeof(struct fwk_event));
+#ifdef BUILD_HAS_NOTIFICATION
+    ctx.event_table = event_table;
+#endif
 
     /* All the event structures are free to be used. */
     fwk_list_init(&ctx.free_event_queue);
+#ifdef BUILD_HAS_EVENT_PRIORITY
+    for (unsigned int rank = 0; rank < FWK_EVENT_PRIORITY_COUNT; rank++) {
+        fwk_list_init(&ctx.event_queue_table[rank]);
+        ctx.event_queue_skip_count[rank] = 0;
+    }
+#else
     fwk_list_init(&ctx.event_queue);
+#endif
     fwk_list_init(&ctx.isr_event_queue);
 
     for (event = event_table; event < (event_table + event_count); event++) {
         fwk_list_push_tail(&ctx.free_event_queue, &event->slist_node);
     }
 
+    status = __fwk_profiler_init();
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
     ctx.initialized = true;
 
     return FWK_SUCCESS;
@@ -309,7 +1093,7 @@ int __fwk_init(size_t event_count)
 void fwk_process_event_queue(void)
 {
     for (;;) {
-        while (!fwk_list_is_empty(&ctx.event_queue)) {
+        while (!is_event_queue_empty()) {
             process_next_event();
         }
 
@@ -347,6 +1131,81 @@ int __fwk_put_notification(struct fwk_event *event)
 
     return put_event(event, UNKNOWN_STATE, FWK_EVENT_TYPE_STD);
 }
+
+void __fwk_put_notification_fanout(
+    struct fwk_event *event,
+    const fwk_id_t *target_table,
+    unsigned int target_count,
+    unsigned int *count)
+{
+    struct __fwk_notification_handle *handle;
+    struct fwk_event *shared_event = NULL;
+    enum interrupt_states intr_state;
+    unsigned int target_idx;
+
+    event->is_response = false;
+    event->is_notification = true;
+
+    if (fwk_is_interrupt_context()) {
+        intr_state = INTERRUPT_STATE;
+    } else {
+        intr_state = NOT_INTERRUPT_STATE;
+    }
+
+    *count = 0;
+
+    if (target_count == 0) {
+        return;
+    }
+
+    if (alloc_event(event->source_id, false, &shared_event) == FWK_SUCCESS) {
+        *shared_event = *event;
+        shared_event->slist_node = (struct fwk_slist_node){ 0 };
+
+        /*
+         * The reference of the caller keeps the shared event alive until all
+         * the handles are queued. The handles are not processed before the
+         * caller returns.
+         */
+        *get_event_ref_count(shared_event) = 1;
+    } else {
+        shared_event = NULL;
+    }
+
+    for (target_idx = 0; target_idx < target_count; target_idx++) {
+        handle = NULL;
+        if (shared_event != NULL) {
+            handle = alloc_notification_handle();
+        }
+
+        if (handle == NULL) {
+            /* Fall back to a copy of the notification for this target */
+            event->target_id = target_table[target_idx];
+            if (put_event(event, intr_state, FWK_EVENT_TYPE_STD) ==
+                FWK_SUCCESS) {
+                (*count)++;
+            }
+
+            continue;
+        }
+
+        (*get_event_ref_count(shared_event))++;
+
+        handle->slist_node = (struct fwk_slist_node){ 0 };
+        handle->target_id = target_table[target_idx];
+        handle->cookie = ctx.event_cookie_counter++;
+        handle->event = shared_event;
+        event->cookie = handle->cookie;
+
+        queue_event(&handle->slist_node, intr_state);
+
+        (*count)++;
+    }
+
+    if (shared_event != NULL) {
+        release_notification_event(shared_event);
+    }
+}
 #endif
 
 /*
@@ -425,6 +1284,48 @@ error:
     return status;
 }
 
+int fwk_get_event_pool_stats(fwk_id_t id, struct fwk_event_pool_stats *stats)
+{
+    struct fwk_module_context *module_ctx;
+    unsigned int flags;
+
+    if (stats == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (!ctx.initialized) {
+        return FWK_E_INIT;
+    }
+
+    flags = fwk_interrupt_global_disable();
+
+    if (fwk_id_is_equal(id, FWK_ID_NONE)) {
+        *stats = (struct fwk_event_pool_stats){
+            .event_count = ctx.event_count,
+            .used_count = ctx.event_used_count,
+            .peak_count = ctx.event_peak_count,
+            .busy_count = ctx.event_busy_count,
+        };
+    } else if (fwk_module_is_valid_module_id(id)) {
+        module_ctx = fwk_module_get_ctx(id);
+
+        *stats = (struct fwk_event_pool_stats){
+            .event_count = module_ctx->config->event_quota,
+            .used_count = module_ctx->event_used_count,
+            .peak_count = module_ctx->event_peak_count,
+            .busy_count = module_ctx->event_busy_count,
+        };
+    } else {
+        (void)fwk_interrupt_global_enable(flags);
+
+        return FWK_E_PARAM;
+    }
+
+    (void)fwk_interrupt_global_enable(flags);
+
+    return FWK_SUCCESS;
+}
+
 int __fwk_put_event_light(struct fwk_event_light *event)
 {
     int status = FWK_E_PARAM;
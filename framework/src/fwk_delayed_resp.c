@@ -8,12 +8,14 @@
 #include <internal/fwk_delayed_resp.h>
 #include <internal/fwk_module.h>
 
+#include <fwk_assert.h>
 #include <fwk_core.h>
 #include <fwk_event.h>
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
 #include <fwk_list.h>
 #include <fwk_log.h>
+#include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_status.h>
 
@@ -25,9 +27,94 @@
 static const char err_msg_func[] = "[FWK] Error %d in %s";
 #endif
 
+/*
+ * Delayed response index.
+ *
+ * Delayed responses are stored in the lists of the entities that delayed them
+ * and indexed by cookie in an open-addressed hash table with linear probing.
+ * Delayed responses are taken from the event pool, hence the table is sized
+ * from the number of events in the pool, which bounds its load factor to 50%.
+ */
+static struct {
+    /* Table of delayed responses indexed by cookie */
+    struct fwk_event **table;
+
+    /* Size of the table, a power of two, minus one */
+    uint32_t mask;
+} delayed_resp_ctx;
+
 /*
  * Static functions
  */
+static uint32_t index_get_slot(uint32_t cookie)
+{
+    /* Cookies are allocated sequentially and so are already well spread */
+    return cookie & delayed_resp_ctx.mask;
+}
+
+static void index_insert(struct fwk_event *event)
+{
+    uint32_t slot = index_get_slot(event->cookie);
+
+    while (delayed_resp_ctx.table[slot] != NULL) {
+        slot = (slot + 1) & delayed_resp_ctx.mask;
+    }
+
+    delayed_resp_ctx.table[slot] = event;
+}
+
+static struct fwk_event **index_search(fwk_id_t id, uint32_t cookie)
+{
+    struct fwk_event *event;
+    uint32_t slot = index_get_slot(cookie);
+
+    for (;;) {
+        event = delayed_resp_ctx.table[slot];
+        if (event == NULL) {
+            return NULL;
+        }
+
+        if ((event->cookie == cookie) &&
+            fwk_id_is_equal(event->source_id, id)) {
+            return &delayed_resp_ctx.table[slot];
+        }
+
+        slot = (slot + 1) & delayed_resp_ctx.mask;
+    }
+}
+
+static void index_remove(struct fwk_event **entry)
+{
+    uint32_t hole, slot, home;
+
+    hole = (uint32_t)(entry - delayed_resp_ctx.table);
+    slot = hole;
+
+    /*
+     * Shift back the entries of the probe sequence that follows the removed
+     * entry, so that no tombstone is needed.
+     */
+    for (;;) {
+        slot = (slot + 1) & delayed_resp_ctx.mask;
+        if (delayed_resp_ctx.table[slot] == NULL) {
+            break;
+        }
+
+        home = index_get_slot(delayed_resp_ctx.table[slot]->cookie);
+
+        /* Keep the entry in place if its home is cyclically in ]hole, slot] */
+        if (((slot - home) & delayed_resp_ctx.mask) <
+            ((slot - hole) & delayed_resp_ctx.mask)) {
+            continue;
+        }
+
+        delayed_resp_ctx.table[hole] = delayed_resp_ctx.table[slot];
+        hole = slot;
+    }
+
+    delayed_resp_ctx.table[hole] = NULL;
+}
+
 static int check_api_call(fwk_id_t id, void *data)
 {
     if (fwk_is_interrupt_context()) {
@@ -53,28 +140,47 @@ struct fwk_slist *__fwk_get_delayed_response_list(fwk_id_t id)
     return &fwk_module_get_element_ctx(id)->delayed_response_list;
 }
 
-struct fwk_event *__fwk_search_delayed_response(fwk_id_t id, uint32_t cookie)
+int __fwk_delayed_response_init(size_t event_count)
 {
-    struct fwk_slist *delayed_response_list;
-    struct fwk_slist_node *delayed_response_node;
+    uint32_t size = 1;
 
-    delayed_response_list = __fwk_get_delayed_response_list(id);
-    delayed_response_node = fwk_list_head(delayed_response_list);
+    while (size < (2 * event_count)) {
+        size <<= 1;
+    }
 
-    while (delayed_response_node != NULL) {
-        struct fwk_event *delayed_response;
+    delayed_resp_ctx.table =
+        fwk_mm_calloc(size, sizeof(delayed_resp_ctx.table[0]));
+    delayed_resp_ctx.mask = size - 1;
 
-        delayed_response =
-            FWK_LIST_GET(delayed_response_node, struct fwk_event, slist_node);
-        if (delayed_response->cookie == cookie) {
-            return delayed_response;
-        }
+    return FWK_SUCCESS;
+}
 
-        delayed_response_node =
-            fwk_list_next(delayed_response_list, delayed_response_node);
-    }
+void __fwk_add_delayed_response(fwk_id_t id, struct fwk_event *event)
+{
+    fwk_list_push_tail(__fwk_get_delayed_response_list(id), &event->slist_node);
+
+    index_insert(event);
+}
+
+void __fwk_remove_delayed_response(fwk_id_t id, struct fwk_event *event)
+{
+    struct fwk_event **entry;
+
+    entry = index_search(id, event->cookie);
+    fwk_assert(entry != NULL);
+
+    index_remove(entry);
+
+    fwk_list_remove(__fwk_get_delayed_response_list(id), &event->slist_node);
+}
+
+struct fwk_event *__fwk_search_delayed_response(fwk_id_t id, uint32_t cookie)
+{
+    struct fwk_event **entry;
+
+    entry = index_search(id, cookie);
 
-    return NULL;
+    return (entry == NULL) ? NULL : *entry;
 }
 
 /*
@@ -128,14 +128,6 @@ struct __fwk_id_fmt __fwk_id_str(fwk_id_t id)
     return fmt;
 }
 
-bool fwk_id_is_type(fwk_id_t id, enum fwk_id_type type)
-{
-    fwk_assert(id.common.type != __FWK_ID_TYPE_INVALID);
-    fwk_assert(id.common.type < __FWK_ID_TYPE_COUNT);
-
-    return id.common.type == type;
-}
-
 bool fwk_id_type_is_valid(fwk_id_t id)
 {
     if ((id.common.type != __FWK_ID_TYPE_INVALID) &&
@@ -146,6 +138,25 @@ bool fwk_id_type_is_valid(fwk_id_t id)
     return false;
 }
 
+bool fwk_optional_id_is_defined(fwk_optional_id_t id)
+{
+    fwk_assert(id.common.type < __FWK_ID_TYPE_COUNT);
+    return id.common.type != __FWK_ID_TYPE_INVALID;
+}
+
+/*
+ * Following functions are enabled only for debug build, release build
+ * will use inline equivalents, see fwk_id.h
+ */
+#if !defined(NDEBUG)
+bool fwk_id_is_type(fwk_id_t id, enum fwk_id_type type)
+{
+    fwk_assert(id.common.type != __FWK_ID_TYPE_INVALID);
+    fwk_assert(id.common.type < __FWK_ID_TYPE_COUNT);
+
+    return id.common.type == type;
+}
+
 enum fwk_id_type fwk_id_get_type(fwk_id_t id)
 {
     fwk_assert(id.common.type != __FWK_ID_TYPE_INVALID);
@@ -162,12 +173,6 @@ bool fwk_id_is_equal(fwk_id_t left, fwk_id_t right)
     return left.value == right.value;
 }
 
-bool fwk_optional_id_is_defined(fwk_optional_id_t id)
-{
-    fwk_assert(id.common.type < __FWK_ID_TYPE_COUNT);
-    return id.common.type != __FWK_ID_TYPE_INVALID;
-}
-
 fwk_id_t fwk_id_build_module_id(fwk_id_t id)
 {
     fwk_assert(id.common.type != __FWK_ID_TYPE_INVALID);
@@ -200,11 +205,6 @@ fwk_id_t fwk_id_build_api_id(fwk_id_t id, unsigned int api_idx)
     return FWK_ID_API(id.common.module_idx, api_idx);
 }
 
-/*
- * Following functions are enabled only for debug build, release build
- * will use inline equivalents, see fwk_id.h
- */
-#if !defined(NDEBUG)
 unsigned int fwk_id_get_module_idx(fwk_id_t id)
 {
     fwk_assert(id.common.type != __FWK_ID_TYPE_INVALID);
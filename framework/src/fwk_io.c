@@ -28,6 +28,17 @@ static int fwk_io_null_putch(const struct fwk_io_stream *stream, char ch)
     return FWK_SUCCESS;
 }
 
+static int fwk_io_null_write(
+    const struct fwk_io_stream *stream,
+    const char *buffer,
+    size_t size,
+    size_t *written)
+{
+    *written = size;
+
+    return FWK_SUCCESS;
+}
+
 static int fwk_io_null_close(const struct fwk_io_stream *stream)
 {
     return FWK_SUCCESS;
@@ -39,6 +50,7 @@ static struct fwk_io_stream fwk_io_null = {
             .open = fwk_io_null_open,
             .getch = fwk_io_null_getch,
             .putch = fwk_io_null_putch,
+            .write = fwk_io_null_write,
             .close = fwk_io_null_close,
         },
 
@@ -258,6 +270,64 @@ int fwk_io_putch_nowait(const struct fwk_io_stream *stream, char ch)
     return status;
 }
 
+int fwk_io_write_nowait(
+    const struct fwk_io_stream *restrict stream,
+    size_t *restrict written,
+    const char *restrict buffer,
+    size_t size)
+{
+    int status = FWK_SUCCESS;
+
+    if (written == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    *written = 0;
+
+    if ((stream == NULL) || (buffer == NULL)) {
+        return FWK_E_PARAM;
+    }
+
+    if (stream->adapter == NULL) {
+        return FWK_E_STATE; /* The stream is not open */
+    }
+
+    if ((((unsigned int)stream->mode) & ((unsigned int)FWK_IO_MODE_WRITE)) ==
+        0U) {
+        return FWK_E_SUPPORT; /* Stream not open for write operations */
+    }
+
+    if (stream->adapter->putch == NULL) {
+        return FWK_E_SUPPORT; /* No write interface */
+    }
+
+    if (size == 0) {
+        return FWK_SUCCESS;
+    }
+
+    if (stream->adapter->write != NULL) {
+        status = stream->adapter->write(stream, buffer, size, written);
+    } else {
+        /* Write the characters one at a time until the adapter is busy */
+        while ((*written < size) && (status == FWK_SUCCESS)) {
+            status = stream->adapter->putch(stream, buffer[*written]);
+            if (status == FWK_SUCCESS) {
+                *written += 1;
+            }
+        }
+
+        if ((status == FWK_E_BUSY) && (*written > 0)) {
+            status = FWK_SUCCESS;
+        }
+    }
+
+    if ((status != FWK_SUCCESS) && (status != FWK_E_BUSY)) {
+        return FWK_E_HANDLER;
+    }
+
+    return status;
+}
+
 int fwk_io_read(
     const struct fwk_io_stream *restrict stream,
     size_t *restrict read,
@@ -269,22 +339,61 @@ int fwk_io_read(
 
     char *cbuffer = buffer;
 
+    size_t length = size * count;
+    size_t offset = 0;
+    size_t fetched;
+
     if (read != NULL) {
         *read = 0;
     }
 
-    for (size_t i = 0; (i < count) && (status == FWK_SUCCESS); i++) {
-        for (size_t j = 0; (j < size) && (status == FWK_SUCCESS); j++) {
-            status = fwk_io_getch(stream, cbuffer++);
-        }
+    if (length == 0) {
+        return FWK_SUCCESS;
+    }
+
+    if ((stream == NULL) || (cbuffer == NULL)) {
+        return FWK_E_PARAM;
+    }
 
-        if ((status == FWK_SUCCESS) && (read != NULL)) {
-            *read += 1;
+    if (stream->adapter == NULL) {
+        return FWK_E_STATE; /* The stream is not open */
+    }
+
+    if ((((unsigned int)stream->mode) & ((unsigned int)FWK_IO_MODE_READ)) ==
+        0U) {
+        return FWK_E_SUPPORT; /* Stream not open for read operations */
+    }
+
+    if (stream->adapter->getch == NULL) {
+        return FWK_E_SUPPORT; /* No read interface */
+    }
+
+    while ((offset < length) && (status == FWK_SUCCESS)) {
+        fetched = 0;
+
+        if (stream->adapter->read != NULL) {
+            status = stream->adapter->read(
+                stream, &cbuffer[offset], length - offset, &fetched);
+        } else {
+            status = stream->adapter->getch(stream, &cbuffer[offset]);
+            if (status == FWK_SUCCESS) {
+                fetched = 1;
+            }
         }
+
+        offset += fetched;
+    }
+
+    if (read != NULL) {
+        *read = offset / size;
     }
 
-    if ((status == FWK_PENDING) && (read == NULL)) {
-        return FWK_E_DATA; /* Reached end-of-stream */
+    if (status == FWK_PENDING) {
+        if (read == NULL) {
+            return FWK_E_DATA; /* Reached end-of-stream */
+        }
+    } else if (status != FWK_SUCCESS) {
+        return FWK_E_HANDLER;
     }
 
     return status;
@@ -301,22 +410,29 @@ int fwk_io_write(
 
     const char *cbuffer = buffer;
 
+    size_t length = size * count;
+    size_t offset = 0;
+    size_t accepted;
+
     if (cbuffer == NULL) {
         return FWK_E_PARAM;
     }
 
     if (written != NULL) {
-        *written = 0;
+        *written = (length == 0) ? count : 0;
     }
 
-    for (size_t i = 0; (i < count) && (status == FWK_SUCCESS); i++) {
-        for (size_t j = 0; (j < size) && (status == FWK_SUCCESS); j++) {
-            status = fwk_io_putch(stream, *cbuffer++);
-        }
+    while ((offset < length) &&
+           ((status == FWK_SUCCESS) || (status == FWK_E_BUSY))) {
+        /* Wait for the adapter to accept new characters */
+        status = fwk_io_write_nowait(
+            stream, &accepted, &cbuffer[offset], length - offset);
 
-        if ((status == FWK_SUCCESS) && (written != NULL)) {
-            *written += 1;
-        }
+        offset += accepted;
+    }
+
+    if ((written != NULL) && (length > 0)) {
+        *written = offset / size;
     }
 
     return status;
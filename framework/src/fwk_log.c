@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <internal/fwk_log.h>
+
 #include <fwk_assert.h>
 #include <fwk_attributes.h>
 #include <fwk_interrupt.h>
@@ -24,13 +26,40 @@
 
 static const char FWK_LOG_TERMINATOR[] = FMW_LOG_ENDLINE_STR;
 
+/* Maximum number of characters copied out of the log buffer at once */
+#define FWK_LOG_SPAN_SIZE 32U
+
+#if defined(FWK_LOG_BUFFERED) && defined(BUILD_HAS_LOG_BINARY)
+/*
+ * Messages are buffered as binary records, and only formatted when they are
+ * written to the log drain.
+ */
+#    define FWK_LOG_BINARY
+
+#    ifdef BUILD_HAS_LOG_BINARY_RAW
+/* Records are written undecoded, preceded by a magic byte and their size */
+#        define FWK_LOG_OUTPUT_SIZE (2 + UCHAR_MAX)
+#    else
+#        define FWK_LOG_OUTPUT_SIZE \
+            (FMW_LOG_COLUMNS + sizeof(FWK_LOG_TERMINATOR))
+#    endif
+#endif
+
 static struct {
     unsigned int dropped; /* Count of messages lost */
 
 #ifdef FWK_LOG_BUFFERED
     struct fwk_ring ring; /* Buffer for formatted messages */
 
+#    ifdef FWK_LOG_BINARY
+    char output[FWK_LOG_OUTPUT_SIZE]; /* Message being written to the drain */
+
+    size_t output_length; /* Length of the message being written */
+
+    size_t output_offset; /* Characters of the message already written */
+#    else
     unsigned char remaining; /* Remaining characters in the current message */
+#    endif
 #endif
 } fwk_log_ctx = { 0 };
 
@@ -63,15 +92,21 @@ int fwk_log_init(void)
     return status;
 }
 
-#ifdef FWK_LOG_BUFFERED
-static bool fwk_log_buffer(struct fwk_ring *ring, const char *message)
+static fwk_duration_ns_t fwk_log_now(void)
 {
-    unsigned char length = strlen(message) + 1; /* +1 for null terminator */
+    return fwk_time_stamp_duration(fwk_time_current());
+}
 
+#ifdef FWK_LOG_BUFFERED
+static bool fwk_log_buffer(
+    struct fwk_ring *ring,
+    const char *message,
+    unsigned char length)
+{
     /*
      * Log messages are stored in the ring buffer prefixed with their length
-     * (including the null terminator). Care must be taken to ensure the length
-     * of each message does not exceed `UCHAR_MAX`.
+     * (including the null terminator of text messages). Care must be taken to
+     * ensure the length of each message does not exceed `UCHAR_MAX`.
      */
 
     if ((sizeof(length) + length) > fwk_ring_get_free(ring)) {
@@ -88,12 +123,10 @@ static bool fwk_log_buffer(struct fwk_ring *ring, const char *message)
 static void fwk_log_vsnprintf(
     size_t buffer_size,
     char buffer[buffer_size],
+    fwk_duration_ns_t duration,
     const char *format,
     va_list *args)
 {
-    fwk_timestamp_t timestamp = 0;
-    fwk_duration_ns_t duration = 0;
-
     uint32_t duration_s = 0;
     uint32_t duration_us = 0;
 
@@ -103,13 +136,8 @@ static void fwk_log_vsnprintf(
 
     /*
      * We start by generating a timestamp for the message using the number of
-     * nanoseconds since boot.
-     */
-
-    timestamp = fwk_time_current();
-    duration = fwk_time_stamp_duration(timestamp);
-
-    /*
+     * nanoseconds since boot, provided by the caller.
+     *
      * Newlib support for printing 64-bit integers with `printf()` is
      * optional and actually disabled by default in GNU Arm Embedded. To
      * print the timestamp values under this configuration we need to
@@ -151,13 +179,14 @@ static void fwk_log_vsnprintf(
 static void fwk_log_snprintf(
     size_t buffer_size,
     char buffer[buffer_size],
+    fwk_duration_ns_t duration,
     const char *format,
     ...)
 {
     va_list args;
 
     va_start(args, format);
-    fwk_log_vsnprintf(buffer_size, buffer, format, &args);
+    fwk_log_vsnprintf(buffer_size, buffer, duration, format, &args);
     va_end(args);
 }
 
@@ -182,7 +211,8 @@ static bool fwk_log_banner(void)
                              "" };
 #endif
     for (unsigned int i = 0; i < FWK_ARRAY_SIZE(banner); i++) {
-        fwk_log_snprintf(sizeof(buffer), buffer, "%s", banner[i]);
+        fwk_log_snprintf(
+            sizeof(buffer), buffer, fwk_log_now(), "%s", banner[i]);
         if (fwk_io_puts(fwk_log_stream, buffer) != FWK_SUCCESS) {
             return false;
         }
@@ -191,12 +221,46 @@ static bool fwk_log_banner(void)
     return true;
 }
 
+#ifdef FWK_LOG_BINARY
+static bool fwk_log_buffer_record(
+    struct fwk_ring *ring,
+    const char *format,
+    va_list *args)
+{
+    char record[UCHAR_MAX];
+    char message[FMW_LOG_COLUMNS];
+    fwk_duration_ns_t timestamp = fwk_log_now();
+    size_t length;
+    va_list args_copy;
+
+    va_copy(args_copy, *args);
+    length = __fwk_log_encode(
+        sizeof(record), record, timestamp, format, &args_copy);
+    va_end(args_copy);
+
+    if (length == 0) {
+        /*
+         * The message uses a conversion that cannot be deferred, or has too
+         * many arguments to fit in a record, so we format it right away.
+         */
+
+        (void)vsnprintf(message, sizeof(message), format, *args);
+        length = __fwk_log_encode_text(
+            sizeof(record), record, timestamp, message);
+    }
+
+    return fwk_log_buffer(ring, record, (unsigned char)length);
+}
+#endif
+
 void fwk_log_printf(const char *format, ...)
 {
     unsigned int flags;
     static bool banner = false;
 
+#ifndef FWK_LOG_BINARY
     char buffer[FMW_LOG_COLUMNS + sizeof(FWK_LOG_TERMINATOR)];
+#endif
 
     va_list args;
 
@@ -213,17 +277,32 @@ void fwk_log_printf(const char *format, ...)
         banner = fwk_log_banner();
     }
 
+#ifdef FWK_LOG_BINARY
+    /*
+     * Buffer the format string and the raw arguments of the message, so that
+     * even the formatting is left to the scheduler (typically once we're in an
+     * idle state), or to the host if the records are written undecoded.
+     */
+
     va_start(args, format);
-    fwk_log_vsnprintf(sizeof(buffer), buffer, format, &args);
+    bool dropped = !fwk_log_buffer_record(&fwk_log_ctx.ring, format, &args);
     va_end(args);
+#else
+    va_start(args, format);
+    fwk_log_vsnprintf(sizeof(buffer), buffer, fwk_log_now(), format, &args);
+    va_end(args);
+#endif
 
 #ifdef FWK_LOG_BUFFERED
+#    ifndef FWK_LOG_BINARY
     /*
      * Buffer the message that we've received so that the scheduler can choose
      * when we do the heavy-lifting (typically once we're in an idle state).
      */
 
-    bool dropped = !fwk_log_buffer(&fwk_log_ctx.ring, buffer);
+    bool dropped =
+        !fwk_log_buffer(&fwk_log_ctx.ring, buffer, strlen(buffer) + 1);
+#    endif
     if (dropped) {
         /*
          * If we don't have enough room left in the buffer, then we're out of
@@ -244,27 +323,123 @@ void fwk_log_printf(const char *format, ...)
     (void)fwk_interrupt_global_enable(flags);
 }
 
+#if defined(FWK_LOG_BUFFERED) && defined(FWK_LOG_BINARY)
+static bool fwk_log_is_pending(void)
+{
+    return (fwk_log_ctx.output_offset < fwk_log_ctx.output_length);
+}
+
+/*
+ * Fetch the next record from the buffer and prepare it for the log drain,
+ * either by formatting it or by framing it so that it can be decoded by the
+ * host.
+ */
+static bool fwk_log_fetch(void)
+{
+    unsigned char size;
+    size_t fetched;
+
+#    ifndef BUILD_HAS_LOG_BINARY_RAW
+    char record[UCHAR_MAX];
+    char message[FMW_LOG_COLUMNS];
+    fwk_duration_ns_t timestamp;
+#    endif
+
+    if (fwk_ring_pop(&fwk_log_ctx.ring, (char *)&size, sizeof(size)) == 0) {
+        return false;
+    }
+
+#    ifdef BUILD_HAS_LOG_BINARY_RAW
+    fwk_log_ctx.output[0] = FWK_LOG_RECORD_MAGIC;
+    fwk_log_ctx.output[1] = (char)size;
+
+    fetched = fwk_ring_pop(&fwk_log_ctx.ring, &fwk_log_ctx.output[2], size);
+    fwk_assert(fetched == size);
+
+    fwk_log_ctx.output_length = (size_t)size + 2;
+#    else
+    fetched = fwk_ring_pop(&fwk_log_ctx.ring, record, size);
+    fwk_assert(fetched == size);
+
+    (void)__fwk_log_decode(size, record, &timestamp, sizeof(message), message);
+
+    fwk_log_snprintf(
+        sizeof(fwk_log_ctx.output),
+        fwk_log_ctx.output,
+        timestamp,
+        "%s",
+        message);
+
+    fwk_log_ctx.output_length = strlen(fwk_log_ctx.output);
+#    endif
+
+    fwk_log_ctx.output_offset = 0;
+
+    return true;
+}
+
+static const char *fwk_log_peek(char buffer[FWK_LOG_SPAN_SIZE], size_t *size)
+{
+    *size = fwk_log_ctx.output_length - fwk_log_ctx.output_offset;
+
+    return &fwk_log_ctx.output[fwk_log_ctx.output_offset];
+}
+
+static void fwk_log_consume(size_t size)
+{
+    fwk_log_ctx.output_offset += size;
+}
+#elif defined(FWK_LOG_BUFFERED)
+static bool fwk_log_is_pending(void)
+{
+    return (fwk_log_ctx.remaining > 0);
+}
+
+static bool fwk_log_fetch(void)
+{
+    return fwk_ring_pop(
+               &fwk_log_ctx.ring,
+               (char *)&fwk_log_ctx.remaining,
+               sizeof(fwk_log_ctx.remaining)) != 0;
+}
+
+static const char *fwk_log_peek(char buffer[FWK_LOG_SPAN_SIZE], size_t *size)
+{
+    *size = fwk_ring_peek(
+        &fwk_log_ctx.ring,
+        buffer,
+        FWK_MIN((size_t)fwk_log_ctx.remaining, FWK_LOG_SPAN_SIZE));
+
+    return buffer;
+}
+
+static void fwk_log_consume(size_t size)
+{
+    fwk_ring_pop(&fwk_log_ctx.ring, NULL, size);
+    fwk_log_ctx.remaining -= (unsigned char)size;
+}
+#endif
+
 int fwk_log_unbuffer(void)
 {
     int status = FWK_SUCCESS;
 
 #ifdef FWK_LOG_BUFFERED
     unsigned int flags;
-    unsigned char fetched;
-    char ch;
+    char buffer[FWK_LOG_SPAN_SIZE];
+    const char *span;
+    size_t size;
+    size_t written;
 
     flags = fwk_interrupt_global_disable();
 
-    if (fwk_log_ctx.remaining == 0) {
+    if (!fwk_log_is_pending()) {
         /*
          * We've finished printing whatever message we were previously on, so we
          * need to try and fetch the next one.
          */
 
-        bool empty = !fwk_ring_pop(
-            &fwk_log_ctx.ring,
-            (char *)&fwk_log_ctx.remaining,
-            sizeof(fwk_log_ctx.remaining));
+        bool empty = !fwk_log_fetch();
 
         if (empty) {
             /*
@@ -287,28 +462,27 @@ int fwk_log_unbuffer(void)
     }
 
     /*
-     * Grab the next character from the ring buffer and try to print it.
-     * Printing the character successfully will result in a pending return value
-     * even if it is the last character in the message - the next call to this
-     * function will run the logic above to finalize the message.
+     * Grab the next characters of the message and try to print as many of them
+     * as the log drain accepts. Printing characters successfully will result in
+     * a pending return value even if they are the last characters in the
+     * message - the next call to this function will run the logic above to
+     * finalize the message.
      */
 
-    fetched = fwk_ring_peek(&fwk_log_ctx.ring, &ch, sizeof(ch));
-    fwk_assert(fetched == sizeof(char));
+    span = fwk_log_peek(buffer, &size);
 
-    status = fwk_io_putch_nowait(fwk_log_stream, ch);
+    status = fwk_io_write_nowait(fwk_log_stream, &written, span, size);
     switch (status) {
     case FWK_SUCCESS:
         /*
-         * If the character was successfully printed, then we remove it from
-         * the buffer.
+         * If the characters were successfully printed, then we remove them
+         * from the buffer.
          */
-        fwk_ring_pop(&fwk_log_ctx.ring, &ch, sizeof(ch));
-        fwk_log_ctx.remaining--;
+        fwk_log_consume(written);
         status = FWK_PENDING;
         break;
     case FWK_E_BUSY:
-        /* If the resource is busy, we keep the character in the buffer. */
+        /* If the resource is busy, we keep the characters in the buffer. */
         status = FWK_PENDING;
         break;
     default:
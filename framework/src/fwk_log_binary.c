@@ -0,0 +1,622 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Binary log records.
+ */
+
+#include <internal/fwk_log.h>
+
+#include <fwk_assert.h>
+#include <fwk_macros.h>
+#include <fwk_time.h>
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Maximum length of a conversion specification, including its terminator */
+#define FWK_LOG_SPEC_SIZE 16
+
+/* Maximum number of asterisks in a conversion specification */
+#define FWK_LOG_SPEC_STAR_MAX 2
+
+enum fwk_log_arg {
+    FWK_LOG_ARG_NONE,
+    FWK_LOG_ARG_INT,
+    FWK_LOG_ARG_LONG,
+    FWK_LOG_ARG_LLONG,
+    FWK_LOG_ARG_INTMAX,
+    FWK_LOG_ARG_SIZE,
+    FWK_LOG_ARG_PTRDIFF,
+    FWK_LOG_ARG_POINTER,
+    FWK_LOG_ARG_DOUBLE,
+    FWK_LOG_ARG_STRING,
+    FWK_LOG_ARG_INVALID,
+};
+
+enum fwk_log_length {
+    FWK_LOG_LENGTH_NONE,
+    FWK_LOG_LENGTH_HH,
+    FWK_LOG_LENGTH_H,
+    FWK_LOG_LENGTH_L,
+    FWK_LOG_LENGTH_LL,
+    FWK_LOG_LENGTH_J,
+    FWK_LOG_LENGTH_Z,
+    FWK_LOG_LENGTH_T,
+    FWK_LOG_LENGTH_LONG_DOUBLE,
+};
+
+/*
+ * Conversion specification of a format string.
+ */
+struct fwk_log_spec {
+    /* Start of the specification, on its percent sign */
+    const char *start;
+
+    /* Length of the specification */
+    size_t length;
+
+    /* Type of the argument converted by the specification */
+    enum fwk_log_arg arg;
+
+    /* Number of asterisks, each of them taking an argument of type int */
+    unsigned int star_count;
+};
+
+union fwk_log_value {
+    int i;
+    long l;
+    long long ll;
+    intmax_t j;
+    size_t z;
+    ptrdiff_t t;
+    const void *p;
+    double d;
+};
+
+/* Size of each type of argument in a record, strings excepted */
+static const size_t fwk_log_arg_size[] = {
+    [FWK_LOG_ARG_INT] = sizeof(int),
+    [FWK_LOG_ARG_LONG] = sizeof(long),
+    [FWK_LOG_ARG_LLONG] = sizeof(long long),
+    [FWK_LOG_ARG_INTMAX] = sizeof(intmax_t),
+    [FWK_LOG_ARG_SIZE] = sizeof(size_t),
+    [FWK_LOG_ARG_PTRDIFF] = sizeof(ptrdiff_t),
+    [FWK_LOG_ARG_POINTER] = sizeof(void *),
+    [FWK_LOG_ARG_DOUBLE] = sizeof(double),
+};
+
+static const char fwk_log_text_format[] = "%s";
+
+struct fwk_log_writer {
+    char *record;
+    size_t size;
+    size_t length;
+};
+
+struct fwk_log_reader {
+    const char *record;
+    size_t size;
+    size_t offset;
+};
+
+/* Length of a string, bounded to avoid relying on strnlen() */
+static size_t get_string_length(const char *string, size_t max)
+{
+    size_t length = 0;
+
+    while ((length < max) && (string[length] != '\0')) {
+        length++;
+    }
+
+    return length;
+}
+
+static bool is_digit(char c)
+{
+    return (c >= '0') && (c <= '9');
+}
+
+static const char *parse_width(const char *c, struct fwk_log_spec *spec)
+{
+    if (*c == '*') {
+        spec->star_count++;
+
+        return c + 1;
+    }
+
+    while (is_digit(*c)) {
+        c++;
+    }
+
+    return c;
+}
+
+static const char *parse_length(const char *c, enum fwk_log_length *length)
+{
+    switch (*c) {
+    case 'h':
+        if (c[1] == 'h') {
+            *length = FWK_LOG_LENGTH_HH;
+            return c + 2;
+        }
+        *length = FWK_LOG_LENGTH_H;
+        break;
+
+    case 'l':
+        if (c[1] == 'l') {
+            *length = FWK_LOG_LENGTH_LL;
+            return c + 2;
+        }
+        *length = FWK_LOG_LENGTH_L;
+        break;
+
+    case 'j':
+        *length = FWK_LOG_LENGTH_J;
+        break;
+
+    case 'z':
+        *length = FWK_LOG_LENGTH_Z;
+        break;
+
+    case 't':
+        *length = FWK_LOG_LENGTH_T;
+        break;
+
+    case 'L':
+        *length = FWK_LOG_LENGTH_LONG_DOUBLE;
+        break;
+
+    default:
+        *length = FWK_LOG_LENGTH_NONE;
+        return c;
+    }
+
+    return c + 1;
+}
+
+static enum fwk_log_arg get_integer_arg(enum fwk_log_length length)
+{
+    switch (length) {
+    case FWK_LOG_LENGTH_NONE:
+    case FWK_LOG_LENGTH_HH:
+    case FWK_LOG_LENGTH_H:
+        return FWK_LOG_ARG_INT;
+
+    case FWK_LOG_LENGTH_L:
+        return FWK_LOG_ARG_LONG;
+
+    case FWK_LOG_LENGTH_LL:
+        return FWK_LOG_ARG_LLONG;
+
+    case FWK_LOG_LENGTH_J:
+        return FWK_LOG_ARG_INTMAX;
+
+    case FWK_LOG_LENGTH_Z:
+        return FWK_LOG_ARG_SIZE;
+
+    case FWK_LOG_LENGTH_T:
+        return FWK_LOG_ARG_PTRDIFF;
+
+    default:
+        return FWK_LOG_ARG_INVALID;
+    }
+}
+
+/*
+ * Parse the conversion specification starting at the percent sign pointed to
+ * by format, and return the first character that follows it.
+ */
+static const char *parse_spec(const char *format, struct fwk_log_spec *spec)
+{
+    enum fwk_log_length length;
+    const char *c = format + 1;
+    char conversion;
+
+    *spec = (struct fwk_log_spec){ .start = format };
+
+    while ((*c != '\0') && (strchr("-+ #0", *c) != NULL)) {
+        c++;
+    }
+
+    c = parse_width(c, spec);
+    if (*c == '.') {
+        c = parse_width(c + 1, spec);
+    }
+
+    c = parse_length(c, &length);
+
+    conversion = *c;
+    if (conversion != '\0') {
+        c++;
+    }
+
+    switch (conversion) {
+    case '%':
+        spec->arg = FWK_LOG_ARG_NONE;
+        break;
+
+    case 'c':
+        spec->arg = (length == FWK_LOG_LENGTH_NONE) ? FWK_LOG_ARG_INT :
+                                                      FWK_LOG_ARG_INVALID;
+        break;
+
+    case 'd':
+    case 'i':
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+        spec->arg = get_integer_arg(length);
+        break;
+
+    case 'p':
+        spec->arg = (length == FWK_LOG_LENGTH_NONE) ? FWK_LOG_ARG_POINTER :
+                                                      FWK_LOG_ARG_INVALID;
+        break;
+
+    case 's':
+        spec->arg = (length == FWK_LOG_LENGTH_NONE) ? FWK_LOG_ARG_STRING :
+                                                      FWK_LOG_ARG_INVALID;
+        break;
+
+    case 'a':
+    case 'A':
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+        spec->arg = ((length == FWK_LOG_LENGTH_NONE) ||
+                     (length == FWK_LOG_LENGTH_L)) ?
+            FWK_LOG_ARG_DOUBLE :
+            FWK_LOG_ARG_INVALID;
+        break;
+
+    default:
+        /* Includes `%n`, which must never be deferred */
+        spec->arg = FWK_LOG_ARG_INVALID;
+        break;
+    }
+
+    spec->length = (size_t)(c - format);
+
+    return c;
+}
+
+static bool put(struct fwk_log_writer *writer, const void *data, size_t size)
+{
+    if (size > (writer->size - writer->length)) {
+        return false;
+    }
+
+    (void)memcpy(&writer->record[writer->length], data, size);
+    writer->length += size;
+
+    return true;
+}
+
+static bool put_string(struct fwk_log_writer *writer, const char *string)
+{
+    size_t space = writer->size - writer->length;
+    size_t length;
+
+    if (space == 0) {
+        return false;
+    }
+
+    if (string == NULL) {
+        string = "(null)";
+    }
+
+    /* Truncate the string rather than failing to encode the message */
+    length = get_string_length(string, space - 1);
+
+    (void)put(writer, string, length);
+
+    return put(writer, "", 1);
+}
+
+static bool get(struct fwk_log_reader *reader, void *data, size_t size)
+{
+    if (size > (reader->size - reader->offset)) {
+        return false;
+    }
+
+    (void)memcpy(data, &reader->record[reader->offset], size);
+    reader->offset += size;
+
+    return true;
+}
+
+static const char *get_string(struct fwk_log_reader *reader)
+{
+    const char *string = &reader->record[reader->offset];
+    size_t length = get_string_length(string, reader->size - reader->offset);
+
+    if (length == (reader->size - reader->offset)) {
+        return NULL; /* Missing terminator */
+    }
+
+    reader->offset += length + 1;
+
+    return string;
+}
+
+static bool encode_arg(
+    struct fwk_log_writer *writer,
+    enum fwk_log_arg arg,
+    va_list *args)
+{
+    union fwk_log_value value;
+
+    switch (arg) {
+    case FWK_LOG_ARG_NONE:
+        return true;
+
+    case FWK_LOG_ARG_INT:
+        value.i = va_arg(*args, int);
+        break;
+
+    case FWK_LOG_ARG_LONG:
+        value.l = va_arg(*args, long);
+        break;
+
+    case FWK_LOG_ARG_LLONG:
+        value.ll = va_arg(*args, long long);
+        break;
+
+    case FWK_LOG_ARG_INTMAX:
+        value.j = va_arg(*args, intmax_t);
+        break;
+
+    case FWK_LOG_ARG_SIZE:
+        value.z = va_arg(*args, size_t);
+        break;
+
+    case FWK_LOG_ARG_PTRDIFF:
+        value.t = va_arg(*args, ptrdiff_t);
+        break;
+
+    case FWK_LOG_ARG_POINTER:
+        value.p = va_arg(*args, const void *);
+        break;
+
+    case FWK_LOG_ARG_DOUBLE:
+        value.d = va_arg(*args, double);
+        break;
+
+    case FWK_LOG_ARG_STRING:
+        return put_string(writer, va_arg(*args, const char *));
+
+    default:
+        return false;
+    }
+
+    return put(writer, &value, fwk_log_arg_size[arg]);
+}
+
+size_t __fwk_log_encode(
+    size_t record_size,
+    char record[record_size],
+    fwk_duration_ns_t timestamp,
+    const char *format,
+    va_list *args)
+{
+    struct fwk_log_writer writer = {
+        .record = record,
+        .size = record_size,
+    };
+
+    struct fwk_log_spec spec;
+    const char *c = format;
+    unsigned int i;
+    int star;
+
+    if (!put(&writer, &timestamp, sizeof(timestamp)) ||
+        !put(&writer, &format, sizeof(format))) {
+        return 0;
+    }
+
+    while ((c = strchr(c, '%')) != NULL) {
+        c = parse_spec(c, &spec);
+        if (spec.arg == FWK_LOG_ARG_INVALID) {
+            return 0;
+        }
+
+        for (i = 0; i < spec.star_count; i++) {
+            star = va_arg(*args, int);
+            if (!put(&writer, &star, sizeof(star))) {
+                return 0;
+            }
+        }
+
+        if (!encode_arg(&writer, spec.arg, args)) {
+            return 0;
+        }
+    }
+
+    return writer.length;
+}
+
+static size_t encode(
+    size_t record_size,
+    char record[record_size],
+    fwk_duration_ns_t timestamp,
+    const char *format,
+    ...)
+{
+    size_t length;
+    va_list args;
+
+    va_start(args, format);
+    length = __fwk_log_encode(record_size, record, timestamp, format, &args);
+    va_end(args);
+
+    return length;
+}
+
+size_t __fwk_log_encode_text(
+    size_t record_size,
+    char record[record_size],
+    fwk_duration_ns_t timestamp,
+    const char *message)
+{
+    return encode(record_size, record, timestamp, fwk_log_text_format, message);
+}
+
+/*
+ * Format a single value according to the conversion specification held by
+ * spec_format, passing the arguments of any asterisk first.
+ */
+#define FWK_LOG_FORMAT_VALUE(buffer, size, spec_format, spec, stars, value) \
+    (((spec).star_count == 0) ? \
+         snprintf(buffer, size, spec_format, value) : \
+         (((spec).star_count == 1) ? \
+              snprintf(buffer, size, spec_format, (stars)[0], value) : \
+              snprintf( \
+                  buffer, size, spec_format, (stars)[0], (stars)[1], value)))
+
+static int decode_arg(
+    struct fwk_log_reader *reader,
+    const struct fwk_log_spec *spec,
+    const int stars[FWK_LOG_SPEC_STAR_MAX],
+    size_t buffer_size,
+    char buffer[buffer_size])
+{
+    char spec_format[FWK_LOG_SPEC_SIZE];
+    union fwk_log_value value;
+    const char *string;
+
+    if (spec->length >= sizeof(spec_format)) {
+        return -1;
+    }
+
+    (void)memcpy(spec_format, spec->start, spec->length);
+    spec_format[spec->length] = '\0';
+
+    if (spec->arg == FWK_LOG_ARG_STRING) {
+        string = get_string(reader);
+        if (string == NULL) {
+            return -1;
+        }
+
+        return FWK_LOG_FORMAT_VALUE(
+            buffer, buffer_size, spec_format, *spec, stars, string);
+    }
+
+    if (!get(reader, &value, fwk_log_arg_size[spec->arg])) {
+        return -1;
+    }
+
+    switch (spec->arg) {
+    case FWK_LOG_ARG_INT:
+        return FWK_LOG_FORMAT_VALUE(
+            buffer, buffer_size, spec_format, *spec, stars, value.i);
+
+    case FWK_LOG_ARG_LONG:
+        return FWK_LOG_FORMAT_VALUE(
+            buffer, buffer_size, spec_format, *spec, stars, value.l);
+
+    case FWK_LOG_ARG_LLONG:
+        return FWK_LOG_FORMAT_VALUE(
+            buffer, buffer_size, spec_format, *spec, stars, value.ll);
+
+    case FWK_LOG_ARG_INTMAX:
+        return FWK_LOG_FORMAT_VALUE(
+            buffer, buffer_size, spec_format, *spec, stars, value.j);
+
+    case FWK_LOG_ARG_SIZE:
+        return FWK_LOG_FORMAT_VALUE(
+            buffer, buffer_size, spec_format, *spec, stars, value.z);
+
+    case FWK_LOG_ARG_PTRDIFF:
+        return FWK_LOG_FORMAT_VALUE(
+            buffer, buffer_size, spec_format, *spec, stars, value.t);
+
+    case FWK_LOG_ARG_POINTER:
+        return FWK_LOG_FORMAT_VALUE(
+            buffer, buffer_size, spec_format, *spec, stars, value.p);
+
+    case FWK_LOG_ARG_DOUBLE:
+        return FWK_LOG_FORMAT_VALUE(
+            buffer, buffer_size, spec_format, *spec, stars, value.d);
+
+    default:
+        return -1;
+    }
+}
+
+size_t __fwk_log_decode(
+    size_t record_size,
+    const char record[record_size],
+    fwk_duration_ns_t *timestamp,
+    size_t buffer_size,
+    char buffer[buffer_size])
+{
+    struct fwk_log_reader reader = {
+        .record = record,
+        .size = record_size,
+    };
+
+    struct fwk_log_spec spec;
+    int stars[FWK_LOG_SPEC_STAR_MAX];
+    const char *c;
+    size_t length = 0;
+    unsigned int i;
+    int count;
+
+    fwk_assert(buffer_size > 0);
+
+    if (!get(&reader, timestamp, sizeof(*timestamp)) ||
+        !get(&reader, &c, sizeof(c))) {
+        buffer[0] = '\0';
+
+        return 0;
+    }
+
+    while ((*c != '\0') && (length < (buffer_size - 1))) {
+        if (*c != '%') {
+            buffer[length++] = *c++;
+
+            continue;
+        }
+
+        c = parse_spec(c, &spec);
+        if (spec.arg == FWK_LOG_ARG_NONE) {
+            buffer[length++] = '%';
+
+            continue;
+        }
+
+        for (i = 0; i < spec.star_count; i++) {
+            if (!get(&reader, &stars[i], sizeof(stars[i]))) {
+                break;
+            }
+        }
+
+        if (i < spec.star_count) {
+            break;
+        }
+
+        count = decode_arg(
+            &reader, &spec, stars, buffer_size - length, &buffer[length]);
+        if (count < 0) {
+            break;
+        }
+
+        length = FWK_MIN(length + (size_t)count, buffer_size - 1);
+    }
+
+    buffer[length] = '\0';
+
+    return length;
+}
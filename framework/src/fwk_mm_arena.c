@@ -0,0 +1,415 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Memory management, arena allocator backend.
+ */
+
+#include <internal/fwk_mm.h>
+
+#include <fwk_assert.h>
+#include <fwk_id.h>
+#include <fwk_interrupt.h>
+#include <fwk_macros.h>
+#include <fwk_mm.h>
+#include <fwk_mm_arena.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Owner of the allocations made outside of the pre-runtime module stages */
+#define OWNER_FRAMEWORK ((uint16_t)FWK_MODULE_IDX_COUNT)
+
+/* Owner of the freed blocks */
+#define OWNER_NONE UINT16_MAX
+
+/*
+ * Header preceding each allocation.
+ */
+struct arena_block {
+    /* Size of the allocation in bytes */
+    uint32_t size;
+
+    /* Number of bytes between the start of the block and the allocation */
+    uint16_t offset;
+
+    /* Index of the module the allocation is charged to */
+    uint16_t owner;
+};
+
+/*
+ * Usage of the arena by a module or by the framework.
+ */
+struct arena_owner {
+    /* Number of bytes currently allocated */
+    size_t used;
+
+    /* Highest number of bytes allocated at the same time */
+    size_t peak;
+
+    /* Number of allocations currently alive */
+    unsigned int block_count;
+};
+
+static struct {
+    /* Start address of the arena */
+    uintptr_t start;
+
+    /* End address of the arena */
+    uintptr_t end;
+
+    /* Address of the first byte of the arena that was never allocated */
+    uintptr_t brk;
+
+    /* Highest allocation break */
+    uintptr_t brk_peak;
+
+    /* Owner the allocations are currently charged to */
+    uint16_t owner;
+
+    /* Usage of the arena per module, then by the framework */
+    struct arena_owner owner_table[FWK_MODULE_IDX_COUNT + 1];
+
+    /* Whether the arena is initialized */
+    bool initialized;
+
+    /* Whether the arena is sealed */
+    bool sealed;
+} arena_ctx;
+
+static struct arena_block *get_block(void *ptr)
+{
+    uintptr_t address = (uintptr_t)ptr;
+    struct arena_block *block;
+
+    if ((address < (arena_ctx.start + sizeof(*block))) ||
+        (address >= arena_ctx.brk)) {
+        return NULL;
+    }
+
+    block = (struct arena_block *)(address - sizeof(*block));
+    if (block->owner == OWNER_NONE) {
+        return NULL;
+    }
+
+    return block;
+}
+
+static void charge(uint16_t owner_idx, size_t size)
+{
+    struct arena_owner *owner = &arena_ctx.owner_table[owner_idx];
+
+    owner->used += size;
+    if (owner->used > owner->peak) {
+        owner->peak = owner->used;
+    }
+}
+
+static void discharge(uint16_t owner_idx, size_t size)
+{
+    struct arena_owner *owner = &arena_ctx.owner_table[owner_idx];
+
+    owner->used -= size;
+}
+
+static void set_brk(uintptr_t brk)
+{
+    arena_ctx.brk = brk;
+    if (brk > arena_ctx.brk_peak) {
+        arena_ctx.brk_peak = brk;
+    }
+}
+
+static void *arena_alloc(size_t alignment, size_t num, size_t size)
+{
+    struct arena_block *block;
+    uintptr_t start, address;
+    size_t bytes;
+    unsigned int flags;
+
+    if ((size != 0) && (num > (SIZE_MAX / size))) {
+        return NULL;
+    }
+
+    bytes = num * size;
+    if (bytes > UINT32_MAX) {
+        return NULL;
+    }
+
+    if (alignment < FMW_MM_ARENA_ALIGNMENT) {
+        alignment = FMW_MM_ARENA_ALIGNMENT;
+    }
+
+    flags = fwk_interrupt_global_disable();
+
+    if (!arena_ctx.initialized || arena_ctx.sealed) {
+        (void)fwk_interrupt_global_enable(flags);
+
+        return NULL;
+    }
+
+    start = arena_ctx.brk;
+    address = FWK_ALIGN_NEXT(start + sizeof(*block), alignment);
+    if (((address - start) > UINT16_MAX) || (address > arena_ctx.end) ||
+        (bytes > (arena_ctx.end - address))) {
+        (void)fwk_interrupt_global_enable(flags);
+
+        return NULL;
+    }
+
+    block = (struct arena_block *)(address - sizeof(*block));
+    *block = (struct arena_block){
+        .size = (uint32_t)bytes,
+        .offset = (uint16_t)(address - start),
+        .owner = arena_ctx.owner,
+    };
+
+    set_brk(address + bytes);
+
+    charge(block->owner, bytes);
+    arena_ctx.owner_table[block->owner].block_count++;
+
+    (void)fwk_interrupt_global_enable(flags);
+
+    return (void *)address;
+}
+
+/*
+ * Private interface functions
+ */
+
+int __fwk_mm_arena_init(uintptr_t start, size_t size)
+{
+    if ((size == 0) || (start > (UINTPTR_MAX - size))) {
+        return FWK_E_PARAM;
+    }
+
+    arena_ctx.start = start;
+    arena_ctx.end = start + size;
+    arena_ctx.brk = start;
+    arena_ctx.brk_peak = start;
+    arena_ctx.owner = OWNER_FRAMEWORK;
+    (void)memset(arena_ctx.owner_table, 0, sizeof(arena_ctx.owner_table));
+    arena_ctx.sealed = false;
+    arena_ctx.initialized = true;
+
+    return FWK_SUCCESS;
+}
+
+void __fwk_mm_set_owner(fwk_id_t id)
+{
+    if (fwk_id_is_equal(id, FWK_ID_NONE)) {
+        arena_ctx.owner = OWNER_FRAMEWORK;
+    } else {
+        arena_ctx.owner = (uint16_t)fwk_id_get_module_idx(id);
+    }
+
+    fwk_assert(arena_ctx.owner <= OWNER_FRAMEWORK);
+}
+
+void __fwk_mm_arena_seal(void)
+{
+    arena_ctx.sealed = true;
+}
+
+/*
+ * Public interface functions
+ */
+
+void *fwk_mm_alloc(size_t num, size_t size)
+{
+    void *ptr = arena_alloc(FMW_MM_ARENA_ALIGNMENT, num, size);
+
+    if (ptr == NULL) {
+        fwk_trap();
+    }
+
+    return ptr;
+}
+
+void *fwk_mm_alloc_notrap(size_t num, size_t size)
+{
+    return arena_alloc(FMW_MM_ARENA_ALIGNMENT, num, size);
+}
+
+void *fwk_mm_alloc_aligned(size_t alignment, size_t num, size_t size)
+{
+    void *ptr = arena_alloc(alignment, num, size);
+
+    if (ptr == NULL) {
+        fwk_trap();
+    }
+
+    return ptr;
+}
+
+void *fwk_mm_calloc(size_t num, size_t size)
+{
+    void *ptr = fwk_mm_alloc(num, size);
+
+    /* Freed memory may be handed out again */
+    (void)memset(ptr, 0, num * size);
+
+    return ptr;
+}
+
+void *fwk_mm_calloc_aligned(size_t alignment, size_t num, size_t size)
+{
+    void *ptr = fwk_mm_alloc_aligned(alignment, num, size);
+
+    (void)memset(ptr, 0, num * size);
+
+    return ptr;
+}
+
+void *fwk_mm_realloc(void *ptr, size_t num, size_t size)
+{
+    struct arena_block *block;
+    uintptr_t address = (uintptr_t)ptr;
+    size_t bytes;
+    void *new_ptr;
+    unsigned int flags;
+
+    if (ptr == NULL) {
+        return fwk_mm_alloc_notrap(num, size);
+    }
+
+    if ((size != 0) && (num > (SIZE_MAX / size))) {
+        return NULL;
+    }
+
+    bytes = num * size;
+
+    flags = fwk_interrupt_global_disable();
+
+    block = get_block(ptr);
+    if (block == NULL) {
+        (void)fwk_interrupt_global_enable(flags);
+        fwk_unexpected();
+
+        return NULL;
+    }
+
+    /* Shrink in place, or resize in place the most recent allocation */
+    if ((bytes <= block->size) ||
+        (((address + block->size) == arena_ctx.brk) && !arena_ctx.sealed &&
+         (bytes <= (arena_ctx.end - address)) && (bytes <= UINT32_MAX))) {
+        discharge(block->owner, block->size);
+        charge(block->owner, bytes);
+
+        if ((address + block->size) == arena_ctx.brk) {
+            set_brk(address + bytes);
+        }
+
+        block->size = (uint32_t)bytes;
+
+        (void)fwk_interrupt_global_enable(flags);
+
+        return ptr;
+    }
+
+    (void)fwk_interrupt_global_enable(flags);
+
+    new_ptr = fwk_mm_alloc_notrap(num, size);
+    if (new_ptr == NULL) {
+        return NULL;
+    }
+
+    (void)memcpy(new_ptr, ptr, block->size);
+    fwk_mm_free(ptr);
+
+    return new_ptr;
+}
+
+void fwk_mm_free(void *ptr)
+{
+    struct arena_block *block;
+    uintptr_t address = (uintptr_t)ptr;
+    unsigned int flags;
+
+    if (ptr == NULL) {
+        return;
+    }
+
+    flags = fwk_interrupt_global_disable();
+
+    block = get_block(ptr);
+    if (block == NULL) {
+        (void)fwk_interrupt_global_enable(flags);
+        fwk_unexpected();
+
+        return;
+    }
+
+    discharge(block->owner, block->size);
+    arena_ctx.owner_table[block->owner].block_count--;
+
+    /* Only the most recent allocation can be given back to the arena */
+    if ((address + block->size) == arena_ctx.brk) {
+        arena_ctx.brk = address - block->offset;
+    }
+
+    block->owner = OWNER_NONE;
+
+    (void)fwk_interrupt_global_enable(flags);
+}
+
+int fwk_mm_arena_get_stats(fwk_id_t id, struct fwk_mm_arena_stats *stats)
+{
+    const struct arena_owner *owner;
+    unsigned int flags;
+    unsigned int i;
+
+    if (stats == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (!arena_ctx.initialized) {
+        return FWK_E_INIT;
+    }
+
+    if (fwk_id_is_equal(id, FWK_ID_NONE)) {
+        flags = fwk_interrupt_global_disable();
+
+        *stats = (struct fwk_mm_arena_stats){
+            .size = arena_ctx.end - arena_ctx.start,
+            .peak = arena_ctx.brk_peak - arena_ctx.start,
+        };
+
+        for (i = 0; i < FWK_ARRAY_SIZE(arena_ctx.owner_table); i++) {
+            stats->used += arena_ctx.owner_table[i].used;
+            stats->block_count += arena_ctx.owner_table[i].block_count;
+        }
+
+        stats->fragmented = (arena_ctx.brk - arena_ctx.start) - stats->used;
+
+        (void)fwk_interrupt_global_enable(flags);
+
+        return FWK_SUCCESS;
+    }
+
+    if (!fwk_module_is_valid_module_id(id)) {
+        return FWK_E_PARAM;
+    }
+
+    flags = fwk_interrupt_global_disable();
+
+    owner = &arena_ctx.owner_table[fwk_id_get_module_idx(id)];
+    *stats = (struct fwk_mm_arena_stats){
+        .used = owner->used,
+        .peak = owner->peak,
+        .block_count = owner->block_count,
+    };
+
+    (void)fwk_interrupt_global_enable(flags);
+
+    return FWK_SUCCESS;
+}
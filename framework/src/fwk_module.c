@@ -10,7 +10,9 @@
 
 #include <internal/fwk_core.h>
 #include <internal/fwk_id.h>
+#include <internal/fwk_mm.h>
 #include <internal/fwk_module.h>
+#include <internal/fwk_notification.h>
 
 #include <fwk_assert.h>
 #include <fwk_cli_dbg.h>
@@ -47,6 +49,17 @@ static struct {
     /* Table of module contexts */
     struct fwk_module_context module_ctx_table[FWK_MODULE_IDX_COUNT];
 
+    /*
+     * Table of the element contexts of each module and of their number,
+     * indexed by module index. It mirrors the module contexts in a compact
+     * form so that the context of an element is reached from its identifier
+     * with a single load.
+     */
+    struct {
+        struct fwk_element_ctx *ctx_table;
+        size_t count;
+    } element_table[FWK_MODULE_IDX_COUNT];
+
     /* Pre-runtime phase stage */
     enum fwk_module_stage stage;
 
@@ -117,6 +130,8 @@ static void fwk_module_init_element_ctxs(
     const struct fwk_element *elements,
     size_t notification_count)
 {
+    unsigned int module_idx;
+
     ctx->element_count = fwk_module_count_elements(elements);
 
     ctx->element_ctx_table =
@@ -129,6 +144,10 @@ static void fwk_module_init_element_ctxs(
         fwk_module_init_element_ctx(
             &ctx->element_ctx_table[i], &elements[i], notification_count);
     }
+
+    module_idx = fwk_id_get_module_idx(ctx->id);
+    fwk_module_ctx.element_table[module_idx].ctx_table = ctx->element_ctx_table;
+    fwk_module_ctx.element_table[module_idx].count = ctx->element_count;
 }
 
 void fwk_module_init(void)
@@ -152,11 +171,16 @@ void fwk_module_init(void)
             .config = config,
         };
 
+        fwk_module_ctx.element_table[i].ctx_table = NULL;
+        fwk_module_ctx.element_table[i].count = 0;
+
         fwk_assert(ctx->desc != NULL);
         fwk_assert(ctx->config != NULL);
 
         fwk_list_init(&ctx->delayed_response_list);
 
+        __fwk_mm_set_owner(id);
+
         if (config->elements.type == FWK_MODULE_ELEMENTS_TYPE_STATIC) {
             size_t notification_count = 0;
 
@@ -174,6 +198,8 @@ void fwk_module_init(void)
                 &ctx->subscription_dlist_table, desc->notification_count);
         }
 #endif
+
+        __fwk_mm_set_owner(FWK_ID_NONE);
     }
 }
 
@@ -271,7 +297,9 @@ static void fwk_module_init_module(struct fwk_module_context *ctx)
 static void fwk_module_init_modules(void)
 {
     for (unsigned int i = 0U; i < (unsigned int)FWK_MODULE_IDX_COUNT; i++) {
+        __fwk_mm_set_owner(FWK_ID_MODULE(i));
         fwk_module_init_module(&fwk_module_ctx.module_ctx_table[i]);
+        __fwk_mm_set_owner(FWK_ID_NONE);
     }
 }
 
@@ -339,7 +367,9 @@ static int fwk_module_bind_modules(unsigned int round)
 
     for (module_idx = 0; module_idx < FWK_MODULE_IDX_COUNT; module_idx++) {
         fwk_mod_ctx = &fwk_module_ctx.module_ctx_table[module_idx];
+        __fwk_mm_set_owner(fwk_mod_ctx->id);
         status = fwk_module_bind_module(fwk_mod_ctx, round);
+        __fwk_mm_set_owner(FWK_ID_NONE);
         if (status != FWK_SUCCESS) {
             return status;
         }
@@ -401,7 +431,9 @@ static int start_modules(void)
 
     for (module_idx = 0; module_idx < FWK_MODULE_IDX_COUNT; module_idx++) {
         fwk_mod_ctx = &fwk_module_ctx.module_ctx_table[module_idx];
+        __fwk_mm_set_owner(fwk_mod_ctx->id);
         status = fwk_module_start_module(fwk_mod_ctx);
+        __fwk_mm_set_owner(FWK_ID_NONE);
         if (status != FWK_SUCCESS) {
             return status;
         }
@@ -447,6 +479,15 @@ int fwk_module_start(void)
 
     fwk_module_ctx.initialized = true;
 
+#ifdef BUILD_HAS_NOTIFICATION
+    __fwk_notification_freeze();
+#endif
+
+#ifdef BUILD_HAS_MM_ARENA_SEAL
+    /* All the memory needed at runtime has been allocated */
+    __fwk_mm_arena_seal();
+#endif
+
     FWK_LOG_CRIT("[FWK] Module initialization complete!");
 
     return FWK_SUCCESS;
@@ -540,9 +581,10 @@ struct fwk_module_context *fwk_module_get_ctx(fwk_id_t id)
 
 struct fwk_element_ctx *fwk_module_get_element_ctx(fwk_id_t element_id)
 {
-    struct fwk_module_context *fwk_mod_ctx = fwk_module_get_ctx(element_id);
+    unsigned int module_idx = element_id.common.module_idx;
 
-    return &fwk_mod_ctx->element_ctx_table[element_id.element.element_idx];
+    return &fwk_module_ctx.element_table[module_idx]
+                .ctx_table[element_id.element.element_idx];
 }
 
 int fwk_module_get_state(fwk_id_t id, enum fwk_module_state *state)
@@ -598,13 +640,12 @@ bool fwk_module_is_valid_element_id(fwk_id_t id)
 
     return (
         fwk_id_get_element_idx(id) <
-        fwk_module_ctx.module_ctx_table[module_idx].element_count);
+        fwk_module_ctx.element_table[module_idx].count);
 }
 
 bool fwk_module_is_valid_sub_element_id(fwk_id_t id)
 {
     unsigned int module_idx;
-    struct fwk_module_context *fwk_mod_ctx;
     unsigned int element_idx;
 
     if (!fwk_id_is_type(id, FWK_ID_TYPE_SUB_ELEMENT)) {
@@ -615,16 +656,17 @@ bool fwk_module_is_valid_sub_element_id(fwk_id_t id)
     if (module_idx >= FWK_MODULE_IDX_COUNT) {
         return false;
     }
-    fwk_mod_ctx = &fwk_module_ctx.module_ctx_table[module_idx];
 
     element_idx = fwk_id_get_element_idx(id);
-    if (element_idx >= fwk_mod_ctx->element_count) {
+    if (element_idx >= fwk_module_ctx.element_table[module_idx].count) {
         return false;
     }
 
     return (
         fwk_id_get_sub_element_idx(id) <
-        fwk_mod_ctx->element_ctx_table[element_idx].sub_element_count);
+        fwk_module_ctx.element_table[module_idx]
+            .ctx_table[element_idx]
+            .sub_element_count);
 }
 
 bool fwk_module_is_valid_entity_id(fwk_id_t id)
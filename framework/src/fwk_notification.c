@@ -22,6 +22,7 @@
 #include <fwk_log.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
+#include <fwk_module_idx.h>
 #include <fwk_notification.h>
 #include <fwk_status.h>
 
@@ -33,6 +34,21 @@ struct notification_ctx {
      * Queue of notification subscription structures that are free.
      */
     struct fwk_dlist free_subscription_dlist;
+
+    /* Whether the fan-outs of the notifications have been precomputed */
+    bool frozen;
+
+    /*
+     * Table of the targets of the notification fan-outs. The targets of a
+     * fan-out are contiguous and in subscription order.
+     */
+    fwk_id_t fanout_target_table[FMW_NOTIFICATION_MAX];
+
+    /*
+     * Number of entries of the fan-out target table in use, including the
+     * entries left behind by fan-outs that have moved.
+     */
+    unsigned int fanout_target_count;
 };
 
 static struct notification_ctx ctx;
@@ -72,6 +88,177 @@ static struct fwk_dlist *get_subscription_dlist(
                fwk_id_get_notification_idx(notification_id)];
 }
 
+/*
+ * Get the fan-out of a given notification emitted by a given source.
+ *
+ * \note The function assumes the validity of all its input parameters.
+ *
+ * \param notification_id Identifier of the notification.
+ * \param source_id Identifier of the emitter of the notification.
+ *
+ * \return A pointer to the fan-out, NULL if the fan-outs have not been
+ *      precomputed yet.
+ */
+static struct __fwk_notification_fanout *get_fanout(
+    fwk_id_t notification_id,
+    fwk_id_t source_id)
+{
+    struct __fwk_notification_fanout *fanout_table;
+
+    if (!ctx.frozen) {
+        return NULL;
+    }
+
+    if (fwk_id_is_type(source_id, FWK_ID_TYPE_MODULE)) {
+        fanout_table = fwk_module_get_ctx(source_id)->fanout_table;
+    } else {
+        fanout_table = fwk_module_get_element_ctx(source_id)->fanout_table;
+    }
+
+    if (fanout_table == NULL) {
+        return NULL;
+    }
+
+    return &fanout_table[fwk_id_get_notification_idx(notification_id)];
+}
+
+/*
+ * Write the targets of a list of subscriptions into the fan-out target table.
+ *
+ * \param fanout Fan-out to update.
+ * \param subscription_dlist Pointer to the doubly-linked list of subscriptions.
+ * \param first Index in the fan-out target table of the first target.
+ */
+static void fill_fanout(
+    struct __fwk_notification_fanout *fanout,
+    struct fwk_dlist *subscription_dlist,
+    unsigned int first)
+{
+    struct fwk_dlist_node *node;
+    struct __fwk_notification_subscription *subscription;
+    unsigned int count = 0;
+
+    for (node = fwk_list_head(subscription_dlist); node != NULL;
+         node = fwk_list_next(subscription_dlist, node)) {
+        subscription = FWK_LIST_GET(
+            node, struct __fwk_notification_subscription, dlist_node);
+
+        fwk_assert((first + count) < FMW_NOTIFICATION_MAX);
+        ctx.fanout_target_table[first + count] = subscription->target_id;
+        count++;
+    }
+
+    fanout->first = first;
+    fanout->count = count;
+}
+
+/*
+ * Precompute the fan-outs of the notifications emitted by an entity at the end
+ * of the fan-out target table, allocating the table of its fan-outs if needed.
+ *
+ * \param subscription_dlist_table Table of the subscription lists of the
+ *      entity.
+ * \param[in, out] fanout_table Table of the fan-outs of the entity.
+ * \param notification_count Number of notifications of the entity.
+ */
+static void build_entity_fanouts(
+    struct fwk_dlist *subscription_dlist_table,
+    struct __fwk_notification_fanout **fanout_table,
+    unsigned int notification_count)
+{
+    struct __fwk_notification_fanout *fanout;
+    unsigned int notification_idx;
+
+    if (*fanout_table == NULL) {
+        *fanout_table =
+            fwk_mm_calloc(notification_count, sizeof((*fanout_table)[0]));
+    }
+
+    for (notification_idx = 0; notification_idx < notification_count;
+         notification_idx++) {
+        fanout = &(*fanout_table)[notification_idx];
+
+        fill_fanout(
+            fanout,
+            &subscription_dlist_table[notification_idx],
+            ctx.fanout_target_count);
+        ctx.fanout_target_count += fanout->count;
+    }
+}
+
+/*
+ * Precompute the fan-outs of all the notifications, from the start of the
+ * fan-out target table.
+ */
+static void build_fanouts(void)
+{
+    struct fwk_module_context *module_ctx;
+    struct fwk_element_ctx *element_ctx;
+    unsigned int module_idx, element_idx, notification_count;
+
+    ctx.fanout_target_count = 0;
+
+    for (module_idx = 0; module_idx < (unsigned int)FWK_MODULE_IDX_COUNT;
+         module_idx++) {
+        module_ctx = fwk_module_get_ctx(FWK_ID_MODULE(module_idx));
+
+        notification_count = (unsigned int)module_ctx->desc->notification_count;
+        if (notification_count == 0) {
+            continue;
+        }
+
+        build_entity_fanouts(
+            module_ctx->subscription_dlist_table,
+            &module_ctx->fanout_table,
+            notification_count);
+
+        for (element_idx = 0; element_idx < module_ctx->element_count;
+             element_idx++) {
+            element_ctx = &module_ctx->element_ctx_table[element_idx];
+
+            build_entity_fanouts(
+                element_ctx->subscription_dlist_table,
+                &element_ctx->fanout_table,
+                notification_count);
+        }
+    }
+}
+
+/*
+ * Update the fan-out of a list of subscriptions that has changed.
+ *
+ * \details A fan-out that shrinks is updated in place, and a fan-out that grows
+ *      is moved to the end of the fan-out target table. When the table is full,
+ *      all the fan-outs are precomputed again to reclaim the entries left
+ *      behind.
+ *
+ * \note Must be called with the interrupts disabled.
+ *
+ * \param fanout Fan-out to update.
+ * \param subscription_dlist Pointer to the doubly-linked list of subscriptions.
+ */
+static void update_fanout(
+    struct __fwk_notification_fanout *fanout,
+    struct fwk_dlist *subscription_dlist)
+{
+    struct fwk_dlist_node *node;
+    unsigned int count = 0;
+
+    for (node = fwk_list_head(subscription_dlist); node != NULL;
+         node = fwk_list_next(subscription_dlist, node)) {
+        count++;
+    }
+
+    if (count <= fanout->count) {
+        fill_fanout(fanout, subscription_dlist, fanout->first);
+    } else if (count <= (FMW_NOTIFICATION_MAX - ctx.fanout_target_count)) {
+        fill_fanout(fanout, subscription_dlist, ctx.fanout_target_count);
+        ctx.fanout_target_count += count;
+    } else {
+        build_fanouts();
+    }
+}
+
 /*
  * Search for a subscription with a given source and target identifier in a list
  * of subscriptions.
@@ -123,6 +310,18 @@ static void send_notifications(struct fwk_event *notification_event,
     struct fwk_dlist *subscription_dlist;
     struct fwk_dlist_node *node;
     struct __fwk_notification_subscription *subscription;
+    struct __fwk_notification_fanout *fanout;
+
+    fanout = get_fanout(notification_event->id, notification_event->source_id);
+    if (fanout != NULL) {
+        __fwk_put_notification_fanout(
+            notification_event,
+            &ctx.fanout_target_table[fanout->first],
+            fanout->count,
+            count);
+
+        return;
+    }
 
     subscription_dlist = get_subscription_dlist(notification_event->id,
                                                 notification_event->source_id);
@@ -162,12 +361,25 @@ static FWK_CONSTRUCTOR void fwk_notification_init(void)
     /* All the subscription structures are free to be used */
     fwk_list_init(&ctx.free_subscription_dlist);
 
+    ctx.frozen = false;
+    ctx.fanout_target_count = 0;
+
     for (i = 0; i < FMW_NOTIFICATION_MAX; i++) {
         fwk_list_push_tail(
             &ctx.free_subscription_dlist, &subscriptions[i].dlist_node);
     }
 }
 
+void __fwk_notification_freeze(void)
+{
+    unsigned int flags;
+
+    flags = fwk_interrupt_global_disable();
+    build_fanouts();
+    ctx.frozen = true;
+    (void)fwk_interrupt_global_enable(flags);
+}
+
 void __fwk_notification_reset(void)
 {
     fwk_notification_init();
@@ -184,6 +396,7 @@ int fwk_notification_subscribe(fwk_id_t notification_id, fwk_id_t source_id,
     unsigned int flags;
     struct fwk_dlist *subscription_dlist;
     struct __fwk_notification_subscription *subscription;
+    struct __fwk_notification_fanout *fanout;
 
     if (fwk_is_interrupt_context()) {
         status = FWK_E_HANDLER;
@@ -218,8 +431,13 @@ int fwk_notification_subscribe(fwk_id_t notification_id, fwk_id_t source_id,
     subscription->source_id = source_id;
     subscription->target_id = target_id;
 
+    fanout = get_fanout(notification_id, source_id);
+
     flags = fwk_interrupt_global_disable();
     fwk_list_push_tail(subscription_dlist, &subscription->dlist_node);
+    if (fanout != NULL) {
+        update_fanout(fanout, subscription_dlist);
+    }
     (void)fwk_interrupt_global_enable(flags);
 
     return FWK_SUCCESS;
@@ -236,6 +454,7 @@ int fwk_notification_unsubscribe(fwk_id_t notification_id, fwk_id_t source_id,
     unsigned int flags;
     struct fwk_dlist *subscription_dlist;
     struct __fwk_notification_subscription *subscription;
+    struct __fwk_notification_fanout *fanout;
 
     if (fwk_is_interrupt_context()) {
         status = FWK_E_HANDLER;
@@ -259,8 +478,13 @@ int fwk_notification_unsubscribe(fwk_id_t notification_id, fwk_id_t source_id,
         goto error;
     }
 
+    fanout = get_fanout(notification_id, source_id);
+
     flags = fwk_interrupt_global_disable();
     fwk_list_remove(subscription_dlist, &subscription->dlist_node);
+    if (fanout != NULL) {
+        update_fanout(fanout, subscription_dlist);
+    }
     (void)fwk_interrupt_global_enable(flags);
     fwk_list_push_tail(&ctx.free_subscription_dlist, &subscription->dlist_node);
 
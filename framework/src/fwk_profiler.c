@@ -0,0 +1,350 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Event profiler.
+ */
+
+#include <internal/fwk_module.h>
+#include <internal/fwk_profiler.h>
+
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_interrupt.h>
+#include <fwk_math.h>
+#include <fwk_mm.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_profiler.h>
+#include <fwk_status.h>
+#include <fwk_string.h>
+#include <fwk_time.h>
+
+#include <stdbool.h>
+
+/* Statistics of the events and notifications of a module */
+struct profiler_module_ctx {
+    /* Statistics of all the events and notifications processed by the module */
+    struct fwk_profiler_latency dispatch;
+
+    /* Statistics per event defined by the module */
+    struct fwk_profiler_latency *event_table;
+    unsigned int event_count;
+
+#ifdef BUILD_HAS_NOTIFICATION
+    /* Statistics per notification defined by the module */
+    struct fwk_profiler_latency *notification_table;
+    unsigned int notification_count;
+#endif
+};
+
+static struct {
+    /* Profiler initialization completed flag */
+    bool initialized;
+
+    /* Table of module statistics */
+    struct profiler_module_ctx module_table[FWK_MODULE_IDX_COUNT];
+
+    /* Statistics of the events raised by interrupt handlers */
+    struct fwk_profiler_latency isr;
+
+    /* Event queue depth statistics */
+    struct fwk_profiler_queue_stats queue;
+} profiler_ctx;
+
+/*
+ * Static functions
+ */
+
+static unsigned int get_bucket(fwk_duration_ns_t duration)
+{
+    fwk_duration_us_t duration_us = fwk_time_duration_us(duration);
+    unsigned int bucket;
+
+    if (duration_us == 0) {
+        return 0;
+    }
+
+    bucket = (unsigned int)fwk_math_log2(duration_us) + 1;
+    if (bucket >= FMW_EVENT_PROFILER_BUCKET_COUNT) {
+        bucket = FMW_EVENT_PROFILER_BUCKET_COUNT - 1;
+    }
+
+    return bucket;
+}
+
+static void record_latency(
+    struct fwk_profiler_latency *latency,
+    fwk_duration_ns_t duration)
+{
+    if ((latency->count == 0) || (duration < latency->min)) {
+        latency->min = duration;
+    }
+
+    if (duration > latency->max) {
+        latency->max = duration;
+    }
+
+    latency->count++;
+    latency->total += duration;
+    latency->histogram[get_bucket(duration)]++;
+}
+
+/*
+ * Unlike fwk_time_duration(), do not assert on a null duration as timestamps
+ * are all zero when no time driver is available.
+ */
+static fwk_duration_ns_t get_duration(
+    fwk_timestamp_t start,
+    fwk_timestamp_t end)
+{
+    return (end > start) ? (end - start) : 0;
+}
+
+static struct fwk_profiler_latency *get_id_latency(fwk_id_t id)
+{
+    struct profiler_module_ctx *module_ctx;
+    unsigned int idx;
+
+    module_ctx = &profiler_ctx.module_table[fwk_id_get_module_idx(id)];
+
+    if (fwk_id_is_type(id, FWK_ID_TYPE_EVENT)) {
+        idx = fwk_id_get_event_idx(id);
+        if (idx < module_ctx->event_count) {
+            return &module_ctx->event_table[idx];
+        }
+    }
+
+#ifdef BUILD_HAS_NOTIFICATION
+    if (fwk_id_is_type(id, FWK_ID_TYPE_NOTIFICATION)) {
+        idx = fwk_id_get_notification_idx(id);
+        if (idx < module_ctx->notification_count) {
+            return &module_ctx->notification_table[idx];
+        }
+    }
+#endif
+
+    return NULL;
+}
+
+/*
+ * Private interface functions
+ */
+
+int __fwk_profiler_init(void)
+{
+    struct profiler_module_ctx *module_ctx;
+    const struct fwk_module *desc;
+    unsigned int i;
+
+    for (i = 0; i < (unsigned int)FWK_MODULE_IDX_COUNT; i++) {
+        module_ctx = &profiler_ctx.module_table[i];
+        desc = fwk_module_get_ctx(FWK_ID_MODULE(i))->desc;
+
+        *module_ctx = (struct profiler_module_ctx){
+            .event_count = desc->event_count,
+        };
+
+        if (desc->event_count > 0) {
+            module_ctx->event_table = fwk_mm_calloc(
+                desc->event_count, sizeof(module_ctx->event_table[0]));
+        }
+
+#ifdef BUILD_HAS_NOTIFICATION
+        module_ctx->notification_count = desc->notification_count;
+        if (desc->notification_count > 0) {
+            module_ctx->notification_table = fwk_mm_calloc(
+                desc->notification_count,
+                sizeof(module_ctx->notification_table[0]));
+        }
+#endif
+    }
+
+    profiler_ctx.isr = (struct fwk_profiler_latency){ 0 };
+    profiler_ctx.queue = (struct fwk_profiler_queue_stats){ 0 };
+    profiler_ctx.initialized = true;
+
+    return FWK_SUCCESS;
+}
+
+fwk_timestamp_t __fwk_profiler_event_queued(bool is_isr_event)
+{
+    struct fwk_profiler_queue_stats *queue = &profiler_ctx.queue;
+
+    if (is_isr_event) {
+        if (++queue->isr_event_queue_depth > queue->isr_event_queue_peak) {
+            queue->isr_event_queue_peak = queue->isr_event_queue_depth;
+        }
+
+        return fwk_time_current();
+    }
+
+    if (++queue->event_queue_depth > queue->event_queue_peak) {
+        queue->event_queue_peak = queue->event_queue_depth;
+    }
+
+    return 0;
+}
+
+void __fwk_profiler_isr_events_pulled(unsigned int count)
+{
+    struct fwk_profiler_queue_stats *queue = &profiler_ctx.queue;
+    unsigned int flags;
+
+    /* The ISR event queue depth is also updated by interrupt handlers */
+    flags = fwk_interrupt_global_disable();
+    if (queue->isr_event_queue_depth > count) {
+        queue->isr_event_queue_depth -= count;
+    } else {
+        queue->isr_event_queue_depth = 0;
+    }
+    (void)fwk_interrupt_global_enable(flags);
+
+    queue->event_queue_depth += count;
+    if (queue->event_queue_depth > queue->event_queue_peak) {
+        queue->event_queue_peak = queue->event_queue_depth;
+    }
+}
+
+fwk_timestamp_t __fwk_profiler_dispatch_start(const struct fwk_event *event)
+{
+    fwk_timestamp_t start = fwk_time_current();
+
+    if (profiler_ctx.queue.event_queue_depth > 0) {
+        profiler_ctx.queue.event_queue_depth--;
+    }
+
+    if (event->isr_timestamp != 0) {
+        record_latency(
+            &profiler_ctx.isr, get_duration(event->isr_timestamp, start));
+    }
+
+    return start;
+}
+
+void __fwk_profiler_dispatch_end(
+    const struct fwk_event *event,
+    fwk_timestamp_t start)
+{
+    fwk_duration_ns_t duration = get_duration(start, fwk_time_current());
+    struct fwk_profiler_latency *latency;
+    unsigned int module_idx = fwk_id_get_module_idx(event->target_id);
+
+    record_latency(&profiler_ctx.module_table[module_idx].dispatch, duration);
+
+    latency = get_id_latency(event->id);
+    if (latency != NULL) {
+        record_latency(latency, duration);
+    }
+}
+
+/*
+ * Public interface functions
+ */
+
+int fwk_profiler_get_dispatch_latency(
+    fwk_id_t id,
+    struct fwk_profiler_latency *latency)
+{
+    const struct fwk_profiler_latency *id_latency;
+
+    if (latency == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (!profiler_ctx.initialized) {
+        return FWK_E_INIT;
+    }
+
+    if (fwk_id_get_module_idx(id) >= (unsigned int)FWK_MODULE_IDX_COUNT) {
+        return FWK_E_PARAM;
+    }
+
+    if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+        id_latency =
+            &profiler_ctx.module_table[fwk_id_get_module_idx(id)].dispatch;
+    } else {
+        id_latency = get_id_latency(id);
+        if (id_latency == NULL) {
+            return FWK_E_PARAM;
+        }
+    }
+
+    *latency = *id_latency;
+
+    return FWK_SUCCESS;
+}
+
+int fwk_profiler_get_isr_latency(struct fwk_profiler_latency *latency)
+{
+    if (latency == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (!profiler_ctx.initialized) {
+        return FWK_E_INIT;
+    }
+
+    *latency = profiler_ctx.isr;
+
+    return FWK_SUCCESS;
+}
+
+int fwk_profiler_get_queue_stats(struct fwk_profiler_queue_stats *stats)
+{
+    unsigned int flags;
+
+    if (stats == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (!profiler_ctx.initialized) {
+        return FWK_E_INIT;
+    }
+
+    flags = fwk_interrupt_global_disable();
+    *stats = profiler_ctx.queue;
+    (void)fwk_interrupt_global_enable(flags);
+
+    return FWK_SUCCESS;
+}
+
+void fwk_profiler_reset(void)
+{
+    struct profiler_module_ctx *module_ctx;
+    unsigned int i, flags;
+
+    for (i = 0; i < (unsigned int)FWK_MODULE_IDX_COUNT; i++) {
+        module_ctx = &profiler_ctx.module_table[i];
+
+        module_ctx->dispatch = (struct fwk_profiler_latency){ 0 };
+
+        if (module_ctx->event_count > 0) {
+            fwk_str_memset(
+                module_ctx->event_table,
+                0,
+                module_ctx->event_count * sizeof(module_ctx->event_table[0]));
+        }
+
+#ifdef BUILD_HAS_NOTIFICATION
+        if (module_ctx->notification_count > 0) {
+            fwk_str_memset(
+                module_ctx->notification_table,
+                0,
+                module_ctx->notification_count *
+                    sizeof(module_ctx->notification_table[0]));
+        }
+#endif
+    }
+
+    profiler_ctx.isr = (struct fwk_profiler_latency){ 0 };
+
+    flags = fwk_interrupt_global_disable();
+    profiler_ctx.queue.event_queue_peak = profiler_ctx.queue.event_queue_depth;
+    profiler_ctx.queue.isr_event_queue_peak =
+        profiler_ctx.queue.isr_event_queue_depth;
+    (void)fwk_interrupt_global_enable(flags);
+}
@@ -0,0 +1,245 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Single-producer single-consumer ring buffer.
+ */
+
+#include <fwk_assert.h>
+#include <fwk_macros.h>
+#include <fwk_ring_spsc.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * The producer only writes the tail index and the consumer only writes the
+ * head index. Each side publishes its index with release semantics once it is
+ * done with the storage, and reads the index of the other side with acquire
+ * semantics before touching the storage. This orders the accesses to the
+ * storage against the index updates on the host as well as on Arm targets,
+ * where it results in data memory barriers.
+ */
+
+static size_t load_own_index(const size_t *idx)
+{
+    return __atomic_load_n(idx, __ATOMIC_RELAXED);
+}
+
+static size_t load_index(const size_t *idx)
+{
+    return __atomic_load_n(idx, __ATOMIC_ACQUIRE);
+}
+
+static void store_index(size_t *idx, size_t value)
+{
+    __atomic_store_n(idx, value, __ATOMIC_RELEASE);
+}
+
+static size_t fwk_ring_spsc_offset(
+    const struct fwk_ring_spsc *ring,
+    size_t idx)
+{
+    return (idx & (ring->capacity - 1));
+}
+
+static void copy_from_ring(
+    const struct fwk_ring_spsc *ring,
+    size_t idx,
+    char *buffer,
+    size_t size)
+{
+    size_t offset = fwk_ring_spsc_offset(ring, idx);
+    size_t chunk = FWK_MIN(size, ring->capacity - offset);
+
+    (void)memcpy(buffer, &ring->storage[offset], chunk);
+    (void)memcpy(&buffer[chunk], ring->storage, size - chunk);
+}
+
+static void copy_to_ring(
+    struct fwk_ring_spsc *ring,
+    size_t idx,
+    const char *buffer,
+    size_t size)
+{
+    size_t offset = fwk_ring_spsc_offset(ring, idx);
+    size_t chunk = FWK_MIN(size, ring->capacity - offset);
+
+    (void)memcpy(&ring->storage[offset], buffer, chunk);
+    (void)memcpy(ring->storage, &buffer[chunk], size - chunk);
+}
+
+void fwk_ring_spsc_init(
+    struct fwk_ring_spsc *ring,
+    char *storage,
+    size_t storage_size)
+{
+    fwk_assert(ring != NULL);
+    fwk_assert(storage != NULL);
+    fwk_assert(storage_size > 0);
+    fwk_assert((storage_size & (storage_size - 1)) == 0);
+
+    *ring = (struct fwk_ring_spsc){
+        .storage = storage,
+        .capacity = storage_size,
+    };
+}
+
+size_t fwk_ring_spsc_get_capacity(const struct fwk_ring_spsc *ring)
+{
+    fwk_assert(ring != NULL);
+
+    return ring->capacity;
+}
+
+size_t fwk_ring_spsc_get_length(const struct fwk_ring_spsc *ring)
+{
+    size_t head, length;
+
+    fwk_assert(ring != NULL);
+
+    head = load_index(&ring->head);
+    length = load_index(&ring->tail) - head;
+
+    /*
+     * When called from the consumer side, the producer may have consumed the
+     * space given back after the head was read.
+     */
+    return FWK_MIN(length, ring->capacity);
+}
+
+size_t fwk_ring_spsc_get_free(const struct fwk_ring_spsc *ring)
+{
+    return (fwk_ring_spsc_get_capacity(ring) - fwk_ring_spsc_get_length(ring));
+}
+
+bool fwk_ring_spsc_is_empty(const struct fwk_ring_spsc *ring)
+{
+    return (fwk_ring_spsc_get_length(ring) == 0);
+}
+
+size_t fwk_ring_spsc_push(
+    struct fwk_ring_spsc *ring,
+    const char *buffer,
+    size_t buffer_size)
+{
+    size_t tail, size;
+
+    fwk_assert(ring != NULL);
+    fwk_assert((buffer != NULL) || (buffer_size == 0));
+
+    tail = load_own_index(&ring->tail);
+    size = ring->capacity - (tail - load_index(&ring->head));
+    size = FWK_MIN(size, buffer_size);
+
+    copy_to_ring(ring, tail, buffer, size);
+
+    store_index(&ring->tail, tail + size);
+
+    return size;
+}
+
+size_t fwk_ring_spsc_pop(
+    struct fwk_ring_spsc *ring,
+    char *buffer,
+    size_t buffer_size)
+{
+    size_t head, size;
+
+    fwk_assert(ring != NULL);
+
+    head = load_own_index(&ring->head);
+    size = FWK_MIN(load_index(&ring->tail) - head, buffer_size);
+
+    if (buffer != NULL) {
+        copy_from_ring(ring, head, buffer, size);
+    }
+
+    store_index(&ring->head, head + size);
+
+    return size;
+}
+
+size_t fwk_ring_spsc_peek(
+    const struct fwk_ring_spsc *ring,
+    char *buffer,
+    size_t buffer_size)
+{
+    size_t head, size;
+
+    fwk_assert(ring != NULL);
+    fwk_assert((buffer != NULL) || (buffer_size == 0));
+
+    head = load_own_index(&ring->head);
+    size = FWK_MIN(load_index(&ring->tail) - head, buffer_size);
+
+    copy_from_ring(ring, head, buffer, size);
+
+    return size;
+}
+
+size_t fwk_ring_spsc_acquire_write(
+    const struct fwk_ring_spsc *ring,
+    char **span)
+{
+    size_t tail, offset, size;
+
+    fwk_assert(ring != NULL);
+    fwk_assert(span != NULL);
+
+    tail = load_own_index(&ring->tail);
+    offset = fwk_ring_spsc_offset(ring, tail);
+    size = ring->capacity - (tail - load_index(&ring->head));
+
+    *span = &ring->storage[offset];
+
+    return FWK_MIN(size, ring->capacity - offset);
+}
+
+void fwk_ring_spsc_commit_write(struct fwk_ring_spsc *ring, size_t size)
+{
+    size_t tail;
+
+    fwk_assert(ring != NULL);
+
+    tail = load_own_index(&ring->tail);
+
+    fwk_assert(size <= fwk_ring_spsc_get_free(ring));
+
+    store_index(&ring->tail, tail + size);
+}
+
+size_t fwk_ring_spsc_acquire_read(
+    const struct fwk_ring_spsc *ring,
+    const char **span)
+{
+    size_t head, offset, size;
+
+    fwk_assert(ring != NULL);
+    fwk_assert(span != NULL);
+
+    head = load_own_index(&ring->head);
+    offset = fwk_ring_spsc_offset(ring, head);
+    size = load_index(&ring->tail) - head;
+
+    *span = &ring->storage[offset];
+
+    return FWK_MIN(size, ring->capacity - offset);
+}
+
+void fwk_ring_spsc_release_read(struct fwk_ring_spsc *ring, size_t size)
+{
+    size_t head;
+
+    fwk_assert(ring != NULL);
+
+    head = load_own_index(&ring->head);
+
+    fwk_assert(size <= fwk_ring_spsc_get_length(ring));
+
+    store_index(&ring->head, head + size);
+}
@@ -176,6 +176,35 @@ void __fwk_slist_remove(
     fwk_unexpected();
 }
 
+void __fwk_slist_splice(struct fwk_slist *dst, struct fwk_slist *src)
+{
+    fwk_assert(dst != NULL);
+    fwk_assert(src != NULL);
+    fwk_assert(dst != src);
+
+    if (__fwk_slist_is_empty(src)) {
+        return;
+    }
+
+    dst->tail->next = src->head;
+    src->tail->next = (struct fwk_slist_node *)dst;
+    dst->tail = src->tail;
+
+#ifdef FWK_MARKED_LIST_ENABLE
+    dst->marks.current_count += src->marks.current_count;
+    dst->marks.max_count =
+        FWK_MAX(dst->marks.max_count, dst->marks.current_count);
+#endif
+
+    /* Keep the marks of the source list so its maximum size is not lost */
+    src->head = (struct fwk_slist_node *)src;
+    src->tail = (struct fwk_slist_node *)src;
+
+#ifdef FWK_MARKED_LIST_ENABLE
+    src->marks.current_count = 0;
+#endif
+}
+
 bool __fwk_slist_contains(
     const struct fwk_slist *list,
     const struct fwk_slist_node *node)
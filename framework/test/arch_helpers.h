@@ -13,6 +13,15 @@
  */
 extern unsigned int critical_section_nest_level;
 
+#ifdef BUILD_TEST_CRITICAL_SECTION_HOOKS
+/*
+ * Hooks called on entry to and exit from each critical section, implemented
+ * by the tests that need to observe them.
+ */
+void test_critical_section_enter(void);
+void test_critical_section_exit(void);
+#endif
+
 /*!
  * \brief Enables global CPU interrupts. (stub)
  *
@@ -23,6 +32,10 @@ inline static void arch_interrupts_enable(unsigned int not_used)
     if (critical_section_nest_level > 0) {
         critical_section_nest_level--;
     }
+
+#ifdef BUILD_TEST_CRITICAL_SECTION_HOOKS
+    test_critical_section_exit();
+#endif
 }
 
 /*!
@@ -33,6 +46,10 @@ inline static unsigned int arch_interrupts_disable(void)
 {
     critical_section_nest_level++;
 
+#ifdef BUILD_TEST_CRITICAL_SECTION_HOOKS
+    test_critical_section_enter();
+#endif
+
     return 0;
 }
 
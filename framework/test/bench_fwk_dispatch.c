@@ -0,0 +1,281 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Host benchmark of the dispatch of events to the elements and
+ *     sub-elements of a module, including the lookups of their contexts.
+ */
+
+#include <internal/fwk_module.h>
+
+#include <fwk_assert.h>
+#include <fwk_core.h>
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define EVENT_COUNT 1000000
+
+/* The best of several rounds is reported to filter out the host noise */
+#define ROUND_COUNT 3
+
+/* Number of events queued between two drains of the event queue */
+#define BURST_SIZE 32
+
+#define ELEMENT_COUNT 16
+
+#define SUB_ELEMENT_COUNT 4
+
+extern struct fwk_module *module_table[FWK_MODULE_IDX_COUNT];
+extern struct fwk_module_config *module_config_table[FWK_MODULE_IDX_COUNT];
+
+static struct fwk_element dummy_element_table[ELEMENT_COUNT + 1];
+static unsigned int dummy_element_data[ELEMENT_COUNT];
+
+static unsigned int processed_count;
+
+static uint64_t get_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/* Mock functions */
+void *__wrap_fwk_mm_calloc(size_t num, size_t size)
+{
+    return calloc(num, size);
+}
+
+bool __wrap_fwk_is_interrupt_context(void)
+{
+    return false;
+}
+
+/* Dummy module */
+static int dummy_init(
+    fwk_id_t module_id,
+    unsigned int element_count,
+    const void *data)
+{
+    return FWK_SUCCESS;
+}
+
+static int dummy_element_init(
+    fwk_id_t element_id,
+    unsigned int sub_element_count,
+    const void *data)
+{
+    return FWK_SUCCESS;
+}
+
+static int dummy_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *response_event)
+{
+    /* Retrieve the configuration data of the target as drivers do */
+    if (fwk_module_get_data(event->target_id) != NULL) {
+        processed_count++;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static struct fwk_module dummy_module = {
+    .type = FWK_MODULE_TYPE_DRIVER,
+    .event_count = 1,
+    .init = dummy_init,
+    .element_init = dummy_element_init,
+    .process_event = dummy_process_event,
+};
+
+static struct fwk_module_config dummy_module_config = {
+    .elements = FWK_MODULE_STATIC_ELEMENTS_PTR(dummy_element_table),
+};
+
+static int test_suite_setup(void)
+{
+    unsigned int i;
+    int status;
+
+    for (i = 0; i < ELEMENT_COUNT; i++) {
+        dummy_element_table[i] = (struct fwk_element){
+            .name = "DUMMY",
+            .sub_element_count = SUB_ELEMENT_COUNT,
+            .data = &dummy_element_data[i],
+        };
+    }
+
+    module_table[FWK_MODULE_IDX_TEST1] = &dummy_module;
+    module_config_table[FWK_MODULE_IDX_TEST1] = &dummy_module_config;
+
+    fwk_module_reset();
+
+    status = fwk_module_start();
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static uint64_t dispatch_events(void)
+{
+    unsigned int i;
+    unsigned int element_idx;
+    uint64_t start;
+    int status;
+
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_TEST0),
+        .id = FWK_ID_EVENT(FWK_MODULE_IDX_TEST1, 0),
+    };
+
+    processed_count = 0;
+    start = get_time_ns();
+
+    for (i = 0; i < EVENT_COUNT; i++) {
+        element_idx = i % ELEMENT_COUNT;
+
+        /* Alternate between element and sub-element targets */
+        if ((i % 2) == 0) {
+            event.target_id =
+                FWK_ID_ELEMENT(FWK_MODULE_IDX_TEST1, element_idx);
+        } else {
+            event.target_id = FWK_ID_SUB_ELEMENT(
+                FWK_MODULE_IDX_TEST1, element_idx, i % SUB_ELEMENT_COUNT);
+        }
+
+        status = fwk_put_event(&event);
+        assert(status == FWK_SUCCESS);
+
+        if ((i % BURST_SIZE) == (BURST_SIZE - 1)) {
+            fwk_process_event_queue();
+        }
+    }
+
+    fwk_process_event_queue();
+
+    return get_time_ns() - start;
+}
+
+static void bench_dispatch(void)
+{
+    unsigned int round;
+    uint64_t elapsed, best = UINT64_MAX;
+
+    for (round = 0; round < ROUND_COUNT; round++) {
+        elapsed = dispatch_events();
+        assert(processed_count == EVENT_COUNT);
+
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    printf(
+        "\n    %u events: %" PRIu64 " ns/event\n",
+        (unsigned int)EVENT_COUNT,
+        best / EVENT_COUNT);
+}
+
+/*
+ * Look up the contexts of the sub-elements either through the element table
+ * of the framework or, as a reference, through the module contexts. The
+ * identifiers are valid by construction, as those held by the callers.
+ */
+static uint64_t look_up_contexts(bool through_module_ctx)
+{
+    unsigned int i;
+    uint64_t start;
+    fwk_id_t id;
+    struct fwk_element_ctx *element_ctx;
+
+    processed_count = 0;
+    start = get_time_ns();
+
+    for (i = 0; i < EVENT_COUNT; i++) {
+        id = FWK_ID_SUB_ELEMENT(
+            FWK_MODULE_IDX_TEST1, i % ELEMENT_COUNT, i % SUB_ELEMENT_COUNT);
+
+        if (through_module_ctx) {
+            element_ctx = &fwk_module_get_ctx(id)
+                               ->element_ctx_table[id.element.element_idx];
+        } else {
+            element_ctx = fwk_module_get_element_ctx(id);
+        }
+
+        if (element_ctx->desc != NULL) {
+            processed_count++;
+        }
+    }
+
+    return get_time_ns() - start;
+}
+
+/* Best time of a lookup, in tenths of nanoseconds */
+static uint64_t time_lookups(bool through_module_ctx)
+{
+    unsigned int round;
+    uint64_t elapsed, best = UINT64_MAX;
+
+    for (round = 0; round < ROUND_COUNT; round++) {
+        elapsed = look_up_contexts(through_module_ctx);
+        assert(processed_count == EVENT_COUNT);
+
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    return (best * 10) / EVENT_COUNT;
+}
+
+static void bench_element_ctx_lookup(void)
+{
+    uint64_t table_time, module_ctx_time;
+
+    assert(fwk_module_is_valid_sub_element_id(FWK_ID_SUB_ELEMENT(
+        FWK_MODULE_IDX_TEST1, ELEMENT_COUNT - 1, SUB_ELEMENT_COUNT - 1)));
+
+    table_time = time_lookups(false);
+    module_ctx_time = time_lookups(true);
+
+    printf(
+        "\n    %u lookups: %" PRIu64 ".%" PRIu64 " ns/lookup through the "
+        "element table, %" PRIu64 ".%" PRIu64 " ns/lookup through the module "
+        "contexts\n",
+        (unsigned int)EVENT_COUNT,
+        table_time / 10,
+        table_time % 10,
+        module_ctx_time / 10,
+        module_ctx_time % 10);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(bench_dispatch),
+    FWK_TEST_CASE(bench_element_ctx_lookup),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "bench_fwk_dispatch",
+    .test_suite_setup = test_suite_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
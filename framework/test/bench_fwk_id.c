@@ -0,0 +1,184 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Host benchmark of the identifier accessors used when dispatching an
+ *     event. Built as a release build, where the accessors are inlined, and
+ *     compares them against out-of-line copies as release builds used to call.
+ */
+
+#include <fwk_attributes.h>
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_test.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define EVENT_COUNT 256
+
+#define ROUND_COUNT 4000
+
+#define MODULE_COUNT 16
+
+struct bench_event {
+    fwk_id_t source_id;
+    fwk_id_t target_id;
+    fwk_id_t id;
+};
+
+static struct bench_event events[EVENT_COUNT];
+
+/*
+ * Use the time-stamp counter when the host has one, the monotonic clock
+ * otherwise.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#    define BENCH_UNIT "cycles"
+
+static uint64_t get_count(void)
+{
+    return __builtin_ia32_rdtsc();
+}
+#else
+#    define BENCH_UNIT "ns"
+
+static uint64_t get_count(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+/* Out-of-line copies of the accessors */
+static FWK_NOINLINE bool call_is_type(fwk_id_t id, enum fwk_id_type type)
+{
+    return fwk_id_is_type(id, type);
+}
+
+static FWK_NOINLINE bool call_is_equal(fwk_id_t left, fwk_id_t right)
+{
+    return fwk_id_is_equal(left, right);
+}
+
+static FWK_NOINLINE unsigned int call_get_module_idx(fwk_id_t id)
+{
+    return fwk_id_get_module_idx(id);
+}
+
+static FWK_NOINLINE unsigned int call_get_element_idx(fwk_id_t id)
+{
+    return fwk_id_get_element_idx(id);
+}
+
+static FWK_NOINLINE fwk_id_t call_build_module_id(fwk_id_t id)
+{
+    return fwk_id_build_module_id(id);
+}
+
+static FWK_NOINLINE fwk_id_t
+call_build_element_id(fwk_id_t id, unsigned int element_idx)
+{
+    return fwk_id_build_element_id(id, element_idx);
+}
+
+/*
+ * Decode the identifiers of an event the way the event loop and the context
+ * lookup of a module do before calling its event handler.
+ */
+#define DISPATCH(PREFIX, EVENT, SUM) \
+    do { \
+        unsigned int idx = PREFIX##get_module_idx((EVENT)->target_id); \
+        fwk_id_t source_id = PREFIX##build_module_id((EVENT)->source_id); \
+        if (PREFIX##is_type((EVENT)->target_id, FWK_ID_TYPE_ELEMENT)) { \
+            idx += PREFIX##get_element_idx((EVENT)->target_id); \
+            idx += PREFIX##get_element_idx(PREFIX##build_element_id( \
+                (EVENT)->source_id, idx)); \
+        } \
+        if (PREFIX##is_equal((EVENT)->id, FWK_ID_EVENT(0, 1))) { \
+            idx++; \
+        } \
+        if (PREFIX##is_equal(source_id, (EVENT)->target_id)) { \
+            idx++; \
+        } \
+        (SUM) += idx; \
+    } while (0)
+
+static int test_suite_setup(void)
+{
+    unsigned int i;
+    unsigned int module_idx;
+
+    for (i = 0; i < EVENT_COUNT; i++) {
+        module_idx = i % MODULE_COUNT;
+
+        events[i].source_id = FWK_ID_MODULE((module_idx + 1) % MODULE_COUNT);
+        events[i].id = FWK_ID_EVENT(module_idx, i % 3);
+
+        if ((i % 2) == 0) {
+            events[i].target_id = FWK_ID_ELEMENT(module_idx, i / 2);
+        } else {
+            events[i].target_id = FWK_ID_MODULE(module_idx);
+        }
+    }
+
+    return 0;
+}
+
+static void bench_id_dispatch(void)
+{
+    unsigned int round, i;
+    uint64_t start, call_count = 0, inline_count = 0;
+    volatile unsigned int call_sum = 0, inline_sum = 0;
+    unsigned int sum;
+
+    for (round = 0; round < ROUND_COUNT; round++) {
+        sum = 0;
+        start = get_count();
+        for (i = 0; i < EVENT_COUNT; i++) {
+            DISPATCH(call_, &events[i], sum);
+        }
+        call_count += get_count() - start;
+        call_sum += sum;
+
+        sum = 0;
+        start = get_count();
+        for (i = 0; i < EVENT_COUNT; i++) {
+            DISPATCH(fwk_id_, &events[i], sum);
+        }
+        inline_count += get_count() - start;
+        inline_sum += sum;
+    }
+
+    printf(
+        "\n    out-of-line: %" PRIu64 " " BENCH_UNIT "/100 dispatches, "
+        "inline: %" PRIu64 " " BENCH_UNIT "/100 dispatches\n",
+        (call_count * 100) / (ROUND_COUNT * EVENT_COUNT),
+        (inline_count * 100) / (ROUND_COUNT * EVENT_COUNT));
+
+    /* Assertions are disabled in release builds */
+    if (call_sum != inline_sum) {
+        exit(EXIT_FAILURE);
+    }
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(bench_id_dispatch),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "bench_fwk_id",
+    .test_suite_setup = test_suite_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
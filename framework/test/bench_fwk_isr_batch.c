@@ -0,0 +1,185 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Host benchmark of the transfer of the events raised by interrupt handlers
+ *     to the event queue. Built once moving the whole ISR event queue at once
+ *     and once moving a single event per critical section, as the framework
+ *     used to.
+ */
+
+#include <internal/fwk_context.h>
+#include <internal/fwk_core.h>
+#include <internal/fwk_module.h>
+
+#include <fwk_assert.h>
+#include <fwk_core.h>
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Number of events raised by interrupt handlers between two drains */
+#define BURST_SIZE 64
+
+#define ROUND_COUNT 2000
+
+static struct __fwk_ctx *ctx;
+
+static struct fwk_module fake_module_desc[FWK_MODULE_IDX_COUNT];
+static const struct fwk_module_config fake_module_config;
+static struct fwk_module_context fake_module_ctx[FWK_MODULE_IDX_COUNT];
+
+static bool is_interrupt_context;
+
+/* Critical section accounting */
+static unsigned int critical_section_count;
+static uint64_t critical_section_start;
+static uint64_t masked_time;
+
+static unsigned int processed_count;
+
+static uint64_t get_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/* Mock functions */
+void *__wrap_fwk_mm_calloc(size_t num, size_t size)
+{
+    return calloc(num, size);
+}
+
+struct fwk_module_context *__wrap_fwk_module_get_ctx(fwk_id_t id)
+{
+    return &fake_module_ctx[fwk_id_get_module_idx(id)];
+}
+
+bool __wrap_fwk_module_is_valid_entity_id(fwk_id_t id)
+{
+    return true;
+}
+
+bool __wrap_fwk_module_is_valid_event_id(fwk_id_t id)
+{
+    return true;
+}
+
+void test_critical_section_enter(void)
+{
+    critical_section_count++;
+    critical_section_start = get_time_ns();
+}
+
+void test_critical_section_exit(void)
+{
+    masked_time += get_time_ns() - critical_section_start;
+}
+
+bool __wrap_fwk_is_interrupt_context(void)
+{
+    return is_interrupt_context;
+}
+
+static int process_event(
+    const struct fwk_event *event,
+    struct fwk_event *response_event)
+{
+    processed_count++;
+
+    return FWK_SUCCESS;
+}
+
+static int test_suite_setup(void)
+{
+    unsigned int i;
+
+    ctx = __fwk_get_ctx();
+
+    for (i = 0; i < FWK_MODULE_IDX_COUNT; i++) {
+        fake_module_desc[i].process_event = process_event;
+        fake_module_ctx[i].desc = &fake_module_desc[i];
+        fake_module_ctx[i].config = &fake_module_config;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static void raise_isr_events(void)
+{
+    unsigned int i;
+    int result;
+
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_TEST0),
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_TEST1),
+        .id = FWK_ID_EVENT(FWK_MODULE_IDX_TEST1, 0),
+    };
+
+    is_interrupt_context = true;
+    for (i = 0; i < BURST_SIZE; i++) {
+        result = fwk_put_event(&event);
+        assert(result == FWK_SUCCESS);
+    }
+    is_interrupt_context = false;
+}
+
+static void bench_isr_event_transfer(void)
+{
+    unsigned int round;
+    uint64_t start, process_time = 0;
+    int result;
+
+    result = __fwk_init(BURST_SIZE);
+    assert(result == FWK_SUCCESS);
+
+    for (round = 0; round < ROUND_COUNT; round++) {
+        raise_isr_events();
+
+        /* Only account for the critical sections of the event loop */
+        critical_section_count = 0;
+        masked_time = 0;
+
+        start = get_time_ns();
+        fwk_process_event_queue();
+        process_time += get_time_ns() - start;
+    }
+
+    assert(processed_count == (BURST_SIZE * ROUND_COUNT));
+
+    printf(
+        "\n    batch max %u: %" PRIu64 " events/s, "
+        "%u critical sections and %" PRIu64 " ns masked per burst of %u\n",
+        (unsigned int)FMW_ISR_EVENT_BATCH_MAX,
+        ((uint64_t)processed_count * UINT64_C(1000000000)) / (process_time + 1),
+        critical_section_count,
+        masked_time,
+        BURST_SIZE);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(bench_isr_event_transfer),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "bench_fwk_isr_batch",
+    .test_suite_setup = test_suite_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
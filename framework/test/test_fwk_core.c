@@ -15,6 +15,7 @@
 #include <fwk_macros.h>
 #include <fwk_slist.h>
 #include <fwk_status.h>
+#include <fwk_string.h>
 #include <fwk_test.h>
 
 #include <setjmp.h>
@@ -38,6 +39,7 @@ void *__wrap_fwk_mm_calloc(size_t num, size_t size)
 }
 
 static struct fwk_module fake_module_desc;
+static const struct fwk_module_config fake_module_config;
 static struct fwk_module_context fake_module_ctx;
 struct fwk_module_context *__wrap_fwk_module_get_ctx(fwk_id_t id)
 {
@@ -107,12 +109,20 @@ static int process_event(
 }
 
 static const struct fwk_event *processed_notification;
+static fwk_id_t notification_target_table[4];
+static unsigned int notification_target_count;
 
 static int process_notification(
     const struct fwk_event *event,
     struct fwk_event *response_event)
 {
     processed_notification = event;
+
+    if (notification_target_count < FWK_ARRAY_SIZE(notification_target_table)) {
+        notification_target_table[notification_target_count++] =
+            event->target_id;
+    }
+
     return FWK_SUCCESS;
 }
 
@@ -122,6 +132,7 @@ static int test_suite_setup(void)
     fake_module_desc.process_event = process_event;
     fake_module_desc.process_notification = process_notification;
     fake_module_ctx.desc = &fake_module_desc;
+    fake_module_ctx.config = &fake_module_config;
     return FWK_SUCCESS;
 }
 
@@ -135,6 +146,7 @@ static void test_case_setup(void)
     fwk_mm_calloc_return_val = true;
     fake_module_desc.process_event = process_event;
     fake_module_ctx.desc = &fake_module_desc;
+    notification_target_count = 0;
 }
 
 static void test_case_teardown(void)
@@ -274,12 +286,12 @@ static void test___fwk_run_main_loop(void)
     assert(fwk_id_is_equal(processed_event->target_id, FWK_ID_MODULE(0x1)));
     assert(fwk_id_is_equal(processed_event->id, FWK_ID_EVENT(0x2, 0x7)));
 
-    /* Extract ISR Event3 and process it */
+    /* Extract both ISR events at once and process Event3 */
     if (setjmp(test_context) == FWK_SUCCESS)
         __fwk_run_main_loop();
-    assert(ctx->isr_event_queue.head == &(notification1.slist_node));
-    assert(ctx->isr_event_queue.tail == &(notification1.slist_node));
-    assert(fwk_list_is_empty(&ctx->event_queue));
+    assert(fwk_list_is_empty(&ctx->isr_event_queue));
+    assert(ctx->event_queue.head == &(notification1.slist_node));
+    assert(ctx->event_queue.tail == &(notification1.slist_node));
 
     free_event = FWK_LIST_GET(
         fwk_list_pop_head(&ctx->free_event_queue),
@@ -291,7 +303,7 @@ static void test___fwk_run_main_loop(void)
     assert(processed_event->response_requested == false);
     assert(processed_event->is_notification == false);
 
-    /* Extract ISR Notification1 and process it */
+    /* Process ISR Notification1 */
     free_event_queue_break = false;
     fwk_list_push_tail(&ctx->free_event_queue, &(allocated_event->slist_node));
     free_event_queue_break = true;
@@ -405,7 +417,7 @@ static void test_fwk_put_event(void)
 static void test_fwk_put_event_light(void)
 {
     int result;
-    struct fwk_event *result_event;
+    struct __fwk_light_event *result_event;
 
     struct fwk_event_light event1 = {
         .source_id = FWK_ID_MODULE(0x1),
@@ -448,31 +460,111 @@ static void test_fwk_put_event_light(void)
     /* Valid event id */
     result = fwk_put_event(&event1);
     assert(result == FWK_SUCCESS);
-    /* Framework always queue light event by converting in a standard event */
+    /* Light events are queued in their compact form */
     result_event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx->event_queue), struct fwk_event, slist_node);
-    assert(fwk_id_is_equal(result_event->source_id, event1.source_id));
-    assert(fwk_id_is_equal(result_event->target_id, event1.target_id));
-    assert(result_event->is_response == false);
-    assert(result_event->response_requested == event1.response_requested);
-    assert(result_event->is_notification == false);
+        fwk_list_pop_head(&ctx->event_queue),
+        struct __fwk_light_event,
+        slist_node);
+    assert(result_event == &ctx->light_event_table[0]);
+    assert(fwk_id_is_equal(result_event->event.source_id, event1.source_id));
+    assert(fwk_id_is_equal(result_event->event.target_id, event1.target_id));
+    assert(fwk_id_is_equal(result_event->event.id, event1.id));
+    assert(result_event->event.response_requested == true);
 
     event2.id = FWK_ID_EVENT(0x4, 7);
     interrupt_get_current_return_val = true;
     result = fwk_put_event(&event2);
     assert(result == FWK_SUCCESS);
+
+    /* The event pool is left untouched */
+    assert(ctx->free_event_queue.head != NULL);
+    assert(ctx->event_used_count == 0);
+
+    result_event = FWK_LIST_GET(
+        fwk_list_pop_head(&ctx->isr_event_queue),
+        struct __fwk_light_event,
+        slist_node);
+    assert(result_event == &ctx->light_event_table[1]);
+    assert(fwk_id_is_equal(result_event->event.source_id, event2.source_id));
+    assert(fwk_id_is_equal(result_event->event.target_id, event2.target_id));
+    assert(result_event->event.response_requested == false);
+}
+
+static void test_fwk_put_event_light_pool_exhausted(void)
+{
+    int result;
+    unsigned int i;
+    struct fwk_event *result_event;
+
+    struct fwk_event_light event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .response_requested = true,
+        .id = FWK_ID_EVENT(0x2, 7),
+    };
+
+    result = __fwk_init(1);
+    assert(result == FWK_SUCCESS);
+
+    for (i = 0; i < ctx->light_event_count; i++) {
+        result = fwk_put_event(&event);
+        assert(result == FWK_SUCCESS);
+    }
+    assert(fwk_list_is_empty(&ctx->free_light_event_queue));
+
+    /* The light event is expanded in the event pool */
+    result = fwk_put_event(&event);
+    assert(result == FWK_SUCCESS);
     assert(fwk_list_is_empty(&ctx->free_event_queue));
 
-    /* Framework always queue light event by converting in a standard event */
     result_event = FWK_LIST_GET(
-        fwk_list_pop_head(&ctx->isr_event_queue), struct fwk_event, slist_node);
-    assert(fwk_id_is_equal(result_event->source_id, event2.source_id));
-    assert(fwk_id_is_equal(result_event->target_id, event2.target_id));
+        ctx->event_queue.tail, struct fwk_event, slist_node);
+    assert(fwk_id_is_equal(result_event->source_id, event.source_id));
+    assert(fwk_id_is_equal(result_event->target_id, event.target_id));
     assert(result_event->is_response == false);
-    assert(result_event->response_requested == event2.response_requested);
+    assert(result_event->response_requested == true);
     assert(result_event->is_notification == false);
 }
 
+static void test_fwk_process_event_light(void)
+{
+    int result;
+    struct fwk_event *response_event;
+
+    struct fwk_event_light event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .target_id = FWK_ID_MODULE(0x2),
+        .response_requested = true,
+        .id = FWK_ID_EVENT(0x2, 7),
+    };
+
+    result = __fwk_init(1);
+    assert(result == FWK_SUCCESS);
+
+    result = fwk_put_event(&event);
+    assert(result == FWK_SUCCESS);
+
+    response_event = FWK_LIST_GET(
+        fwk_list_head(&ctx->free_event_queue), struct fwk_event, slist_node);
+    fwk_str_memset(response_event->params, 0xFF, FWK_EVENT_PARAMETERS_SIZE);
+
+    fwk_process_event_queue();
+
+    /* The handler was given the light event expanded in place */
+    assert(fwk_id_is_equal(ctx->light_dispatch_event.id, event.id));
+    assert(
+        ctx->free_light_event_queue.tail ==
+        &ctx->light_event_table[0].slist_node);
+
+    /* The response was built in place in the event pool */
+    assert(processed_event == response_event);
+    assert(processed_event->is_response == true);
+    assert(processed_event->response_requested == false);
+    assert(fwk_id_is_equal(processed_event->source_id, event.target_id));
+    assert(fwk_id_is_equal(processed_event->target_id, event.source_id));
+    assert(processed_event->params[0] == 0);
+}
+
 static void test___fwk_put_notification(void)
 {
     int result;
@@ -520,12 +612,124 @@ static void test___fwk_put_notification(void)
     assert(result_event->is_notification == true);
 }
 
+static void test___fwk_put_notification_fanout(void)
+{
+    int result;
+    unsigned int count, i;
+    struct __fwk_notification_handle *handle[3];
+    struct fwk_event *shared_event;
+
+    const fwk_id_t target_table[] = {
+        FWK_ID_MODULE(0x2),
+        FWK_ID_MODULE(0x3),
+        FWK_ID_ELEMENT(0x4, 0x1),
+    };
+
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .id = FWK_ID_NOTIFICATION(0x1, 0x3),
+        .params = { 0xA5 },
+    };
+
+    result = __fwk_init(2);
+    assert(result == FWK_SUCCESS);
+
+    __fwk_put_notification_fanout(
+        &event, target_table, FWK_ARRAY_SIZE(target_table), &count);
+    assert(count == FWK_ARRAY_SIZE(target_table));
+
+    /* A single event of the pool is shared by all the targets */
+    assert(ctx->event_used_count == 1);
+
+    for (i = 0; i < FWK_ARRAY_SIZE(target_table); i++) {
+        handle[i] = FWK_LIST_GET(
+            fwk_list_pop_head(&ctx->event_queue),
+            struct __fwk_notification_handle,
+            slist_node);
+        assert(handle[i] == &ctx->notification_handle_table[i]);
+        assert(fwk_id_is_equal(handle[i]->target_id, target_table[i]));
+        assert(handle[i]->event == handle[0]->event);
+    }
+    assert(fwk_list_is_empty(&ctx->event_queue));
+    assert(handle[1]->cookie == (handle[0]->cookie + 1));
+    assert(event.cookie == handle[2]->cookie);
+
+    shared_event = handle[0]->event;
+    assert(shared_event->is_notification == true);
+    assert(shared_event->is_response == false);
+    assert(shared_event->params[0] == 0xA5);
+    assert(ctx->event_ref_count_table[shared_event - ctx->event_table] == 3);
+
+    for (i = 0; i < FWK_ARRAY_SIZE(target_table); i++) {
+        fwk_list_push_tail(&ctx->event_queue, &handle[i]->slist_node);
+    }
+
+    fwk_process_event_queue();
+
+    /* Each target was given the shared event, freed after the last one */
+    assert(notification_target_count == FWK_ARRAY_SIZE(target_table));
+    for (i = 0; i < FWK_ARRAY_SIZE(target_table); i++) {
+        assert(fwk_id_is_equal(notification_target_table[i], target_table[i]));
+    }
+    assert(processed_notification == shared_event);
+    assert(ctx->event_used_count == 0);
+    assert(ctx->free_event_queue.tail == &shared_event->slist_node);
+    assert(ctx->free_notification_handle_queue.tail == &handle[2]->slist_node);
+}
+
+static void test___fwk_put_notification_fanout_exhausted(void)
+{
+    int result;
+    unsigned int count, i;
+    struct fwk_event *result_event;
+
+    const fwk_id_t target_table[] = {
+        FWK_ID_MODULE(0x2),
+        FWK_ID_MODULE(0x3),
+    };
+
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(0x1),
+        .id = FWK_ID_NOTIFICATION(0x1, 0x3),
+    };
+
+    result = __fwk_init(2);
+    assert(result == FWK_SUCCESS);
+
+    /* Leave a single notification handle */
+    for (i = 1; i < ctx->notification_handle_count; i++) {
+        (void)fwk_list_pop_head(&ctx->free_notification_handle_queue);
+    }
+
+    interrupt_get_current_return_val = true;
+    __fwk_put_notification_fanout(
+        &event, target_table, FWK_ARRAY_SIZE(target_table), &count);
+    assert(count == FWK_ARRAY_SIZE(target_table));
+
+    /* The second target is sent its own copy of the notification */
+    assert(ctx->event_used_count == 2);
+    assert(fwk_list_is_empty(&ctx->free_notification_handle_queue));
+
+    result_event = FWK_LIST_GET(
+        ctx->isr_event_queue.tail, struct fwk_event, slist_node);
+    assert(fwk_id_is_equal(result_event->target_id, target_table[1]));
+    assert(result_event->is_notification == true);
+
+    /* The event pool is exhausted, the notification is lost */
+    __fwk_put_notification_fanout(&event, target_table, 1, &count);
+    assert(count == 0);
+}
+
 static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test___fwk_init),
     FWK_TEST_CASE(test___fwk_run_main_loop),
     FWK_TEST_CASE(test_fwk_put_event),
     FWK_TEST_CASE(test_fwk_put_event_light),
-    FWK_TEST_CASE(test___fwk_put_notification)
+    FWK_TEST_CASE(test_fwk_put_event_light_pool_exhausted),
+    FWK_TEST_CASE(test_fwk_process_event_light),
+    FWK_TEST_CASE(test___fwk_put_notification),
+    FWK_TEST_CASE(test___fwk_put_notification_fanout),
+    FWK_TEST_CASE(test___fwk_put_notification_fanout_exhausted),
 };
 
 struct fwk_test_suite_desc test_suite = {
@@ -0,0 +1,353 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <internal/fwk_context.h>
+#include <internal/fwk_core.h>
+#include <internal/fwk_module.h>
+
+#include <fwk_assert.h>
+#include <fwk_core.h>
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_list.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define MODULE_RESERVED FWK_MODULE_IDX_TEST0
+#define MODULE_SHARED FWK_MODULE_IDX_TEST1
+#define MODULE_TARGET FWK_MODULE_IDX_TEST2
+#define MODULE_COUNT FWK_MODULE_IDX_COUNT
+
+#define RESERVED_QUOTA 2
+#define SHARED_EVENT_COUNT 2
+#define EVENT_COUNT (RESERVED_QUOTA + SHARED_EVENT_COUNT)
+
+static struct __fwk_ctx *ctx;
+
+static struct fwk_module fake_module_desc[MODULE_COUNT];
+static struct fwk_module_config fake_module_config[MODULE_COUNT];
+static struct fwk_module_context fake_module_ctx[MODULE_COUNT];
+
+static unsigned int processed_count;
+static unsigned int response_count;
+
+/* Mock functions */
+void *__wrap_fwk_mm_calloc(size_t num, size_t size)
+{
+    return calloc(num, size);
+}
+
+struct fwk_module_context *__wrap_fwk_module_get_ctx(fwk_id_t id)
+{
+    return &fake_module_ctx[fwk_id_get_module_idx(id)];
+}
+
+bool __wrap_fwk_module_is_valid_module_id(fwk_id_t id)
+{
+    return fwk_id_is_type(id, FWK_ID_TYPE_MODULE) &&
+        (fwk_id_get_module_idx(id) < MODULE_COUNT);
+}
+
+bool __wrap_fwk_module_is_valid_entity_id(fwk_id_t id)
+{
+    return true;
+}
+
+bool __wrap_fwk_module_is_valid_event_id(fwk_id_t id)
+{
+    return true;
+}
+
+int __wrap_fwk_interrupt_global_enable(void)
+{
+    return FWK_SUCCESS;
+}
+
+int __wrap_fwk_interrupt_global_disable(void)
+{
+    return FWK_SUCCESS;
+}
+
+bool __wrap_fwk_is_interrupt_context(void)
+{
+    return false;
+}
+
+static int process_event(
+    const struct fwk_event *event,
+    struct fwk_event *response_event)
+{
+    processed_count++;
+
+    if (event->is_response) {
+        response_count++;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int test_suite_setup(void)
+{
+    unsigned int i;
+
+    ctx = __fwk_get_ctx();
+
+    for (i = 0; i < MODULE_COUNT; i++) {
+        fake_module_desc[i].process_event = process_event;
+        fake_module_ctx[i].desc = &fake_module_desc[i];
+        fake_module_ctx[i].config = &fake_module_config[i];
+    }
+
+    return FWK_SUCCESS;
+}
+
+static void test_case_setup(void)
+{
+    fake_module_config[MODULE_RESERVED].event_quota = RESERVED_QUOTA;
+    fake_module_config[MODULE_SHARED].event_quota = 0;
+    fake_module_config[MODULE_TARGET].event_quota = 0;
+    processed_count = 0;
+    response_count = 0;
+}
+
+static void test_case_teardown(void)
+{
+    *ctx = (struct __fwk_ctx){};
+}
+
+static int send_event(unsigned int module_idx)
+{
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(module_idx),
+        .target_id = FWK_ID_MODULE(MODULE_TARGET),
+        .id = FWK_ID_EVENT(MODULE_TARGET, 0),
+    };
+
+    return fwk_put_event(&event);
+}
+
+static void assert_stats(
+    fwk_id_t id,
+    unsigned int event_count,
+    unsigned int used_count,
+    unsigned int peak_count,
+    unsigned int busy_count)
+{
+    int result;
+    struct fwk_event_pool_stats stats;
+
+    result = fwk_get_event_pool_stats(id, &stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.event_count == event_count);
+    assert(stats.used_count == used_count);
+    assert(stats.peak_count == peak_count);
+    assert(stats.busy_count == busy_count);
+}
+
+static void test_pool_quota_exhausted(void)
+{
+    int result;
+    unsigned int i;
+
+    result = __fwk_init(EVENT_COUNT);
+    assert(result == FWK_SUCCESS);
+
+    /* The reserved events are used first, then the shared ones */
+    for (i = 0; i < EVENT_COUNT; i++) {
+        result = send_event(MODULE_RESERVED);
+        assert(result == FWK_SUCCESS);
+    }
+
+    result = send_event(MODULE_RESERVED);
+    assert(result == FWK_E_BUSY);
+
+    result = send_event(MODULE_SHARED);
+    assert(result == FWK_E_BUSY);
+
+    assert_stats(FWK_ID_NONE, EVENT_COUNT, EVENT_COUNT, EVENT_COUNT, 2);
+    assert_stats(
+        FWK_ID_MODULE(MODULE_RESERVED),
+        RESERVED_QUOTA,
+        EVENT_COUNT,
+        EVENT_COUNT,
+        1);
+    assert_stats(FWK_ID_MODULE(MODULE_SHARED), 0, 0, 0, 1);
+
+    fwk_process_event_queue();
+
+    assert(processed_count == EVENT_COUNT);
+    assert_stats(FWK_ID_NONE, EVENT_COUNT, 0, EVENT_COUNT, 2);
+    assert_stats(
+        FWK_ID_MODULE(MODULE_RESERVED), RESERVED_QUOTA, 0, EVENT_COUNT, 1);
+
+    /* The events are available again once freed */
+    result = send_event(MODULE_SHARED);
+    assert(result == FWK_SUCCESS);
+}
+
+static void test_pool_quota_reserved(void)
+{
+    int result;
+    unsigned int i;
+
+    result = __fwk_init(EVENT_COUNT);
+    assert(result == FWK_SUCCESS);
+
+    /* A module without quota cannot use the reserved events */
+    for (i = 0; i < SHARED_EVENT_COUNT; i++) {
+        result = send_event(MODULE_SHARED);
+        assert(result == FWK_SUCCESS);
+    }
+
+    result = send_event(MODULE_SHARED);
+    assert(result == FWK_E_BUSY);
+
+    for (i = 0; i < RESERVED_QUOTA; i++) {
+        result = send_event(MODULE_RESERVED);
+        assert(result == FWK_SUCCESS);
+    }
+
+    result = send_event(MODULE_RESERVED);
+    assert(result == FWK_E_BUSY);
+
+    assert(fwk_list_is_empty(&ctx->free_event_queue));
+
+    fwk_process_event_queue();
+
+    assert(processed_count == EVENT_COUNT);
+    assert(ctx->shared_event_used_count == 0);
+    assert_stats(FWK_ID_MODULE(MODULE_SHARED), 0, 0, SHARED_EVENT_COUNT, 1);
+}
+
+static void test_pool_quota_response(void)
+{
+    int result;
+    unsigned int i;
+    struct fwk_event request = {
+        .source_id = FWK_ID_MODULE(MODULE_SHARED),
+        .target_id = FWK_ID_MODULE(MODULE_RESERVED),
+        .id = FWK_ID_EVENT(MODULE_RESERVED, 0),
+        .response_requested = true,
+    };
+
+    /* The requester reserves an event for the response to its request */
+    fake_module_config[MODULE_SHARED].event_quota = 2;
+
+    result = __fwk_init(EVENT_COUNT + 2);
+    assert(result == FWK_SUCCESS);
+
+    result = fwk_put_event(&request);
+    assert(result == FWK_SUCCESS);
+
+    /* The responder exhausts its quota and the shared events */
+    for (i = 0; i < EVENT_COUNT; i++) {
+        result = send_event(MODULE_RESERVED);
+        assert(result == FWK_SUCCESS);
+    }
+
+    result = send_event(MODULE_RESERVED);
+    assert(result == FWK_E_BUSY);
+
+    /* The response is charged to the requester and is not lost */
+    fwk_process_event_queue();
+
+    assert(response_count == 1);
+    assert(processed_count == EVENT_COUNT + 2);
+    assert_stats(FWK_ID_MODULE(MODULE_SHARED), 2, 0, 2, 0);
+    assert_stats(
+        FWK_ID_MODULE(MODULE_RESERVED), RESERVED_QUOTA, 0, EVENT_COUNT, 1);
+}
+
+static void test_pool_quota_response_beyond_quota(void)
+{
+    int result;
+    unsigned int i;
+    struct fwk_event request = {
+        .source_id = FWK_ID_MODULE(MODULE_SHARED),
+        .target_id = FWK_ID_MODULE(MODULE_TARGET),
+        .id = FWK_ID_EVENT(MODULE_TARGET, 0),
+        .response_requested = true,
+    };
+
+    /* An event of the pool is left free, reserved to another module */
+    fake_module_config[MODULE_TARGET].event_quota = 1;
+
+    result = __fwk_init(EVENT_COUNT + 2);
+    assert(result == FWK_SUCCESS);
+
+    result = fwk_put_event(&request);
+    assert(result == FWK_SUCCESS);
+
+    /* The requester is beyond its quota and the shared events are exhausted */
+    for (i = 0; i < EVENT_COUNT; i++) {
+        result = send_event(MODULE_RESERVED);
+        assert(result == FWK_SUCCESS);
+    }
+
+    result = send_event(MODULE_SHARED);
+    assert(result == FWK_E_BUSY);
+
+    /* The response is not throttled while the event pool is not empty */
+    fwk_process_event_queue();
+
+    assert(response_count == 1);
+    assert(ctx->shared_event_used_count == 0);
+    assert_stats(FWK_ID_MODULE(MODULE_SHARED), 0, 0, 2, 1);
+}
+
+static void test_pool_quota_too_large(void)
+{
+    int result;
+
+    fake_module_config[MODULE_RESERVED].event_quota = EVENT_COUNT + 1;
+
+    result = __fwk_init(EVENT_COUNT);
+    assert(result == FWK_E_NOMEM);
+}
+
+static void test_pool_stats_param(void)
+{
+    int result;
+    struct fwk_event_pool_stats stats;
+
+    result = fwk_get_event_pool_stats(FWK_ID_NONE, &stats);
+    assert(result == FWK_E_INIT);
+
+    result = __fwk_init(EVENT_COUNT);
+    assert(result == FWK_SUCCESS);
+
+    result = fwk_get_event_pool_stats(FWK_ID_NONE, NULL);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_get_event_pool_stats(FWK_ID_ELEMENT(MODULE_TARGET, 0), &stats);
+    assert(result == FWK_E_PARAM);
+
+    assert_stats(FWK_ID_NONE, EVENT_COUNT, 0, 0, 0);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_pool_quota_exhausted),
+    FWK_TEST_CASE(test_pool_quota_reserved),
+    FWK_TEST_CASE(test_pool_quota_response),
+    FWK_TEST_CASE(test_pool_quota_response_beyond_quota),
+    FWK_TEST_CASE(test_pool_quota_too_large),
+    FWK_TEST_CASE(test_pool_stats_param),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_core_pool",
+    .test_suite_setup = test_suite_setup,
+    .test_case_setup = test_case_setup,
+    .test_case_teardown = test_case_teardown,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
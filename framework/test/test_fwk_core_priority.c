@@ -0,0 +1,296 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <internal/fwk_context.h>
+#include <internal/fwk_core.h>
+#include <internal/fwk_module.h>
+
+#include <fwk_assert.h>
+#include <fwk_core.h>
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_list.h>
+#include <fwk_macros.h>
+#include <fwk_slist.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define MODULE_NORMAL 0
+#define MODULE_HIGH 1
+#define MODULE_LOW 2
+#define MODULE_TABLE 3
+#define MODULE_COUNT 4
+
+#define PROCESSED_MAX 32
+
+static struct __fwk_ctx *ctx;
+
+static struct fwk_module fake_module_desc[MODULE_COUNT];
+static const struct fwk_module_config fake_module_config;
+static struct fwk_module_context fake_module_ctx[MODULE_COUNT];
+
+static const enum fwk_event_priority table_event_priority[] = {
+    FWK_EVENT_PRIORITY_LOW,
+    FWK_EVENT_PRIORITY_HIGH,
+};
+
+static fwk_id_t processed_id[PROCESSED_MAX];
+static bool processed_is_response[PROCESSED_MAX];
+static unsigned int processed_count;
+
+/* Mock functions */
+void *__wrap_fwk_mm_calloc(size_t num, size_t size)
+{
+    return calloc(num, size);
+}
+
+struct fwk_module_context *__wrap_fwk_module_get_ctx(fwk_id_t id)
+{
+    return &fake_module_ctx[fwk_id_get_module_idx(id)];
+}
+
+bool __wrap_fwk_module_is_valid_entity_id(fwk_id_t id)
+{
+    return true;
+}
+
+bool __wrap_fwk_module_is_valid_event_id(fwk_id_t id)
+{
+    return true;
+}
+
+int __wrap_fwk_interrupt_global_enable(void)
+{
+    return FWK_SUCCESS;
+}
+
+int __wrap_fwk_interrupt_global_disable(void)
+{
+    return FWK_SUCCESS;
+}
+
+static bool interrupt_get_current_return_val;
+bool __wrap_fwk_is_interrupt_context(void)
+{
+    return interrupt_get_current_return_val;
+}
+
+static int process_event(
+    const struct fwk_event *event,
+    struct fwk_event *response_event)
+{
+    assert(processed_count < PROCESSED_MAX);
+
+    processed_id[processed_count] = event->id;
+    processed_is_response[processed_count] = event->is_response;
+    processed_count++;
+
+    return FWK_SUCCESS;
+}
+
+static int test_suite_setup(void)
+{
+    unsigned int i;
+
+    ctx = __fwk_get_ctx();
+
+    for (i = 0; i < MODULE_COUNT; i++) {
+        fake_module_desc[i].event_count = 2;
+        fake_module_desc[i].process_event = process_event;
+        fake_module_ctx[i].desc = &fake_module_desc[i];
+        fake_module_ctx[i].config = &fake_module_config;
+    }
+
+    fake_module_desc[MODULE_NORMAL].event_priority = FWK_EVENT_PRIORITY_NORMAL;
+    fake_module_desc[MODULE_HIGH].event_priority = FWK_EVENT_PRIORITY_HIGH;
+    fake_module_desc[MODULE_LOW].event_priority = FWK_EVENT_PRIORITY_LOW;
+    fake_module_desc[MODULE_TABLE].event_priority = FWK_EVENT_PRIORITY_NORMAL;
+    fake_module_desc[MODULE_TABLE].event_priority_table = table_event_priority;
+
+    return FWK_SUCCESS;
+}
+
+static void test_case_setup(void)
+{
+    interrupt_get_current_return_val = false;
+    processed_count = 0;
+}
+
+static void test_case_teardown(void)
+{
+    *ctx = (struct __fwk_ctx){};
+}
+
+static void put_test_event(unsigned int module_idx, unsigned int event_idx)
+{
+    int result;
+
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(MODULE_NORMAL),
+        .target_id = FWK_ID_MODULE(module_idx),
+        .id = FWK_ID_EVENT(module_idx, event_idx),
+    };
+
+    result = fwk_put_event(&event);
+    assert(result == FWK_SUCCESS);
+}
+
+static void assert_processed(
+    unsigned int position,
+    unsigned int module_idx,
+    unsigned int event_idx)
+{
+    assert(position < processed_count);
+    assert(fwk_id_is_equal(
+        processed_id[position], FWK_ID_EVENT(module_idx, event_idx)));
+}
+
+static void test_priority_order(void)
+{
+    int result;
+
+    result = __fwk_init(8);
+    assert(result == FWK_SUCCESS);
+
+    put_test_event(MODULE_LOW, 0);
+    put_test_event(MODULE_NORMAL, 0);
+    put_test_event(MODULE_HIGH, 0);
+    put_test_event(MODULE_NORMAL, 1);
+    put_test_event(MODULE_HIGH, 1);
+
+    assert(fwk_list_is_empty(&ctx->isr_event_queue));
+
+    fwk_process_event_queue();
+
+    assert(processed_count == 5);
+    assert_processed(0, MODULE_HIGH, 0);
+    assert_processed(1, MODULE_HIGH, 1);
+    assert_processed(2, MODULE_NORMAL, 0);
+    assert_processed(3, MODULE_NORMAL, 1);
+    assert_processed(4, MODULE_LOW, 0);
+}
+
+static void test_priority_event_table(void)
+{
+    int result;
+
+    result = __fwk_init(4);
+    assert(result == FWK_SUCCESS);
+
+    put_test_event(MODULE_TABLE, 0);
+    put_test_event(MODULE_NORMAL, 0);
+    put_test_event(MODULE_TABLE, 1);
+
+    fwk_process_event_queue();
+
+    assert(processed_count == 3);
+    assert_processed(0, MODULE_TABLE, 1);
+    assert_processed(1, MODULE_NORMAL, 0);
+    assert_processed(2, MODULE_TABLE, 0);
+}
+
+static void test_priority_isr_event(void)
+{
+    int result;
+
+    result = __fwk_init(4);
+    assert(result == FWK_SUCCESS);
+
+    put_test_event(MODULE_NORMAL, 0);
+
+    interrupt_get_current_return_val = true;
+    put_test_event(MODULE_HIGH, 0);
+    put_test_event(MODULE_LOW, 0);
+    interrupt_get_current_return_val = false;
+
+    put_test_event(MODULE_NORMAL, 1);
+
+    fwk_process_event_queue();
+
+    /* ISR events are only classified once moved to the event queues */
+    assert(processed_count == 4);
+    assert_processed(0, MODULE_NORMAL, 0);
+    assert_processed(1, MODULE_NORMAL, 1);
+    assert_processed(2, MODULE_HIGH, 0);
+    assert_processed(3, MODULE_LOW, 0);
+}
+
+static void test_priority_response(void)
+{
+    int result;
+
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(MODULE_LOW),
+        .target_id = FWK_ID_MODULE(MODULE_HIGH),
+        .id = FWK_ID_EVENT(MODULE_HIGH, 0),
+        .response_requested = true,
+    };
+
+    result = __fwk_init(4);
+    assert(result == FWK_SUCCESS);
+
+    result = fwk_put_event(&event);
+    assert(result == FWK_SUCCESS);
+    put_test_event(MODULE_NORMAL, 0);
+
+    fwk_process_event_queue();
+
+    /* The response is queued with the class of the event it responds to */
+    assert(processed_count == 3);
+    assert_processed(0, MODULE_HIGH, 0);
+    assert(!processed_is_response[0]);
+    assert_processed(1, MODULE_HIGH, 0);
+    assert(processed_is_response[1]);
+    assert_processed(2, MODULE_NORMAL, 0);
+}
+
+static void test_priority_starvation(void)
+{
+    int result;
+    unsigned int i;
+    const unsigned int high_count = FMW_EVENT_PRIORITY_STARVATION_LIMIT + 4;
+
+    result = __fwk_init(high_count + 1);
+    assert(result == FWK_SUCCESS);
+
+    put_test_event(MODULE_LOW, 0);
+    for (i = 0; i < high_count; i++) {
+        put_test_event(MODULE_HIGH, 0);
+    }
+
+    fwk_process_event_queue();
+
+    assert(processed_count == (high_count + 1));
+    for (i = 0; i < FMW_EVENT_PRIORITY_STARVATION_LIMIT; i++) {
+        assert_processed(i, MODULE_HIGH, 0);
+    }
+    assert_processed(FMW_EVENT_PRIORITY_STARVATION_LIMIT, MODULE_LOW, 0);
+    for (i = FMW_EVENT_PRIORITY_STARVATION_LIMIT + 1; i < processed_count;
+         i++) {
+        assert_processed(i, MODULE_HIGH, 0);
+    }
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_priority_order),
+    FWK_TEST_CASE(test_priority_event_table),
+    FWK_TEST_CASE(test_priority_isr_event),
+    FWK_TEST_CASE(test_priority_response),
+    FWK_TEST_CASE(test_priority_starvation),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_core_priority",
+    .test_suite_setup = test_suite_setup,
+    .test_case_setup = test_case_setup,
+    .test_case_teardown = test_case_teardown,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
@@ -0,0 +1,410 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <internal/fwk_context.h>
+#include <internal/fwk_core.h>
+#include <internal/fwk_delayed_resp.h>
+#include <internal/fwk_module.h>
+
+#include <fwk_assert.h>
+#include <fwk_core.h>
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_list.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MODULE_REQUESTER FWK_MODULE_IDX_TEST0
+#define MODULE_RESPONDER FWK_MODULE_IDX_TEST1
+#define MODULE_COUNT FWK_MODULE_IDX_COUNT
+
+#define ELEMENT_COUNT 8
+
+/* Number of responses parked at the same time */
+#define DELAYED_RESPONSE_COUNT 4096
+
+/* Number of cookies sharing the same index slot in the collision test */
+#define COLLISION_CLUSTER_SIZE 64
+
+static struct __fwk_ctx *ctx;
+
+static struct fwk_module fake_module_desc[MODULE_COUNT];
+static const struct fwk_module_config fake_module_config;
+static struct fwk_module_context fake_module_ctx[MODULE_COUNT];
+static struct fwk_element_ctx fake_element_ctx[ELEMENT_COUNT];
+
+static uint32_t cookie_table[DELAYED_RESPONSE_COUNT];
+static unsigned int order_table[DELAYED_RESPONSE_COUNT];
+
+/* Cookies of the events delayed by the responder, in order of processing */
+static uint32_t delayed_cookie_table[2];
+static unsigned int delayed_count;
+
+static unsigned int response_count;
+static bool response_params_valid;
+
+/* Mock functions */
+struct fwk_module_context *__wrap_fwk_module_get_ctx(fwk_id_t id)
+{
+    return &fake_module_ctx[fwk_id_get_module_idx(id)];
+}
+
+struct fwk_element_ctx *__wrap_fwk_module_get_element_ctx(fwk_id_t id)
+{
+    return &fake_element_ctx[fwk_id_get_element_idx(id)];
+}
+
+bool __wrap_fwk_module_is_valid_entity_id(fwk_id_t id)
+{
+    return true;
+}
+
+bool __wrap_fwk_module_is_valid_event_id(fwk_id_t id)
+{
+    return true;
+}
+
+int __wrap_fwk_interrupt_global_enable(void)
+{
+    return FWK_SUCCESS;
+}
+
+int __wrap_fwk_interrupt_global_disable(void)
+{
+    return FWK_SUCCESS;
+}
+
+bool __wrap_fwk_is_interrupt_context(void)
+{
+    return false;
+}
+
+static int responder_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *response_event)
+{
+    response_event->is_delayed_response = true;
+
+    if (delayed_count < FWK_ARRAY_SIZE(delayed_cookie_table)) {
+        delayed_cookie_table[delayed_count] = event->cookie;
+    }
+    delayed_count++;
+
+    return FWK_SUCCESS;
+}
+
+static int requester_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *response_event)
+{
+    uint32_t index;
+
+    assert(event->is_response);
+
+    (void)memcpy(&index, event->params, sizeof(index));
+    if (fwk_id_get_element_idx(event->source_id) != (index % ELEMENT_COUNT)) {
+        response_params_valid = false;
+    }
+
+    response_count++;
+
+    return FWK_SUCCESS;
+}
+
+static fwk_id_t get_element_id(unsigned int index)
+{
+    return FWK_ID_ELEMENT(MODULE_RESPONDER, index % ELEMENT_COUNT);
+}
+
+/* Deterministic permutation of the requests */
+static void shuffle_order_table(uint32_t seed)
+{
+    unsigned int i, j, tmp;
+
+    for (i = 0; i < DELAYED_RESPONSE_COUNT; i++) {
+        order_table[i] = i;
+    }
+
+    for (i = DELAYED_RESPONSE_COUNT - 1; i > 0; i--) {
+        seed = (seed * 1103515245U) + 12345U;
+        j = (seed >> 8) % (i + 1);
+
+        tmp = order_table[i];
+        order_table[i] = order_table[j];
+        order_table[j] = tmp;
+    }
+}
+
+static int test_suite_setup(void)
+{
+    ctx = __fwk_get_ctx();
+
+    fake_module_desc[MODULE_REQUESTER].process_event = requester_process_event;
+    fake_module_desc[MODULE_RESPONDER].process_event = responder_process_event;
+
+    for (unsigned int i = 0; i < MODULE_COUNT; i++) {
+        fake_module_ctx[i].desc = &fake_module_desc[i];
+        fake_module_ctx[i].config = &fake_module_config;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static void test_case_setup(void)
+{
+    unsigned int i;
+
+    for (i = 0; i < MODULE_COUNT; i++) {
+        fwk_list_init(&fake_module_ctx[i].delayed_response_list);
+    }
+
+    for (i = 0; i < ELEMENT_COUNT; i++) {
+        fwk_list_init(&fake_element_ctx[i].delayed_response_list);
+    }
+
+    delayed_count = 0;
+    response_count = 0;
+    response_params_valid = true;
+}
+
+static void test_case_teardown(void)
+{
+    *ctx = (struct __fwk_ctx){};
+}
+
+/*
+ * Park one delayed response per request. When clustered, the cookies are
+ * chosen so that groups of requests map to the same slot of the delayed
+ * response index.
+ */
+static void park_responses(bool clustered)
+{
+    int result;
+    unsigned int i;
+
+    for (i = 0; i < DELAYED_RESPONSE_COUNT; i++) {
+        if (clustered) {
+            ctx->event_cookie_counter =
+                ((i % COLLISION_CLUSTER_SIZE) << 16) +
+                (i / COLLISION_CLUSTER_SIZE);
+        }
+
+        struct fwk_event event = {
+            .source_id = FWK_ID_MODULE(MODULE_REQUESTER),
+            .target_id = get_element_id(i),
+            .id = FWK_ID_EVENT(MODULE_RESPONDER, 0),
+            .response_requested = true,
+        };
+
+        result = fwk_put_event(&event);
+        assert(result == FWK_SUCCESS);
+        cookie_table[i] = event.cookie;
+
+        fwk_process_event_queue();
+    }
+}
+
+static void test_delayed_response_lookup(void)
+{
+    int result;
+    unsigned int i, index;
+    struct fwk_event event;
+    bool is_empty;
+
+    result = __fwk_init(DELAYED_RESPONSE_COUNT + 1);
+    assert(result == FWK_SUCCESS);
+
+    park_responses(false);
+
+    /* All the events of the pool but one hold a delayed response */
+    assert(ctx->free_event_queue.head == ctx->free_event_queue.tail);
+
+    shuffle_order_table(1);
+
+    for (i = 0; i < DELAYED_RESPONSE_COUNT; i++) {
+        index = order_table[i];
+
+        result = fwk_get_delayed_response(
+            get_element_id(index), cookie_table[index], &event);
+        assert(result == FWK_SUCCESS);
+        assert(event.cookie == cookie_table[index]);
+        assert(fwk_id_is_equal(event.source_id, get_element_id(index)));
+        assert(fwk_id_is_equal(
+            event.target_id, FWK_ID_MODULE(MODULE_REQUESTER)));
+
+        /* The response was delayed by another element */
+        result = fwk_get_delayed_response(
+            get_element_id(index + 1), cookie_table[index], &event);
+        assert(result == FWK_E_PARAM);
+    }
+
+    for (i = 0; i < ELEMENT_COUNT; i++) {
+        result = fwk_get_first_delayed_response(get_element_id(i), &event);
+        assert(result == FWK_SUCCESS);
+        assert(event.cookie == cookie_table[i]);
+
+        result =
+            fwk_is_delayed_response_list_empty(get_element_id(i), &is_empty);
+        assert(result == FWK_SUCCESS);
+        assert(!is_empty);
+    }
+}
+
+static void complete_responses(bool clustered)
+{
+    int result;
+    unsigned int i, index;
+    uint32_t params;
+    struct fwk_event event;
+    bool is_empty;
+
+    result = __fwk_init(DELAYED_RESPONSE_COUNT + 1);
+    assert(result == FWK_SUCCESS);
+
+    park_responses(clustered);
+
+    shuffle_order_table(7);
+
+    for (i = 0; i < DELAYED_RESPONSE_COUNT; i++) {
+        index = order_table[i];
+        params = index;
+
+        event = (struct fwk_event){
+            .source_id = get_element_id(index),
+            .id = FWK_ID_EVENT(MODULE_RESPONDER, 0),
+            .cookie = cookie_table[index],
+            .is_response = true,
+            .is_delayed_response = true,
+        };
+        (void)memcpy(event.params, &params, sizeof(params));
+
+        result = fwk_put_event(&event);
+        assert(result == FWK_SUCCESS);
+
+        /* A delayed response can only be sent once */
+        event.cookie = cookie_table[index];
+        result = fwk_put_event(&event);
+        assert(result == FWK_E_PARAM);
+
+        result = fwk_get_delayed_response(
+            get_element_id(index), cookie_table[index], &event);
+        assert(result == FWK_E_PARAM);
+
+        /* Keep the remaining delayed responses reachable */
+        if ((i % 512) == 0) {
+            for (unsigned int j = i + 1; j < DELAYED_RESPONSE_COUNT; j++) {
+                index = order_table[j];
+                result = fwk_get_delayed_response(
+                    get_element_id(index), cookie_table[index], &event);
+                assert(result == FWK_SUCCESS);
+            }
+        }
+    }
+
+    fwk_process_event_queue();
+
+    assert(response_count == DELAYED_RESPONSE_COUNT);
+    assert(response_params_valid);
+
+    for (i = 0; i < ELEMENT_COUNT; i++) {
+        result =
+            fwk_is_delayed_response_list_empty(get_element_id(i), &is_empty);
+        assert(result == FWK_SUCCESS);
+        assert(is_empty);
+    }
+}
+
+static void test_delayed_response_complete(void)
+{
+    complete_responses(false);
+}
+
+static void test_delayed_response_collisions(void)
+{
+    complete_responses(true);
+}
+
+static void test_delayed_response_light_events(void)
+{
+    int result;
+    unsigned int i;
+    uint32_t params;
+    struct fwk_event event;
+
+    struct fwk_event_light light_event = {
+        .source_id = FWK_ID_MODULE(MODULE_REQUESTER),
+        .target_id = get_element_id(0),
+        .id = FWK_ID_EVENT(MODULE_RESPONDER, 0),
+        .response_requested = true,
+    };
+
+    result = __fwk_init(4);
+    assert(result == FWK_SUCCESS);
+
+    /* Both responses are delayed by the same element */
+    for (i = 0; i < 2; i++) {
+        result = fwk_put_event(&light_event);
+        assert(result == FWK_SUCCESS);
+    }
+
+    fwk_process_event_queue();
+
+    assert(delayed_count == 2);
+    assert(delayed_cookie_table[0] != delayed_cookie_table[1]);
+
+    /* Each delayed response is found from the cookie of its request */
+    for (i = 0; i < 2; i++) {
+        result = fwk_get_delayed_response(
+            get_element_id(0), delayed_cookie_table[i], &event);
+        assert(result == FWK_SUCCESS);
+        assert(event.cookie == delayed_cookie_table[i]);
+    }
+
+    /* Complete the second response first */
+    for (i = 2; i > 0; i--) {
+        params = 0;
+
+        event = (struct fwk_event){
+            .source_id = get_element_id(0),
+            .id = FWK_ID_EVENT(MODULE_RESPONDER, 0),
+            .cookie = delayed_cookie_table[i - 1],
+            .is_response = true,
+            .is_delayed_response = true,
+        };
+        (void)memcpy(event.params, &params, sizeof(params));
+
+        result = fwk_put_event(&event);
+        assert(result == FWK_SUCCESS);
+    }
+
+    fwk_process_event_queue();
+
+    assert(response_count == 2);
+    assert(response_params_valid);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_delayed_response_lookup),
+    FWK_TEST_CASE(test_delayed_response_complete),
+    FWK_TEST_CASE(test_delayed_response_collisions),
+    FWK_TEST_CASE(test_delayed_response_light_events),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_delayed_resp",
+    .test_suite_setup = test_suite_setup,
+    .test_case_setup = test_case_setup,
+    .test_case_teardown = test_case_teardown,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
@@ -0,0 +1,257 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <fwk_io.h>
+#include <fwk_macros.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#define SPAN_MAX 3U
+
+static const char input[] = "abcdefgh";
+static size_t input_offset;
+
+static char output[16];
+static size_t output_length;
+
+static unsigned int call_count;
+
+/* Fail every other call to the adapter with the given status */
+static int busy_status;
+
+static int fake_open(const struct fwk_io_stream *stream)
+{
+    return FWK_SUCCESS;
+}
+
+static bool fake_is_busy(void)
+{
+    return ((call_count++ % 2) == 1);
+}
+
+static int fake_getch(const struct fwk_io_stream *stream, char *ch)
+{
+    if (input_offset == (sizeof(input) - 1)) {
+        return FWK_PENDING;
+    }
+
+    *ch = input[input_offset++];
+
+    return FWK_SUCCESS;
+}
+
+static int fake_read(
+    const struct fwk_io_stream *stream,
+    char *buffer,
+    size_t size,
+    size_t *read)
+{
+    assert(size > 0);
+
+    *read = FWK_MIN(FWK_MIN(size, SPAN_MAX), sizeof(input) - 1 - input_offset);
+    if (*read == 0) {
+        return FWK_PENDING;
+    }
+
+    memcpy(buffer, &input[input_offset], *read);
+    input_offset += *read;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_putch(const struct fwk_io_stream *stream, char ch)
+{
+    if (fake_is_busy()) {
+        return busy_status;
+    }
+
+    output[output_length++] = ch;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_write(
+    const struct fwk_io_stream *stream,
+    const char *buffer,
+    size_t size,
+    size_t *written)
+{
+    assert(size > 0);
+
+    if (fake_is_busy()) {
+        return busy_status;
+    }
+
+    *written = FWK_MIN(size, SPAN_MAX);
+
+    memcpy(&output[output_length], buffer, *written);
+    output_length += *written;
+
+    return FWK_SUCCESS;
+}
+
+static const struct fwk_io_adapter char_adapter = {
+    .open = fake_open,
+    .getch = fake_getch,
+    .putch = fake_putch,
+};
+
+static const struct fwk_io_adapter span_adapter = {
+    .open = fake_open,
+    .getch = fake_getch,
+    .read = fake_read,
+    .putch = fake_putch,
+    .write = fake_write,
+};
+
+static struct fwk_io_stream char_stream = {
+    .adapter = &char_adapter,
+    .mode = FWK_IO_MODE_READ | FWK_IO_MODE_WRITE,
+};
+
+static struct fwk_io_stream span_stream = {
+    .adapter = &span_adapter,
+    .mode = FWK_IO_MODE_READ | FWK_IO_MODE_WRITE,
+};
+
+static void test_case_setup(void)
+{
+    input_offset = 0;
+
+    memset(output, 0, sizeof(output));
+    output_length = 0;
+
+    call_count = 0;
+    busy_status = FWK_E_BUSY;
+}
+
+static void test_fwk_io_write_span(void)
+{
+    size_t written;
+    int status;
+
+    /* The data is written in spans, waiting whenever the adapter is busy */
+    status = fwk_io_write(&span_stream, &written, "abcdefgh", 2, 4);
+    assert(status == FWK_SUCCESS);
+    assert(written == 4);
+    assert(strcmp(output, "abcdefgh") == 0);
+    assert(call_count == 5);
+}
+
+static void test_fwk_io_write_char(void)
+{
+    size_t written;
+    int status;
+
+    /* Adapters without span operations are given a character at a time */
+    status = fwk_io_write(&char_stream, &written, "abcdefgh", 1, 8);
+    assert(status == FWK_SUCCESS);
+    assert(written == 8);
+    assert(strcmp(output, "abcdefgh") == 0);
+    assert(call_count == 15);
+}
+
+static void test_fwk_io_write_error(void)
+{
+    struct fwk_io_stream stream = span_stream;
+    size_t written;
+    int status;
+
+    busy_status = FWK_E_DEVICE;
+
+    /* Only complete objects are accounted for */
+    status = fwk_io_write(&span_stream, &written, "abcdefgh", 2, 4);
+    assert(status == FWK_E_HANDLER);
+    assert(written == 1);
+    assert(strcmp(output, "abc") == 0);
+
+    stream.mode = FWK_IO_MODE_READ;
+    status = fwk_io_write(&stream, &written, "a", 1, 1);
+    assert(status == FWK_E_SUPPORT);
+
+    stream.adapter = NULL;
+    status = fwk_io_write(&stream, &written, "a", 1, 1);
+    assert(status == FWK_E_STATE);
+}
+
+static void test_fwk_io_write_nowait(void)
+{
+    size_t written;
+    int status;
+
+    /* Characters are written until the adapter is busy */
+    status = fwk_io_write_nowait(&char_stream, &written, "abc", 3);
+    assert(status == FWK_SUCCESS);
+    assert(written == 1);
+
+    call_count = 1;
+    status = fwk_io_write_nowait(&char_stream, &written, "bc", 2);
+    assert(status == FWK_E_BUSY);
+    assert(written == 0);
+
+    status = fwk_io_write_nowait(&span_stream, &written, "bcdef", 5);
+    assert(status == FWK_SUCCESS);
+    assert(written == SPAN_MAX);
+    assert(strcmp(output, "abcd") == 0);
+
+    status = fwk_io_write_nowait(&span_stream, &written, NULL, 1);
+    assert(status == FWK_E_PARAM);
+}
+
+static void test_fwk_io_read_span(void)
+{
+    char buffer[16] = { 0 };
+    size_t read;
+    int status;
+
+    status = fwk_io_read(&span_stream, &read, buffer, 2, 2);
+    assert(status == FWK_SUCCESS);
+    assert(read == 2);
+    assert(strcmp(buffer, "abcd") == 0);
+
+    /* Only complete objects are accounted for at the end of the stream */
+    status = fwk_io_read(&span_stream, &read, buffer, 3, 4);
+    assert(status == FWK_PENDING);
+    assert(read == 1);
+    assert(strncmp(buffer, "efgh", 4) == 0);
+
+    status = fwk_io_read(&span_stream, NULL, buffer, 1, 1);
+    assert(status == FWK_E_DATA);
+}
+
+static void test_fwk_io_read_char(void)
+{
+    char buffer[16] = { 0 };
+    size_t read;
+    int status;
+
+    status = fwk_io_read(&char_stream, &read, buffer, 1, 16);
+    assert(status == FWK_PENDING);
+    assert(read == 8);
+    assert(strcmp(buffer, input) == 0);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_io_write_span),
+    FWK_TEST_CASE(test_fwk_io_write_char),
+    FWK_TEST_CASE(test_fwk_io_write_error),
+    FWK_TEST_CASE(test_fwk_io_write_nowait),
+    FWK_TEST_CASE(test_fwk_io_read_span),
+    FWK_TEST_CASE(test_fwk_io_read_char),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_io",
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
@@ -0,0 +1,102 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <fwk_assert.h>
+#include <fwk_list.h>
+#include <fwk_macros.h>
+#include <fwk_test.h>
+
+#include <stddef.h>
+#include <string.h>
+
+static struct fwk_slist dst;
+static struct fwk_slist src;
+
+static struct fwk_slist_node snodes[4];
+
+static void test_case_setup(void)
+{
+    memset(snodes, 0, sizeof(snodes));
+
+    fwk_list_init(&dst);
+    fwk_list_init(&src);
+}
+
+static void test_slist_splice_empty_to_empty(void)
+{
+    fwk_list_splice(&dst, &src);
+
+    assert(fwk_list_is_empty(&dst));
+    assert(fwk_list_is_empty(&src));
+}
+
+static void test_slist_splice_empty_to_many(void)
+{
+    fwk_list_push_tail(&dst, &snodes[0]);
+    fwk_list_push_tail(&dst, &snodes[1]);
+
+    fwk_list_splice(&dst, &src);
+
+    assert(dst.head == &snodes[0]);
+    assert(dst.tail == &snodes[1]);
+    assert(snodes[1].next == (struct fwk_slist_node *)&dst);
+
+    assert(fwk_list_is_empty(&src));
+}
+
+static void test_slist_splice_many_to_empty(void)
+{
+    fwk_list_push_tail(&src, &snodes[0]);
+    fwk_list_push_tail(&src, &snodes[1]);
+
+    fwk_list_splice(&dst, &src);
+
+    assert(dst.head == &snodes[0]);
+    assert(dst.tail == &snodes[1]);
+    assert(snodes[0].next == &snodes[1]);
+    assert(snodes[1].next == (struct fwk_slist_node *)&dst);
+
+    assert(src.head == (struct fwk_slist_node *)&src);
+    assert(src.tail == (struct fwk_slist_node *)&src);
+}
+
+static void test_slist_splice_many_to_many(void)
+{
+    fwk_list_push_tail(&dst, &snodes[0]);
+    fwk_list_push_tail(&dst, &snodes[1]);
+    fwk_list_push_tail(&src, &snodes[2]);
+    fwk_list_push_tail(&src, &snodes[3]);
+
+    fwk_list_splice(&dst, &src);
+
+    assert(dst.head == &snodes[0]);
+    assert(dst.tail == &snodes[3]);
+    assert(snodes[1].next == &snodes[2]);
+    assert(snodes[3].next == (struct fwk_slist_node *)&dst);
+
+    assert(fwk_list_is_empty(&src));
+
+    /* Both lists remain usable */
+    assert(fwk_list_pop_head(&dst) == &snodes[0]);
+    fwk_list_push_tail(&src, &snodes[0]);
+    assert(fwk_list_head(&src) == &snodes[0]);
+    assert(src.tail == &snodes[0]);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_slist_splice_empty_to_empty),
+    FWK_TEST_CASE(test_slist_splice_empty_to_many),
+    FWK_TEST_CASE(test_slist_splice_many_to_empty),
+    FWK_TEST_CASE(test_slist_splice_many_to_many),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_list_splice",
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
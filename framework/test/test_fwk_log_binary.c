@@ -0,0 +1,273 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <internal/fwk_log.h>
+
+#include <fwk_io.h>
+#include <fwk_log.h>
+#include <fwk_macros.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+#include <fwk_time.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define RECORD_SIZE UCHAR_MAX
+#define OUTPUT_SIZE 1024
+
+static char output[OUTPUT_SIZE];
+static size_t output_length;
+
+/* Mock functions */
+int __wrap_fwk_io_write_nowait(
+    const struct fwk_io_stream *stream,
+    size_t *written,
+    const char *buffer,
+    size_t size)
+{
+    assert((output_length + size) <= sizeof(output));
+
+    memcpy(&output[output_length], buffer, size);
+    output_length += size;
+    *written = size;
+
+    return FWK_SUCCESS;
+}
+
+int __wrap_fwk_io_puts(const struct fwk_io_stream *stream, const char *str)
+{
+    return FWK_SUCCESS;
+}
+
+static size_t encode(
+    char record[RECORD_SIZE],
+    fwk_duration_ns_t timestamp,
+    const char *format,
+    ...)
+{
+    size_t length;
+    va_list args;
+
+    va_start(args, format);
+    length = __fwk_log_encode(RECORD_SIZE, record, timestamp, format, &args);
+    va_end(args);
+
+    return length;
+}
+
+static void drain(void)
+{
+    while (fwk_log_unbuffer() == FWK_PENDING) {
+        continue;
+    }
+}
+
+static void test_case_setup(void)
+{
+    drain();
+
+    output_length = 0;
+}
+
+static void test_fwk_log_binary_encode_integers(void)
+{
+    char record[RECORD_SIZE];
+    char buffer[128];
+    fwk_duration_ns_t timestamp;
+    size_t length;
+
+    length = encode(
+        record,
+        FWK_S(3),
+        "%d %u %hhx %lu %lld %jd %zu %td %c %%",
+        -1,
+        2U,
+        0x1ff,
+        3UL,
+        -4LL,
+        (intmax_t)5,
+        (size_t)6,
+        (ptrdiff_t)-7,
+        'x');
+
+    /* Only the raw values follow the timestamp and the format string */
+    assert(
+        length ==
+        (sizeof(fwk_duration_ns_t) + sizeof(char *) + (4 * sizeof(int)) +
+         sizeof(long) + sizeof(long long) + sizeof(intmax_t) + sizeof(size_t) +
+         sizeof(ptrdiff_t)));
+
+    length =
+        __fwk_log_decode(length, record, &timestamp, sizeof(buffer), buffer);
+    assert(timestamp == FWK_S(3));
+    assert(strcmp(buffer, "-1 2 ff 3 -4 5 6 -7 x %") == 0);
+    assert(length == strlen(buffer));
+}
+
+static void test_fwk_log_binary_encode_other(void)
+{
+    char record[RECORD_SIZE];
+    char buffer[128];
+    char string[] = "module";
+    fwk_duration_ns_t timestamp;
+    size_t length;
+
+    length = encode(
+        record, 0, "[%s] %-8s|%*d|%.*s|%.2f|%p", string, "a", 4, 7, 2, "bcd",
+        1.5, NULL);
+    assert(length > 0);
+
+    /* Strings are copied into the record */
+    string[0] = 'M';
+
+    (void)__fwk_log_decode(length, record, &timestamp, sizeof(buffer), buffer);
+    assert(strncmp(buffer, "[module] a       |   7|bc|1.50|", 31) == 0);
+}
+
+static void test_fwk_log_binary_encode_invalid(void)
+{
+    char record[RECORD_SIZE];
+    char string[RECORD_SIZE];
+    int count;
+
+    assert(encode(record, 0, "%n", &count) == 0);
+    assert(encode(record, 0, "%Lf", (long double)1) == 0);
+    assert(encode(record, 0, "%ls", L"wide") == 0);
+    assert(encode(record, 0, "%k") == 0);
+
+    /* Records that do not fit are rejected */
+    memset(string, 'a', sizeof(string) - 1);
+    string[sizeof(string) - 1] = '\0';
+    assert(encode(record, 0, "%s%d", string, 1) == 0);
+}
+
+static void test_fwk_log_binary_encode_text(void)
+{
+    char record[RECORD_SIZE];
+    char buffer[RECORD_SIZE];
+    char message[2 * RECORD_SIZE];
+    fwk_duration_ns_t timestamp;
+    size_t length;
+
+    memset(message, 'a', sizeof(message) - 1);
+    message[sizeof(message) - 1] = '\0';
+
+    /* Text messages are truncated to fit in the record */
+    length = __fwk_log_encode_text(sizeof(record), record, 7, message);
+    assert(length == sizeof(record));
+
+    length = __fwk_log_decode(length, record, &timestamp, 16, buffer);
+    assert(length == 15);
+    assert(timestamp == 7);
+    assert(strncmp(buffer, message, 15) == 0);
+}
+
+static void test_fwk_log_binary_decode_truncated(void)
+{
+    char record[RECORD_SIZE];
+    char buffer[64];
+    fwk_duration_ns_t timestamp;
+    size_t length;
+
+    length = encode(record, 0, "a%db%sc", 1, "str");
+
+    /* Decoding stops at the first argument missing from the record */
+    (void)__fwk_log_decode(length - 1, record, &timestamp, 64, buffer);
+    assert(strcmp(buffer, "a1b") == 0);
+
+    (void)__fwk_log_decode(length - 5, record, &timestamp, 64, buffer);
+    assert(strcmp(buffer, "a") == 0);
+
+    assert(__fwk_log_decode(4, record, &timestamp, 64, buffer) == 0);
+    assert(buffer[0] == '\0');
+}
+
+static void test_fwk_log_binary_printf(void)
+{
+#ifdef BUILD_HAS_LOG_BINARY_RAW
+    char buffer[64];
+    fwk_duration_ns_t timestamp;
+    size_t length;
+#endif
+
+    fwk_log_printf("value %u of %s", 42U, "test");
+    drain();
+
+#ifdef BUILD_HAS_LOG_BINARY_RAW
+    /* Records are written undecoded, for the host to decode them */
+    assert(output[0] == FWK_LOG_RECORD_MAGIC);
+    length = (unsigned char)output[1];
+    assert(output_length == (length + 2));
+
+    (void)__fwk_log_decode(
+        length, &output[2], &timestamp, sizeof(buffer), buffer);
+    assert(strcmp(buffer, "value 42 of test") == 0);
+#else
+    output[output_length] = '\0';
+    assert(strcmp(output, "[    0.000000] value 42 of test\r\n") == 0);
+#endif
+}
+
+static void test_fwk_log_binary_printf_fallback(void)
+{
+#ifndef BUILD_HAS_LOG_BINARY_RAW
+    int count;
+
+    /* Messages that cannot be deferred are formatted right away */
+    fwk_log_printf("abc%n%Lf", &count, (long double)2);
+    drain();
+
+    assert(count == 3);
+    output[output_length] = '\0';
+    assert(strcmp(output, "[    0.000000] abc2.000000\r\n") == 0);
+#endif
+}
+
+static void test_fwk_log_binary_printf_dropped(void)
+{
+    unsigned int i;
+
+    /* Fill the buffer until messages are dropped */
+    for (i = 0; i < 32; i++) {
+        fwk_log_printf("message %u", i);
+    }
+
+    drain();
+
+#ifndef BUILD_HAS_LOG_BINARY_RAW
+    output[output_length] = '\0';
+    assert(strstr(output, "[    0.000000] message 0\r\n") == output);
+    assert(strstr(output, "more messages...\r\n") != NULL);
+#endif
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_log_binary_encode_integers),
+    FWK_TEST_CASE(test_fwk_log_binary_encode_other),
+    FWK_TEST_CASE(test_fwk_log_binary_encode_invalid),
+    FWK_TEST_CASE(test_fwk_log_binary_encode_text),
+    FWK_TEST_CASE(test_fwk_log_binary_decode_truncated),
+    FWK_TEST_CASE(test_fwk_log_binary_printf),
+    FWK_TEST_CASE(test_fwk_log_binary_printf_fallback),
+    FWK_TEST_CASE(test_fwk_log_binary_printf_dropped),
+};
+
+struct fwk_test_suite_desc test_suite = {
+#ifdef BUILD_HAS_LOG_BINARY_RAW
+    .name = "fwk_log_binary_raw",
+#else
+    .name = "fwk_log_binary",
+#endif
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
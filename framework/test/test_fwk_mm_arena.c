@@ -0,0 +1,266 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <internal/fwk_mm.h>
+
+#include <fwk_assert.h>
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_mm.h>
+#include <fwk_mm_arena.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define ARENA_SIZE 1024
+
+static _Alignas(max_align_t) uint8_t arena[ARENA_SIZE];
+
+/* Mock functions */
+bool __wrap_fwk_module_is_valid_module_id(fwk_id_t id)
+{
+    return fwk_id_is_type(id, FWK_ID_TYPE_MODULE) &&
+        (fwk_id_get_module_idx(id) < FWK_MODULE_IDX_COUNT);
+}
+
+static void test_case_setup(void)
+{
+    int status;
+
+    status = __fwk_mm_arena_init((uintptr_t)arena, sizeof(arena));
+    assert(status == FWK_SUCCESS);
+}
+
+static struct fwk_mm_arena_stats get_stats(fwk_id_t id)
+{
+    struct fwk_mm_arena_stats stats;
+    int status;
+
+    status = fwk_mm_arena_get_stats(id, &stats);
+    assert(status == FWK_SUCCESS);
+
+    return stats;
+}
+
+static void test_fwk_mm_arena_init(void)
+{
+    int status;
+
+    status = __fwk_mm_arena_init((uintptr_t)arena, 0);
+    assert(status == FWK_E_PARAM);
+
+    status = __fwk_mm_arena_init(UINTPTR_MAX, sizeof(arena));
+    assert(status == FWK_E_PARAM);
+}
+
+static void test_fwk_mm_arena_alloc(void)
+{
+    struct fwk_mm_arena_stats stats;
+    uint8_t *ptr0, *ptr1;
+
+    ptr0 = fwk_mm_alloc_notrap(3, 5);
+    assert(ptr0 != NULL);
+    assert(((uintptr_t)ptr0 % FMW_MM_ARENA_ALIGNMENT) == 0);
+    assert((ptr0 > arena) && (ptr0 < (arena + ARENA_SIZE)));
+
+    ptr1 = fwk_mm_alloc_aligned(64, 1, 8);
+    assert(((uintptr_t)ptr1 % 64) == 0);
+    assert(ptr1 >= (ptr0 + 15));
+
+    stats = get_stats(FWK_ID_NONE);
+    assert(stats.size == ARENA_SIZE);
+    assert(stats.used == 23);
+    assert(stats.block_count == 2);
+    assert(stats.peak == (size_t)((ptr1 + 8) - arena));
+    assert(stats.fragmented == (stats.peak - stats.used));
+}
+
+static void test_fwk_mm_arena_alloc_overflow(void)
+{
+    /* Hide the overflowing size from the compiler allocation size checks */
+    volatile size_t num = SIZE_MAX;
+
+    assert(fwk_mm_alloc_notrap(ARENA_SIZE, 1) == NULL);
+    assert(fwk_mm_alloc_notrap(num, 2) == NULL);
+
+    assert(get_stats(FWK_ID_NONE).block_count == 0);
+}
+
+static void test_fwk_mm_arena_calloc(void)
+{
+    uint8_t *ptr;
+    unsigned int i;
+
+    /* Leave non-zero bytes behind a freed allocation */
+    ptr = fwk_mm_alloc(1, 32);
+    memset(ptr, 0xA5, 32);
+    fwk_mm_free(ptr);
+
+    ptr = fwk_mm_calloc(4, 8);
+    for (i = 0; i < 32; i++) {
+        assert(ptr[i] == 0);
+    }
+}
+
+static void test_fwk_mm_arena_free(void)
+{
+    struct fwk_mm_arena_stats stats;
+    void *ptr0, *ptr1;
+    size_t peak;
+
+    ptr0 = fwk_mm_alloc_notrap(1, 16);
+    ptr1 = fwk_mm_alloc_notrap(1, 16);
+    peak = get_stats(FWK_ID_NONE).peak;
+
+    /* Memory that is not at the end of the arena cannot be reclaimed */
+    fwk_mm_free(ptr0);
+    stats = get_stats(FWK_ID_NONE);
+    assert(stats.used == 16);
+    assert(stats.block_count == 1);
+    assert(stats.fragmented == (peak - 16));
+
+    /* The most recent allocation is reclaimed */
+    fwk_mm_free(ptr1);
+    stats = get_stats(FWK_ID_NONE);
+    assert(stats.used == 0);
+    assert(stats.block_count == 0);
+    assert(stats.peak == peak);
+    assert(fwk_mm_alloc_notrap(1, 16) == ptr1);
+
+    /* Freeing a block twice is rejected */
+    fwk_mm_free(ptr0);
+    assert(get_stats(FWK_ID_NONE).block_count == 1);
+}
+
+static void test_fwk_mm_arena_realloc(void)
+{
+    uint8_t *ptr0, *ptr1, *ptr;
+
+    ptr0 = fwk_mm_realloc(NULL, 1, 16);
+    assert(ptr0 != NULL);
+    memset(ptr0, 0x5A, 16);
+
+    /* The most recent allocation grows in place */
+    ptr = fwk_mm_realloc(ptr0, 1, 32);
+    assert(ptr == ptr0);
+    assert(get_stats(FWK_ID_NONE).used == 32);
+
+    ptr1 = fwk_mm_alloc_notrap(1, 8);
+
+    /* Any allocation shrinks in place */
+    ptr = fwk_mm_realloc(ptr0, 1, 16);
+    assert(ptr == ptr0);
+    assert(get_stats(FWK_ID_NONE).used == 24);
+
+    /* Other allocations move when growing */
+    ptr = fwk_mm_realloc(ptr0, 1, 64);
+    assert(ptr > ptr1);
+    assert(ptr[0] == 0x5A);
+    assert(ptr[15] == 0x5A);
+    assert(get_stats(FWK_ID_NONE).used == 72);
+    assert(get_stats(FWK_ID_NONE).block_count == 2);
+}
+
+static void test_fwk_mm_arena_owner(void)
+{
+    struct fwk_mm_arena_stats stats;
+    void *ptr[4];
+
+    __fwk_mm_set_owner(fwk_module_id_test1);
+    ptr[0] = fwk_mm_alloc_notrap(1, 40);
+    ptr[1] = fwk_mm_alloc_notrap(2, 4);
+
+    __fwk_mm_set_owner(FWK_ID_ELEMENT(FWK_MODULE_IDX_TEST2, 1));
+    ptr[2] = fwk_mm_alloc_notrap(1, 24);
+
+    __fwk_mm_set_owner(FWK_ID_NONE);
+    ptr[3] = fwk_mm_alloc_notrap(1, 100);
+
+    assert((ptr[1] != NULL) && (ptr[2] != NULL) && (ptr[3] != NULL));
+
+    /* Memory is charged to its owner whoever frees it */
+    fwk_mm_free(ptr[0]);
+
+    stats = get_stats(fwk_module_id_test0);
+    assert(stats.used == 0);
+    assert(stats.block_count == 0);
+
+    stats = get_stats(fwk_module_id_test1);
+    assert(stats.size == 0);
+    assert(stats.used == 8);
+    assert(stats.peak == 48);
+    assert(stats.fragmented == 0);
+    assert(stats.block_count == 1);
+
+    stats = get_stats(fwk_module_id_test2);
+    assert(stats.used == 24);
+    assert(stats.peak == 24);
+    assert(stats.block_count == 1);
+
+    stats = get_stats(FWK_ID_NONE);
+    assert(stats.used == 132);
+    assert(stats.block_count == 3);
+}
+
+static void test_fwk_mm_arena_seal(void)
+{
+    void *ptr0, *ptr1;
+
+    ptr0 = fwk_mm_alloc_notrap(1, 16);
+    ptr1 = fwk_mm_alloc_notrap(1, 16);
+
+    __fwk_mm_arena_seal();
+
+    assert(fwk_mm_alloc_notrap(1, 16) == NULL);
+
+    /* The most recent allocation cannot grow once sealed */
+    assert(fwk_mm_realloc(ptr1, 1, 32) == NULL);
+    assert(fwk_mm_realloc(ptr1, 1, 8) == ptr1);
+
+    fwk_mm_free(ptr0);
+    assert(get_stats(FWK_ID_NONE).block_count == 1);
+}
+
+static void test_fwk_mm_arena_get_stats(void)
+{
+    struct fwk_mm_arena_stats stats;
+    int status;
+
+    status = fwk_mm_arena_get_stats(FWK_ID_NONE, NULL);
+    assert(status == FWK_E_PARAM);
+
+    status =
+        fwk_mm_arena_get_stats(FWK_ID_MODULE(FWK_MODULE_IDX_COUNT), &stats);
+    assert(status == FWK_E_PARAM);
+
+    status = fwk_mm_arena_get_stats(fwk_module_id_test0, &stats);
+    assert(status == FWK_SUCCESS);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_mm_arena_init),
+    FWK_TEST_CASE(test_fwk_mm_arena_alloc),
+    FWK_TEST_CASE(test_fwk_mm_arena_alloc_overflow),
+    FWK_TEST_CASE(test_fwk_mm_arena_calloc),
+    FWK_TEST_CASE(test_fwk_mm_arena_free),
+    FWK_TEST_CASE(test_fwk_mm_arena_realloc),
+    FWK_TEST_CASE(test_fwk_mm_arena_owner),
+    FWK_TEST_CASE(test_fwk_mm_arena_seal),
+    FWK_TEST_CASE(test_fwk_mm_arena_get_stats),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_mm_arena",
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
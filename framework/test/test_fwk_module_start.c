@@ -0,0 +1,151 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <internal/fwk_module.h>
+
+#include <fwk_assert.h>
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <stdlib.h>
+
+extern struct fwk_module *module_table[FWK_MODULE_IDX_COUNT];
+extern struct fwk_module_config *module_config_table[FWK_MODULE_IDX_COUNT];
+
+static int fake_data;
+
+static const struct fwk_element fake_element_table[] = {
+    [0] = { .name = "FAKE ELEM 0", .data = &fake_data },
+    [1] = { 0 },
+};
+
+static struct fwk_module fake_module_desc[FWK_MODULE_IDX_COUNT];
+static struct fwk_module_config fake_module_config[FWK_MODULE_IDX_COUNT];
+
+/* Entity whose bind or start callback fails */
+static fwk_id_t failing_id;
+
+/* Module the arena allocations are charged to */
+static fwk_id_t mm_owner;
+
+static int init(fwk_id_t module_id, unsigned int element_count, const void *data)
+{
+    return FWK_SUCCESS;
+}
+
+static int element_init(
+    fwk_id_t element_id,
+    unsigned int sub_element_count,
+    const void *data)
+{
+    return FWK_SUCCESS;
+}
+
+static int bind(fwk_id_t id, unsigned int round)
+{
+    return fwk_id_is_equal(id, failing_id) ? FWK_E_DEVICE : FWK_SUCCESS;
+}
+
+static int start(fwk_id_t id)
+{
+    return fwk_id_is_equal(id, failing_id) ? FWK_E_DEVICE : FWK_SUCCESS;
+}
+
+/* Wrapped functions */
+
+void *__wrap_fwk_mm_calloc(size_t num, size_t size)
+{
+    return calloc(num, size);
+}
+
+void __wrap___fwk_mm_set_owner(fwk_id_t id)
+{
+    mm_owner = id;
+}
+
+int __wrap___fwk_init(size_t event_count)
+{
+    return FWK_SUCCESS;
+}
+
+static void test_case_setup(void)
+{
+    for (unsigned int i = 0; i < FWK_MODULE_IDX_COUNT; i++) {
+        fake_module_desc[i] = (struct fwk_module){
+            .type = FWK_MODULE_TYPE_DRIVER,
+            .init = init,
+            .element_init = element_init,
+            .bind = bind,
+            .start = start,
+        };
+
+        fake_module_config[i] = (struct fwk_module_config){
+            .elements = FWK_MODULE_STATIC_ELEMENTS_PTR(fake_element_table),
+        };
+
+        module_table[i] = &fake_module_desc[i];
+        module_config_table[i] = &fake_module_config[i];
+    }
+
+    failing_id = FWK_ID_NONE;
+    mm_owner = FWK_ID_NONE;
+}
+
+static void check_start_failure(fwk_id_t id, bool fail_bind)
+{
+    int result;
+
+    failing_id = id;
+    if (!fail_bind) {
+        /* Let the entity be bound so that it fails to start */
+        fake_module_desc[fwk_id_get_module_idx(id)].bind = NULL;
+    }
+
+    fwk_module_reset();
+    result = fwk_module_start();
+    assert(result == FWK_E_DEVICE);
+
+    /* The allocations are charged to the framework again */
+    assert(fwk_id_is_equal(mm_owner, FWK_ID_NONE));
+}
+
+static void test_fwk_module_start_module_bind_failed(void)
+{
+    check_start_failure(fwk_module_id_fake0, true);
+}
+
+static void test_fwk_module_start_element_bind_failed(void)
+{
+    check_start_failure(FWK_ID_ELEMENT(FWK_MODULE_IDX_FAKE1, 0), true);
+}
+
+static void test_fwk_module_start_module_start_failed(void)
+{
+    check_start_failure(fwk_module_id_fake0, false);
+}
+
+static void test_fwk_module_start_element_start_failed(void)
+{
+    check_start_failure(FWK_ID_ELEMENT(FWK_MODULE_IDX_FAKE1, 0), false);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_module_start_module_bind_failed),
+    FWK_TEST_CASE(test_fwk_module_start_element_bind_failed),
+    FWK_TEST_CASE(test_fwk_module_start_module_start_failed),
+    FWK_TEST_CASE(test_fwk_module_start_element_start_failed),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_module_start",
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
@@ -8,11 +8,13 @@
 #include <internal/fwk_context.h>
 #include <internal/fwk_core.h>
 #include <internal/fwk_module.h>
+#include <internal/fwk_notification.h>
 
 #include <fwk_assert.h>
 #include <fwk_id.h>
 #include <fwk_list.h>
 #include <fwk_macros.h>
+#include <fwk_module_idx.h>
 #include <fwk_slist.h>
 #include <fwk_status.h>
 #include <fwk_test.h>
@@ -41,15 +43,33 @@ void *__wrap_fwk_mm_calloc(size_t num, size_t size)
     return NULL;
 }
 
-static struct fwk_module_context fake_module_ctx;
+static struct fwk_element_ctx fake_element_ctx;
+
+/* Only the module FWK_MODULE_IDX_TEST2 defines notifications */
+static const struct fwk_module fake_module_desc = {
+    .notification_count = 4,
+};
+static const struct fwk_module empty_module_desc;
+static struct fwk_module_context empty_module_ctx = {
+    .desc = &empty_module_desc,
+};
+
+static struct fwk_module_context fake_module_ctx = {
+    .desc = &fake_module_desc,
+    .element_count = 1,
+    .element_ctx_table = &fake_element_ctx,
+};
 static struct fwk_dlist fake_module_dlist_table[4];
 struct fwk_module_context *__wrap_fwk_module_get_ctx(fwk_id_t id)
 {
+    if (fwk_id_get_module_idx(id) != FWK_MODULE_IDX_TEST2) {
+        return &empty_module_ctx;
+    }
+
     fake_module_ctx.subscription_dlist_table = fake_module_dlist_table;
     return &fake_module_ctx;
 }
 
-static struct fwk_element_ctx fake_element_ctx;
 static struct fwk_dlist fake_element_dlist_table[4];
 struct fwk_element_ctx *__wrap_fwk_module_get_element_ctx(fwk_id_t id)
 {
@@ -96,6 +116,28 @@ int __wrap___fwk_put_notification(struct fwk_event *event)
     return FWK_SUCCESS;
 }
 
+static fwk_id_t fanout_target_table[8];
+static unsigned int fanout_target_count;
+static unsigned int fanout_call_count;
+void __wrap___fwk_put_notification_fanout(
+    struct fwk_event *event,
+    const fwk_id_t *target_table,
+    unsigned int target_count,
+    unsigned int *count)
+{
+    unsigned int i;
+
+    assert(target_count <= FWK_ARRAY_SIZE(fanout_target_table));
+
+    for (i = 0; i < target_count; i++) {
+        fanout_target_table[i] = target_table[i];
+    }
+
+    fanout_target_count = target_count;
+    fanout_call_count++;
+    *count = target_count;
+}
+
 static struct fwk_event *get_current_event_return_val;
 const struct fwk_event *__wrap___fwk_get_current_event(void)
 {
@@ -112,6 +154,8 @@ static void test_case_setup(void)
     fwk_mm_calloc_return_val = true;
     get_current_event_return_val = NULL;
     notification_event_count = 0;
+    fanout_target_count = 0;
+    fanout_call_count = 0;
 
     for (i = 0; i < FWK_ARRAY_SIZE(fake_module_dlist_table); i++)
         fwk_list_init(&fake_module_dlist_table[i]);
@@ -356,10 +400,84 @@ static void test_fwk_notification_notify(void)
     notification_event_count = 0;
 }
 
+static void check_fanout(const fwk_id_t *target_table, unsigned int count)
+{
+    int result;
+    struct fwk_event notification_event = {
+        .source_id = FWK_ID_ELEMENT(0x2, 0x9),
+        .id = FWK_ID_NOTIFICATION(0x2, 0x1),
+    };
+    unsigned int notification_count, i;
+
+    fanout_call_count = 0;
+    result = fwk_notification_notify(&notification_event, &notification_count);
+    assert(result == FWK_SUCCESS);
+    assert(fanout_call_count == 1);
+    assert(notification_count == count);
+    assert(fanout_target_count == count);
+
+    for (i = 0; i < count; i++) {
+        assert(fwk_id_is_equal(fanout_target_table[i], target_table[i]));
+    }
+
+    /* The notification is not copied per target */
+    assert(notification_event_count == 0);
+}
+
+static void test_fwk_notification_freeze(void)
+{
+    int result;
+    unsigned int i;
+    fwk_id_t notification_id = FWK_ID_NOTIFICATION(0x2, 0x1);
+    fwk_id_t source_id = FWK_ID_ELEMENT(0x2, 0x9);
+    fwk_id_t target_table[3] = {
+        FWK_ID_MODULE(0x4),
+        FWK_ID_ELEMENT(0x6, 0x1),
+        FWK_ID_ELEMENT(0x7, 0x2),
+    };
+
+    result = fwk_notification_subscribe(
+        notification_id, source_id, target_table[0]);
+    assert(result == FWK_SUCCESS);
+    result = fwk_notification_subscribe(
+        notification_id, source_id, target_table[1]);
+    assert(result == FWK_SUCCESS);
+    result = fwk_notification_subscribe(
+        notification_id, FWK_ID_MODULE(0x2), target_table[2]);
+    assert(result == FWK_SUCCESS);
+
+    __fwk_notification_freeze();
+    check_fanout(target_table, 2);
+
+    /* Subscription made after the freeze */
+    result = fwk_notification_subscribe(
+        notification_id, source_id, target_table[2]);
+    assert(result == FWK_SUCCESS);
+    check_fanout(target_table, 3);
+
+    /* Subscription removed after the freeze */
+    result = fwk_notification_unsubscribe(
+        notification_id, source_id, target_table[0]);
+    assert(result == FWK_SUCCESS);
+    check_fanout(&target_table[1], 2);
+
+    /* Churn the subscriptions until the fan-out table is compacted */
+    for (i = 0; i < FMW_NOTIFICATION_MAX; i++) {
+        result = fwk_notification_subscribe(
+            notification_id, source_id, target_table[0]);
+        assert(result == FWK_SUCCESS);
+        result = fwk_notification_unsubscribe(
+            notification_id, source_id, target_table[0]);
+        assert(result == FWK_SUCCESS);
+    }
+    check_fanout(&target_table[1], 2);
+}
+
 static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test_fwk_notification_subscribe),
     FWK_TEST_CASE(test_fwk_notification_unsubscribe),
-    FWK_TEST_CASE(test_fwk_notification_notify)
+    FWK_TEST_CASE(test_fwk_notification_notify),
+    FWK_TEST_CASE(test_fwk_notification_freeze),
 };
 
 struct fwk_test_suite_desc test_suite = {
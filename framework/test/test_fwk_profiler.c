@@ -0,0 +1,288 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <internal/fwk_context.h>
+#include <internal/fwk_core.h>
+#include <internal/fwk_module.h>
+
+#include <fwk_assert.h>
+#include <fwk_core.h>
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_profiler.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+#include <fwk_time.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define MODULE_SOURCE FWK_MODULE_IDX_TEST0
+#define MODULE_TARGET FWK_MODULE_IDX_TEST1
+#define MODULE_COUNT FWK_MODULE_IDX_COUNT
+
+#define EVENT_IDX_FAST 0
+#define EVENT_IDX_SLOW 1
+#define EVENT_COUNT 2
+
+/* Time spent by the handler of the target module for each event */
+#define EVENT_FAST_DURATION FWK_NS(500)
+#define EVENT_SLOW_DURATION FWK_US(3)
+
+static struct __fwk_ctx *ctx;
+
+static struct fwk_module fake_module_desc[MODULE_COUNT];
+static const struct fwk_module_config fake_module_config;
+static struct fwk_module_context fake_module_ctx[MODULE_COUNT];
+
+static fwk_timestamp_t current_time;
+static bool interrupt_get_current_return_val;
+
+/* Mock functions */
+void *__wrap_fwk_mm_calloc(size_t num, size_t size)
+{
+    return calloc(num, size);
+}
+
+struct fwk_module_context *__wrap_fwk_module_get_ctx(fwk_id_t id)
+{
+    return &fake_module_ctx[fwk_id_get_module_idx(id)];
+}
+
+bool __wrap_fwk_module_is_valid_entity_id(fwk_id_t id)
+{
+    return true;
+}
+
+bool __wrap_fwk_module_is_valid_event_id(fwk_id_t id)
+{
+    return true;
+}
+
+int __wrap_fwk_interrupt_global_enable(void)
+{
+    return FWK_SUCCESS;
+}
+
+int __wrap_fwk_interrupt_global_disable(void)
+{
+    return FWK_SUCCESS;
+}
+
+bool __wrap_fwk_is_interrupt_context(void)
+{
+    return interrupt_get_current_return_val;
+}
+
+fwk_timestamp_t __wrap_fwk_time_current(void)
+{
+    return current_time;
+}
+
+static int process_event(
+    const struct fwk_event *event,
+    struct fwk_event *response_event)
+{
+    if (fwk_id_get_event_idx(event->id) == EVENT_IDX_FAST) {
+        current_time += EVENT_FAST_DURATION;
+    } else {
+        current_time += EVENT_SLOW_DURATION;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int test_suite_setup(void)
+{
+    unsigned int i;
+
+    ctx = __fwk_get_ctx();
+
+    for (i = 0; i < MODULE_COUNT; i++) {
+        fake_module_desc[i].process_event = process_event;
+        fake_module_ctx[i].desc = &fake_module_desc[i];
+        fake_module_ctx[i].config = &fake_module_config;
+    }
+
+    fake_module_desc[MODULE_TARGET].event_count = EVENT_COUNT;
+
+    return FWK_SUCCESS;
+}
+
+static void test_case_setup(void)
+{
+    int result;
+
+    interrupt_get_current_return_val = false;
+    current_time = FWK_US(1);
+
+    result = __fwk_init(8);
+    assert(result == FWK_SUCCESS);
+}
+
+static void test_case_teardown(void)
+{
+    *ctx = (struct __fwk_ctx){};
+}
+
+static void put_test_event(unsigned int event_idx)
+{
+    int result;
+
+    struct fwk_event event = {
+        .source_id = FWK_ID_MODULE(MODULE_SOURCE),
+        .target_id = FWK_ID_MODULE(MODULE_TARGET),
+        .id = FWK_ID_EVENT(MODULE_TARGET, event_idx),
+    };
+
+    result = fwk_put_event(&event);
+    assert(result == FWK_SUCCESS);
+}
+
+static void test_profiler_dispatch_latency(void)
+{
+    int result;
+    struct fwk_profiler_latency latency;
+
+    put_test_event(EVENT_IDX_FAST);
+    put_test_event(EVENT_IDX_SLOW);
+    put_test_event(EVENT_IDX_FAST);
+
+    fwk_process_event_queue();
+
+    result = fwk_profiler_get_dispatch_latency(
+        FWK_ID_MODULE(MODULE_TARGET), &latency);
+    assert(result == FWK_SUCCESS);
+    assert(latency.count == 3);
+    assert(latency.min == EVENT_FAST_DURATION);
+    assert(latency.max == EVENT_SLOW_DURATION);
+    assert(latency.total == ((2 * EVENT_FAST_DURATION) + EVENT_SLOW_DURATION));
+
+    /* Below one microsecond, and in [2, 4) microseconds */
+    assert(latency.histogram[0] == 2);
+    assert(latency.histogram[2] == 1);
+
+    result = fwk_profiler_get_dispatch_latency(
+        FWK_ID_EVENT(MODULE_TARGET, EVENT_IDX_SLOW), &latency);
+    assert(result == FWK_SUCCESS);
+    assert(latency.count == 1);
+    assert(latency.min == EVENT_SLOW_DURATION);
+    assert(latency.max == EVENT_SLOW_DURATION);
+
+    result = fwk_profiler_get_dispatch_latency(
+        FWK_ID_MODULE(MODULE_SOURCE), &latency);
+    assert(result == FWK_SUCCESS);
+    assert(latency.count == 0);
+
+    /* No ISR event was processed */
+    result = fwk_profiler_get_isr_latency(&latency);
+    assert(result == FWK_SUCCESS);
+    assert(latency.count == 0);
+
+    fwk_profiler_reset();
+
+    result = fwk_profiler_get_dispatch_latency(
+        FWK_ID_EVENT(MODULE_TARGET, EVENT_IDX_FAST), &latency);
+    assert(result == FWK_SUCCESS);
+    assert(latency.count == 0);
+}
+
+static void test_profiler_isr_latency(void)
+{
+    int result;
+    struct fwk_profiler_latency latency;
+
+    interrupt_get_current_return_val = true;
+    put_test_event(EVENT_IDX_FAST);
+    interrupt_get_current_return_val = false;
+
+    current_time += FWK_US(10);
+
+    fwk_process_event_queue();
+
+    result = fwk_profiler_get_isr_latency(&latency);
+    assert(result == FWK_SUCCESS);
+    assert(latency.count == 1);
+    assert(latency.min == FWK_US(10));
+    assert(latency.max == FWK_US(10));
+
+    /* In [8, 16) microseconds */
+    assert(latency.histogram[4] == 1);
+}
+
+static void test_profiler_queue_stats(void)
+{
+    int result;
+    struct fwk_profiler_queue_stats stats;
+
+    put_test_event(EVENT_IDX_FAST);
+    put_test_event(EVENT_IDX_FAST);
+
+    interrupt_get_current_return_val = true;
+    put_test_event(EVENT_IDX_SLOW);
+    interrupt_get_current_return_val = false;
+
+    result = fwk_profiler_get_queue_stats(&stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.event_queue_depth == 2);
+    assert(stats.event_queue_peak == 2);
+    assert(stats.isr_event_queue_depth == 1);
+    assert(stats.isr_event_queue_peak == 1);
+
+    fwk_process_event_queue();
+
+    result = fwk_profiler_get_queue_stats(&stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.event_queue_depth == 0);
+    assert(stats.isr_event_queue_depth == 0);
+    assert(stats.isr_event_queue_peak == 1);
+
+    fwk_profiler_reset();
+
+    result = fwk_profiler_get_queue_stats(&stats);
+    assert(result == FWK_SUCCESS);
+    assert(stats.event_queue_peak == 0);
+    assert(stats.isr_event_queue_peak == 0);
+}
+
+static void test_profiler_param(void)
+{
+    int result;
+    struct fwk_profiler_latency latency;
+
+    result = fwk_profiler_get_dispatch_latency(
+        FWK_ID_MODULE(MODULE_TARGET), NULL);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_profiler_get_dispatch_latency(
+        FWK_ID_EVENT(MODULE_TARGET, EVENT_COUNT), &latency);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_profiler_get_isr_latency(NULL);
+    assert(result == FWK_E_PARAM);
+
+    result = fwk_profiler_get_queue_stats(NULL);
+    assert(result == FWK_E_PARAM);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_profiler_dispatch_latency),
+    FWK_TEST_CASE(test_profiler_isr_latency),
+    FWK_TEST_CASE(test_profiler_queue_stats),
+    FWK_TEST_CASE(test_profiler_param),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_profiler",
+    .test_suite_setup = test_suite_setup,
+    .test_case_setup = test_case_setup,
+    .test_case_teardown = test_case_teardown,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
@@ -0,0 +1,299 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <fwk_macros.h>
+#include <fwk_ring_spsc.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define RING_STORAGE_SIZE 8
+
+/* Number of bytes transferred by each stress test */
+#define STRESS_TRANSFER_SIZE (1024 * 1024)
+
+/* Storage of the stress tests, small enough to fill up often */
+#define STRESS_STORAGE_SIZE 64
+
+static struct fwk_ring_spsc ring;
+static char ring_storage[RING_STORAGE_SIZE];
+
+static const char data_in[RING_STORAGE_SIZE] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+struct stress_ctx {
+    struct fwk_ring_spsc ring;
+
+    /* Whether the threads use the span interface rather than copies */
+    bool use_spans;
+
+    /* Number of bytes received out of sequence */
+    size_t error_count;
+};
+
+static void test_case_setup(void)
+{
+    memset(ring_storage, 0x7F, sizeof(ring_storage));
+
+    fwk_ring_spsc_init(&ring, ring_storage, sizeof(ring_storage));
+}
+
+static void test_fwk_ring_spsc_init(void)
+{
+    assert(fwk_ring_spsc_get_capacity(&ring) == RING_STORAGE_SIZE);
+    assert(fwk_ring_spsc_get_length(&ring) == 0);
+    assert(fwk_ring_spsc_get_free(&ring) == RING_STORAGE_SIZE);
+    assert(fwk_ring_spsc_is_empty(&ring));
+}
+
+static void test_fwk_ring_spsc_push_pop(void)
+{
+    char data_out[RING_STORAGE_SIZE] = { 0 };
+
+    assert(fwk_ring_spsc_pop(&ring, data_out, sizeof(data_out)) == 0);
+
+    assert(fwk_ring_spsc_push(&ring, data_in, 5) == 5);
+    assert(fwk_ring_spsc_get_length(&ring) == 5);
+    assert(fwk_ring_spsc_get_free(&ring) == 3);
+    assert(!fwk_ring_spsc_is_empty(&ring));
+
+    assert(fwk_ring_spsc_pop(&ring, data_out, 2) == 2);
+    assert((data_out[0] == 0) && (data_out[1] == 1));
+
+    assert(fwk_ring_spsc_pop(&ring, data_out, sizeof(data_out)) == 3);
+    assert(memcmp(data_out, &data_in[2], 3) == 0);
+    assert(fwk_ring_spsc_is_empty(&ring));
+}
+
+static void test_fwk_ring_spsc_push_full(void)
+{
+    char data_out[RING_STORAGE_SIZE] = { 0 };
+
+    assert(fwk_ring_spsc_push(&ring, data_in, 6) == 6);
+
+    /* Old data is never overwritten */
+    assert(fwk_ring_spsc_push(&ring, data_in, 6) == 2);
+    assert(fwk_ring_spsc_get_free(&ring) == 0);
+    assert(fwk_ring_spsc_push(&ring, data_in, 1) == 0);
+
+    assert(fwk_ring_spsc_pop(&ring, data_out, sizeof(data_out)) == 8);
+    assert(memcmp(data_out, data_in, 6) == 0);
+    assert((data_out[6] == 0) && (data_out[7] == 1));
+}
+
+static void test_fwk_ring_spsc_wrap(void)
+{
+    char data_out[RING_STORAGE_SIZE] = { 0 };
+
+    assert(fwk_ring_spsc_push(&ring, data_in, 6) == 6);
+    assert(fwk_ring_spsc_pop(&ring, NULL, 6) == 6);
+
+    /* The data is split between the end and the start of the storage */
+    assert(fwk_ring_spsc_push(&ring, data_in, 8) == 8);
+    assert((ring_storage[6] == 0) && (ring_storage[7] == 1));
+    assert((ring_storage[0] == 2) && (ring_storage[5] == 7));
+
+    assert(fwk_ring_spsc_peek(&ring, data_out, 3) == 3);
+    assert(memcmp(data_out, data_in, 3) == 0);
+    assert(fwk_ring_spsc_get_length(&ring) == 8);
+
+    assert(fwk_ring_spsc_pop(&ring, data_out, sizeof(data_out)) == 8);
+    assert(memcmp(data_out, data_in, sizeof(data_in)) == 0);
+}
+
+static void test_fwk_ring_spsc_index_overflow(void)
+{
+    char data_out[RING_STORAGE_SIZE] = { 0 };
+
+    ring.head = SIZE_MAX - 2;
+    ring.tail = SIZE_MAX - 2;
+
+    assert(fwk_ring_spsc_push(&ring, data_in, 8) == 8);
+    assert(ring.tail == 5);
+    assert(fwk_ring_spsc_get_length(&ring) == 8);
+
+    assert(fwk_ring_spsc_pop(&ring, data_out, sizeof(data_out)) == 8);
+    assert(memcmp(data_out, data_in, sizeof(data_in)) == 0);
+    assert(fwk_ring_spsc_is_empty(&ring));
+}
+
+static void test_fwk_ring_spsc_spans(void)
+{
+    const char *read_span;
+    char *write_span;
+    size_t size;
+
+    assert(fwk_ring_spsc_push(&ring, data_in, 5) == 5);
+    assert(fwk_ring_spsc_pop(&ring, NULL, 3) == 3);
+
+    /* The write span stops at the end of the storage */
+    size = fwk_ring_spsc_acquire_write(&ring, &write_span);
+    assert(size == 3);
+    assert(write_span == &ring_storage[5]);
+    memcpy(write_span, &data_in[5], size);
+    fwk_ring_spsc_commit_write(&ring, size);
+
+    size = fwk_ring_spsc_acquire_write(&ring, &write_span);
+    assert(size == 3);
+    assert(write_span == ring_storage);
+
+    /* Nothing is visible to the consumer until committed */
+    assert(fwk_ring_spsc_get_length(&ring) == 5);
+
+    /* The read span stops at the end of the storage */
+    size = fwk_ring_spsc_acquire_read(&ring, &read_span);
+    assert(size == 5);
+    assert(read_span == &ring_storage[3]);
+    assert(memcmp(read_span, &data_in[3], size) == 0);
+    fwk_ring_spsc_release_read(&ring, 2);
+
+    size = fwk_ring_spsc_acquire_read(&ring, &read_span);
+    assert(size == 3);
+    assert(read_span == &ring_storage[5]);
+    fwk_ring_spsc_release_read(&ring, size);
+
+    size = fwk_ring_spsc_acquire_read(&ring, &read_span);
+    assert(size == 0);
+    assert(fwk_ring_spsc_is_empty(&ring));
+}
+
+static void *stress_producer(void *arg)
+{
+    struct stress_ctx *ctx = arg;
+    char chunk[STRESS_STORAGE_SIZE];
+    char *span;
+    size_t sent = 0;
+    size_t size, i;
+
+    while (sent < STRESS_TRANSFER_SIZE) {
+        /* Vary the transfer sizes to move the wrapping point around */
+        size = (sent % (STRESS_STORAGE_SIZE - 1)) + 1;
+        size = FWK_MIN(size, STRESS_TRANSFER_SIZE - sent);
+
+        if (ctx->use_spans) {
+            size =
+                FWK_MIN(size, fwk_ring_spsc_acquire_write(&ctx->ring, &span));
+            for (i = 0; i < size; i++) {
+                span[i] = (char)(sent + i);
+            }
+            fwk_ring_spsc_commit_write(&ctx->ring, size);
+        } else {
+            for (i = 0; i < size; i++) {
+                chunk[i] = (char)(sent + i);
+            }
+            size = fwk_ring_spsc_push(&ctx->ring, chunk, size);
+        }
+
+        /* Let the consumer run when the host has a single processor */
+        if (size == 0) {
+            sched_yield();
+        }
+
+        sent += size;
+    }
+
+    return NULL;
+}
+
+static void *stress_consumer(void *arg)
+{
+    struct stress_ctx *ctx = arg;
+    char chunk[STRESS_STORAGE_SIZE];
+    const char *span;
+    const char *data;
+    size_t received = 0;
+    size_t size, i;
+
+    while (received < STRESS_TRANSFER_SIZE) {
+        size = (received % (STRESS_STORAGE_SIZE - 3)) + 1;
+
+        if (ctx->use_spans) {
+            size =
+                FWK_MIN(size, fwk_ring_spsc_acquire_read(&ctx->ring, &span));
+            data = span;
+        } else {
+            size = fwk_ring_spsc_pop(&ctx->ring, chunk, size);
+            data = chunk;
+        }
+
+        for (i = 0; i < size; i++) {
+            if (data[i] != (char)(received + i)) {
+                ctx->error_count++;
+            }
+        }
+
+        if (ctx->use_spans) {
+            fwk_ring_spsc_release_read(&ctx->ring, size);
+        }
+
+        if (size == 0) {
+            sched_yield();
+        }
+
+        received += size;
+    }
+
+    return NULL;
+}
+
+static void run_stress_test(bool use_spans)
+{
+    static char storage[STRESS_STORAGE_SIZE];
+    struct stress_ctx ctx = { .use_spans = use_spans };
+    pthread_t producer, consumer;
+    int status;
+
+    fwk_ring_spsc_init(&ctx.ring, storage, sizeof(storage));
+
+    status = pthread_create(&consumer, NULL, stress_consumer, &ctx);
+    assert(status == 0);
+    status = pthread_create(&producer, NULL, stress_producer, &ctx);
+    assert(status == 0);
+
+    status = pthread_join(producer, NULL);
+    assert(status == 0);
+    status = pthread_join(consumer, NULL);
+    assert(status == 0);
+
+    assert(ctx.error_count == 0);
+    assert(fwk_ring_spsc_is_empty(&ctx.ring));
+    assert(ctx.ring.tail == STRESS_TRANSFER_SIZE);
+}
+
+static void test_fwk_ring_spsc_stress_copy(void)
+{
+    run_stress_test(false);
+}
+
+static void test_fwk_ring_spsc_stress_spans(void)
+{
+    run_stress_test(true);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_ring_spsc_init),
+    FWK_TEST_CASE(test_fwk_ring_spsc_push_pop),
+    FWK_TEST_CASE(test_fwk_ring_spsc_push_full),
+    FWK_TEST_CASE(test_fwk_ring_spsc_wrap),
+    FWK_TEST_CASE(test_fwk_ring_spsc_index_overflow),
+    FWK_TEST_CASE(test_fwk_ring_spsc_spans),
+    FWK_TEST_CASE(test_fwk_ring_spsc_stress_copy),
+    FWK_TEST_CASE(test_fwk_ring_spsc_stress_spans),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_ring_spsc",
+    .test_case_setup = test_case_setup,
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
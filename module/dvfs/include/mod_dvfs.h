@@ -36,6 +36,48 @@ struct mod_dvfs_opp {
     uint32_t power; /*!< Power draw in milliwatts (mW) */
 };
 
+/*!
+ * \brief Rounding applied when looking up the nearest operating point.
+ */
+enum mod_dvfs_opp_rounding {
+    /*! Highest operating point at or below the requested value */
+    MOD_DVFS_OPP_ROUNDING_DOWN,
+
+    /*! Lowest operating point at or above the requested value */
+    MOD_DVFS_OPP_ROUNDING_UP,
+
+    /*! Number of rounding modes */
+    MOD_DVFS_OPP_ROUNDING_COUNT,
+};
+
+/*!
+ * \brief Level request of a batch.
+ */
+struct mod_dvfs_level_request {
+    /*! Element identifier of the domain */
+    fwk_id_t domain_id;
+
+    /*! Context-specific value */
+    uintptr_t cookie;
+
+    /*! Requested level */
+    uint32_t level;
+};
+
+/*!
+ * \brief Request coalescing statistics of a domain.
+ */
+struct mod_dvfs_stats {
+    /*! Pending requests superseded by a later request before being started */
+    uint32_t merged_requests;
+
+    /*!
+     * Transitions retargeted to a later request part-way through, skipping
+     * the remaining step towards the superseded operating point.
+     */
+    uint32_t skipped_transitions;
+};
+
 /*!
  * \}
  */
@@ -83,7 +125,8 @@ struct mod_dvfs_domain_config {
      * \brief Operating points.
      *
      * \note The frequencies and levels of these operating points must be in
-     *      ascending order.
+     *      ascending order. Operating points are looked up by bisection, or
+     *      directly when their levels are consecutive.
      */
     struct mod_dvfs_opp *opps;
 };
@@ -148,6 +191,44 @@ struct mod_dvfs_domain_api {
      */
     int (*get_level_id)(fwk_id_t domain_id, uint32_t level, size_t *level_id);
 
+    /*!
+     * \brief Get the nearest operating point to a level.
+     *
+     * \param domain_id Element identifier of the domain.
+     * \param level Requested level.
+     * \param rounding Direction in which to round a level that does not match
+     *      an operating point.
+     * \param [out] opp Nearest operating point.
+     *
+     * \retval ::FWK_SUCCESS The operating point was found.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     * \retval ::FWK_E_RANGE No operating point lies in the rounding direction.
+     */
+    int (*get_nearest_opp_for_level)(
+        fwk_id_t domain_id,
+        uint32_t level,
+        enum mod_dvfs_opp_rounding rounding,
+        struct mod_dvfs_opp *opp);
+
+    /*!
+     * \brief Get the nearest operating point to a frequency.
+     *
+     * \param domain_id Element identifier of the domain.
+     * \param frequency Requested frequency in Hertz (Hz).
+     * \param rounding Direction in which to round a frequency that does not
+     *      match an operating point.
+     * \param [out] opp Nearest operating point.
+     *
+     * \retval ::FWK_SUCCESS The operating point was found.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     * \retval ::FWK_E_RANGE No operating point lies in the rounding direction.
+     */
+    int (*get_nearest_opp_for_frequency)(
+        fwk_id_t domain_id,
+        uint32_t frequency,
+        enum mod_dvfs_opp_rounding rounding,
+        struct mod_dvfs_opp *opp);
+
     /*!
      * \brief Get the worst-case transition latency of a domain.
      *
@@ -162,8 +243,48 @@ struct mod_dvfs_domain_api {
      * \param domain_id Element identifier of the domain.
      * \param cookie Context-specific value.
      * \param level Requested level.
+     *
+     * \note Levels requested while a transition is in progress are coalesced,
+     *      only the most recent one is applied. A transition still in
+     *      progress is redirected to it when its current step completes.
      */
     int (*set_level)(fwk_id_t domain_id, uintptr_t cookie, uint32_t level);
+
+    /*!
+     * \brief Set the levels of several domains.
+     *
+     * \details The transitions of the domains that are idle are started by
+     *      a single event. The transitions of the domains sharing a power
+     *      supply are carried out one after the other, the ones lowering the
+     *      performance of a domain first so that the voltage of the supply is
+     *      raised last. Requests for busy domains are coalesced as for
+     *      set_level().
+     *
+     * \param requests Level requests, at most one per domain.
+     * \param count Number of level requests.
+     *
+     * \retval ::FWK_SUCCESS The requests were accepted.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered. The requests
+     *      with valid parameters were accepted.
+     * \retval ::FWK_E_RANGE A requested level does not exist. The requests for
+     *      existing levels were accepted.
+     * \return One of the standard framework error codes if the batch could
+     *      not be started.
+     */
+    int (*set_levels)(
+        const struct mod_dvfs_level_request *requests,
+        size_t count);
+
+    /*!
+     * \brief Get the request coalescing statistics of a domain.
+     *
+     * \param domain_id Element identifier of the domain.
+     * \param [out] stats Request coalescing statistics.
+     *
+     * \retval ::FWK_SUCCESS The statistics were returned.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     */
+    int (*get_stats)(fwk_id_t domain_id, struct mod_dvfs_stats *stats);
 };
 
 /*!
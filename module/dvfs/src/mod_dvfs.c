@@ -32,6 +32,8 @@
 enum mod_dvfs_internal_event_idx {
     /* retry request */
     MOD_DVFS_INTERNAL_EVENT_IDX_RETRY = MOD_DVFS_EVENT_IDX_COUNT,
+    /* start the transitions of a batch of requests */
+    MOD_DVFS_INTERNAL_EVENT_IDX_SET_BATCH,
     MOD_DVFS_INTERNAL_EVENT_IDX_COUNT,
 };
 
@@ -39,6 +41,11 @@ enum mod_dvfs_internal_event_idx {
 static const fwk_id_t mod_dvfs_event_id_retry =
     FWK_ID_EVENT_INIT(FWK_MODULE_IDX_DVFS, MOD_DVFS_INTERNAL_EVENT_IDX_RETRY);
 
+/* Batch request event identifier */
+static const fwk_id_t mod_dvfs_event_id_set_batch = FWK_ID_EVENT_INIT(
+    FWK_MODULE_IDX_DVFS,
+    MOD_DVFS_INTERNAL_EVENT_IDX_SET_BATCH);
+
 /*!
  * \brief Domain states for GET_OPP/SET_OPP.
  */
@@ -111,6 +118,18 @@ struct mod_dvfs_domain_ctx {
     /* Number of operating points */
     size_t opp_count;
 
+    /* Operating point levels and frequencies are in strictly ascending order */
+    bool opps_sorted;
+
+    /* Operating point voltages are in ascending order */
+    bool voltages_sorted;
+
+    /*
+     * Operating point levels are consecutive, so that the index of an
+     * operating point is its level minus the level of the first one.
+     */
+    bool levels_contiguous;
+
     /* Current operating point */
     struct mod_dvfs_opp current_opp;
 
@@ -128,6 +147,25 @@ struct mod_dvfs_domain_ctx {
 
     /* SET_OPP Request is pending for this domain */
     bool request_pending;
+
+    /*
+     * Supply voltage and clock frequency when the current step of a SET_OPP
+     * request started.
+     */
+    uint32_t step_voltage;
+    uint32_t step_frequency;
+
+    /* Request coalescing statistics */
+    struct mod_dvfs_stats stats;
+
+    /* Transition of a batch waiting to be started */
+    bool batched;
+
+    /*
+     * Transition started by a batch. The power supply and clock responses are
+     * received by the module rather than by the domain.
+     */
+    bool batch_transition;
 };
 
 static struct mod_dvfs_ctx {
@@ -142,8 +180,20 @@ static struct mod_dvfs_ctx {
 
     /* DVFS device context table */
     struct mod_dvfs_domain_ctx (*domain_ctx)[];
+
+    /* A batch event has been sent and not processed yet */
+    bool batch_event_pending;
 } dvfs_ctx;
 
+/*
+ * Keys used to look up an operating point
+ */
+enum dvfs_opp_key {
+    DVFS_OPP_KEY_LEVEL,
+    DVFS_OPP_KEY_VOLTAGE,
+    DVFS_OPP_KEY_FREQUENCY,
+};
+
 /*
  * DVFS Helper Functions
  */
@@ -158,6 +208,44 @@ static struct mod_dvfs_domain_ctx *get_domain_ctx(fwk_id_t domain_id)
     }
 }
 
+/*
+ * Find the domain of a transition started by a batch from the power supply or
+ * clock that sent a response to the module.
+ */
+static struct mod_dvfs_domain_ctx *get_batch_transition_ctx(fwk_id_t source_id)
+{
+    struct mod_dvfs_domain_ctx *ctx;
+    uint32_t idx;
+
+    for (idx = 0; idx < dvfs_ctx.dvfs_domain_element_count; idx++) {
+        ctx = &(*dvfs_ctx.domain_ctx)[idx];
+        if (ctx->batch_transition &&
+            (fwk_id_is_equal(ctx->config->psu_id, source_id) ||
+             fwk_id_is_equal(ctx->config->clock_id, source_id))) {
+            return ctx;
+        }
+    }
+
+    return NULL;
+}
+
+/* Check whether a transition started by a batch uses a power supply */
+static bool is_batch_psu_busy(fwk_id_t psu_id)
+{
+    struct mod_dvfs_domain_ctx *ctx;
+    uint32_t idx;
+
+    for (idx = 0; idx < dvfs_ctx.dvfs_domain_element_count; idx++) {
+        ctx = &(*dvfs_ctx.domain_ctx)[idx];
+        if (ctx->batch_transition &&
+            fwk_id_is_equal(ctx->config->psu_id, psu_id)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 static size_t count_opps(const struct mod_dvfs_opp *opps)
 {
     const struct mod_dvfs_opp *opp = &opps[0];
@@ -169,24 +257,108 @@ static size_t count_opps(const struct mod_dvfs_opp *opps)
     return (size_t)(opp - &opps[0]);
 }
 
-static const struct mod_dvfs_opp *get_opp_for_level(
+static uint32_t get_opp_key(
+    const struct mod_dvfs_opp *opp,
+    enum dvfs_opp_key key)
+{
+    switch (key) {
+    case DVFS_OPP_KEY_VOLTAGE:
+        return opp->voltage;
+
+    case DVFS_OPP_KEY_FREQUENCY:
+        return opp->frequency;
+
+    default:
+        return opp->level;
+    }
+}
+
+/*
+ * Index of the first operating point whose key is not below a value, or the
+ * number of operating points if there is none. The operating points must be in
+ * ascending order of that key.
+ */
+static size_t opp_lower_bound(
     const struct mod_dvfs_domain_ctx *ctx,
-    uint32_t level)
+    enum dvfs_opp_key key,
+    uint32_t value)
 {
-    const struct mod_dvfs_opp *opp;
-    size_t opp_idx;
+    size_t low = 0;
+    size_t high = ctx->opp_count;
+    size_t mid;
 
-    for (opp_idx = 0; opp_idx < ctx->opp_count; opp_idx++) {
-        opp = &ctx->config->opps[opp_idx];
+    while (low < high) {
+        mid = low + ((high - low) / 2);
 
-        if (opp->level != level) {
-            continue;
+        if (get_opp_key(&ctx->config->opps[mid], key) < value) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+/* Index of the first operating point whose key matches a value */
+static bool find_opp_idx(
+    const struct mod_dvfs_domain_ctx *ctx,
+    enum dvfs_opp_key key,
+    uint32_t value,
+    size_t *opp_idx)
+{
+    const struct mod_dvfs_opp *opps = ctx->config->opps;
+    bool sorted;
+    size_t idx;
+
+    if ((key == DVFS_OPP_KEY_LEVEL) && ctx->levels_contiguous) {
+        /* Levels below the first one wrap around and are out of range */
+        idx = (size_t)(value - opps[0].level);
+        if (idx >= ctx->opp_count) {
+            return false;
         }
 
-        return opp;
+        *opp_idx = idx;
+
+        return true;
     }
 
-    return NULL;
+    sorted = (key == DVFS_OPP_KEY_VOLTAGE) ? ctx->voltages_sorted :
+                                             ctx->opps_sorted;
+
+    if (sorted) {
+        idx = opp_lower_bound(ctx, key, value);
+        if ((idx == ctx->opp_count) || (get_opp_key(&opps[idx], key) != value)) {
+            return false;
+        }
+
+        *opp_idx = idx;
+
+        return true;
+    }
+
+    for (idx = 0; idx < ctx->opp_count; idx++) {
+        if (get_opp_key(&opps[idx], key) == value) {
+            *opp_idx = idx;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static const struct mod_dvfs_opp *get_opp_for_level(
+    const struct mod_dvfs_domain_ctx *ctx,
+    uint32_t level)
+{
+    size_t opp_idx;
+
+    if (!find_opp_idx(ctx, DVFS_OPP_KEY_LEVEL, level, &opp_idx)) {
+        return NULL;
+    }
+
+    return &ctx->config->opps[opp_idx];
 }
 
 static const struct mod_dvfs_opp *get_opp_for_voltage(
@@ -194,19 +366,100 @@ static const struct mod_dvfs_opp *get_opp_for_voltage(
     uint32_t voltage)
 {
     size_t opp_idx;
-    const struct mod_dvfs_opp *opp;
 
-    for (opp_idx = 0; opp_idx < ctx->opp_count; opp_idx++) {
-        opp = &ctx->config->opps[opp_idx];
+    if (!find_opp_idx(ctx, DVFS_OPP_KEY_VOLTAGE, voltage, &opp_idx)) {
+        return NULL;
+    }
 
-        if (opp->voltage != voltage) {
-            continue;
+    return &ctx->config->opps[opp_idx];
+}
+
+/*
+ * Index of the nearest operating point to a level or frequency, rounding
+ * either down or up.
+ */
+static bool find_nearest_opp_idx(
+    const struct mod_dvfs_domain_ctx *ctx,
+    enum dvfs_opp_key key,
+    uint32_t value,
+    enum mod_dvfs_opp_rounding rounding,
+    size_t *opp_idx)
+{
+    const struct mod_dvfs_opp *opps = ctx->config->opps;
+    uint32_t opp_value;
+    bool found = false;
+    size_t idx;
+
+    if (ctx->opps_sorted) {
+        idx = opp_lower_bound(ctx, key, value);
+
+        if (rounding == MOD_DVFS_OPP_ROUNDING_UP) {
+            if (idx == ctx->opp_count) {
+                return false;
+            }
+        } else if (
+            (idx == ctx->opp_count) || (get_opp_key(&opps[idx], key) != value)) {
+            /* The operating point found is above the value */
+            if (idx == 0) {
+                return false;
+            }
+            idx--;
         }
 
-        return opp;
+        *opp_idx = idx;
+
+        return true;
     }
 
-    return NULL;
+    for (idx = 0; idx < ctx->opp_count; idx++) {
+        opp_value = get_opp_key(&opps[idx], key);
+
+        if ((rounding == MOD_DVFS_OPP_ROUNDING_UP) ?
+                ((opp_value >= value) &&
+                 (!found || (opp_value < get_opp_key(&opps[*opp_idx], key)))) :
+                ((opp_value <= value) &&
+                 (!found || (opp_value > get_opp_key(&opps[*opp_idx], key))))) {
+            *opp_idx = idx;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+/*
+ * Check the ordering of the operating points so that the lookups can use the
+ * fastest method available.
+ */
+static void dvfs_index_opps(struct mod_dvfs_domain_ctx *ctx)
+{
+    const struct mod_dvfs_opp *opps = ctx->config->opps;
+    size_t idx;
+
+    ctx->opps_sorted = true;
+    ctx->voltages_sorted = true;
+    ctx->levels_contiguous = true;
+
+    for (idx = 1; idx < ctx->opp_count; idx++) {
+        if ((opps[idx].level <= opps[idx - 1].level) ||
+            (opps[idx].frequency <= opps[idx - 1].frequency)) {
+            ctx->opps_sorted = false;
+        }
+
+        if (opps[idx].voltage < opps[idx - 1].voltage) {
+            ctx->voltages_sorted = false;
+        }
+
+        if (opps[idx].level != (opps[idx - 1].level + 1)) {
+            ctx->levels_contiguous = false;
+        }
+    }
+
+    if (!ctx->opps_sorted) {
+        FWK_LOG_WARN(
+            "[DVFS] Domain %u operating points are not in ascending order",
+            fwk_id_get_element_idx(ctx->domain_id));
+    }
 }
 
 /*
@@ -353,9 +606,17 @@ static void dvfs_create_pending_level_request(
             (new_opp->voltage == ctx->pending_request.new_opp.voltage)) {
             return;
         }
+
+        /* The pending request is superseded before it has been started */
+        ctx->stats.merged_requests++;
     } else {
-        if ((new_opp->frequency == ctx->current_opp.frequency) &&
-            (new_opp->voltage == ctx->current_opp.voltage)) {
+        /*
+         * Compare with the target of the request in progress rather than the
+         * current operating point, so that a request back to the current
+         * operating point redirects the transition instead of being lost.
+         */
+        if ((new_opp->frequency == ctx->request.new_opp.frequency) &&
+            (new_opp->voltage == ctx->request.new_opp.voltage)) {
             return;
         }
 
@@ -430,27 +691,65 @@ static int dvfs_get_level_id(
     size_t *level_id)
 {
     const struct mod_dvfs_domain_ctx *ctx;
-    size_t idx;
 
     ctx = get_domain_ctx(domain_id);
     if (ctx == NULL) {
         return FWK_E_PARAM;
     }
 
-    /*
-     * When the setup code forces platform to provide frequency array
-     * sorted, then this code can be changed to bisect search in order
-     * to speed-up.
-     */
-    for (idx = 0; idx < ctx->opp_count; idx++) {
-        const struct mod_dvfs_opp *opp = &ctx->config->opps[idx];
-        if (opp->level == level) {
-            *level_id = idx;
-            return FWK_SUCCESS;
-        }
+    if (!find_opp_idx(ctx, DVFS_OPP_KEY_LEVEL, level, level_id)) {
+        return FWK_E_PARAM;
     }
 
-    return FWK_E_PARAM;
+    return FWK_SUCCESS;
+}
+
+static int get_nearest_opp(
+    fwk_id_t domain_id,
+    enum dvfs_opp_key key,
+    uint32_t value,
+    enum mod_dvfs_opp_rounding rounding,
+    struct mod_dvfs_opp *opp)
+{
+    const struct mod_dvfs_domain_ctx *ctx;
+    size_t opp_idx;
+
+    if ((opp == NULL) || (rounding >= MOD_DVFS_OPP_ROUNDING_COUNT)) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = get_domain_ctx(domain_id);
+    if (ctx == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (!find_nearest_opp_idx(ctx, key, value, rounding, &opp_idx)) {
+        return FWK_E_RANGE;
+    }
+
+    *opp = ctx->config->opps[opp_idx];
+
+    return FWK_SUCCESS;
+}
+
+static int dvfs_get_nearest_opp_for_level(
+    fwk_id_t domain_id,
+    uint32_t level,
+    enum mod_dvfs_opp_rounding rounding,
+    struct mod_dvfs_opp *opp)
+{
+    return get_nearest_opp(
+        domain_id, DVFS_OPP_KEY_LEVEL, level, rounding, opp);
+}
+
+static int dvfs_get_nearest_opp_for_frequency(
+    fwk_id_t domain_id,
+    uint32_t frequency,
+    enum mod_dvfs_opp_rounding rounding,
+    struct mod_dvfs_opp *opp)
+{
+    return get_nearest_opp(
+        domain_id, DVFS_OPP_KEY_FREQUENCY, frequency, rounding, opp);
 }
 
 static int dvfs_get_opp_count(fwk_id_t domain_id, size_t *opp_count)
@@ -569,20 +868,129 @@ static int dvfs_set_level(fwk_id_t domain_id, uintptr_t cookie, uint32_t level)
     return dvfs_set_level_start(ctx, cookie, new_opp, false, 0);
 }
 
+static int dvfs_set_levels(
+    const struct mod_dvfs_level_request *requests,
+    size_t count)
+{
+    struct mod_dvfs_domain_ctx *ctx;
+    const struct mod_dvfs_opp *new_opp;
+    struct fwk_event_light req;
+    bool batched = false;
+    int status = FWK_SUCCESS;
+    int put_status;
+    size_t i;
+    uint32_t idx;
+
+    if ((requests == NULL) && (count > 0)) {
+        return FWK_E_PARAM;
+    }
+
+    for (i = 0; i < count; i++) {
+        ctx = get_domain_ctx(requests[i].domain_id);
+        if (ctx == NULL) {
+            status = FWK_E_PARAM;
+            continue;
+        }
+
+        /* Only accept levels that exist in the operating point table */
+        new_opp = get_opp_for_level(ctx, requests[i].level);
+        if (new_opp == NULL) {
+            status = FWK_E_RANGE;
+            continue;
+        }
+
+        if (ctx->state != DVFS_DOMAIN_STATE_IDLE) {
+            dvfs_create_pending_level_request(
+                ctx, requests[i].cookie, new_opp, false);
+            continue;
+        }
+
+        if (requests[i].level == ctx->current_opp.level) {
+            continue;
+        }
+
+        ctx->request.cookie = requests[i].cookie;
+        ctx->request.new_opp = *new_opp;
+        ctx->request.retry_request = false;
+        ctx->request.response_required = false;
+        ctx->request.set_source_id = false;
+        ctx->request.num_retries = 0;
+
+        ctx->state = DVFS_DOMAIN_SET_OPP;
+        ctx->batched = true;
+        batched = true;
+    }
+
+    /*
+     * A single event starts the transitions. Domains added to a batch whose
+     * event has not been processed yet are started by that event, and domains
+     * whose power supply is used by a transition of a batch are started when
+     * that transition completes.
+     */
+    if (batched && !dvfs_ctx.batch_event_pending) {
+        req = (struct fwk_event_light){
+            .target_id = fwk_module_id_dvfs,
+            .source_id = fwk_module_id_dvfs,
+            .id = mod_dvfs_event_id_set_batch,
+        };
+
+        put_status = fwk_put_event(&req);
+        if (put_status != FWK_SUCCESS) {
+            for (idx = 0; idx < dvfs_ctx.dvfs_domain_element_count; idx++) {
+                ctx = &(*dvfs_ctx.domain_ctx)[idx];
+                if (ctx->batched && !is_batch_psu_busy(ctx->config->psu_id)) {
+                    ctx->batched = false;
+                    dvfs_cleanup_request(ctx);
+                }
+            }
+
+            return put_status;
+        }
+
+        dvfs_ctx.batch_event_pending = true;
+    }
+
+    return status;
+}
+
+static int dvfs_get_stats(fwk_id_t domain_id, struct mod_dvfs_stats *stats)
+{
+    struct mod_dvfs_domain_ctx *ctx;
+
+    if (stats == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = get_domain_ctx(domain_id);
+    if (ctx == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    *stats = ctx->stats;
+
+    return FWK_SUCCESS;
+}
+
 static const struct mod_dvfs_domain_api dvfs_domain_api = {
     .get_current_opp = dvfs_get_current_opp,
     .get_sustained_opp = dvfs_get_sustained_opp,
     .get_nth_opp = dvfs_get_nth_opp,
     .get_level_id = dvfs_get_level_id,
+    .get_nearest_opp_for_level = dvfs_get_nearest_opp_for_level,
+    .get_nearest_opp_for_frequency = dvfs_get_nearest_opp_for_frequency,
     .get_opp_count = dvfs_get_opp_count,
     .get_latency = dvfs_get_latency,
     .set_level = dvfs_set_level,
+    .set_levels = dvfs_set_levels,
+    .get_stats = dvfs_get_stats,
 };
 
 /*
  * DVFS utility functions
  */
 
+static void dvfs_start_batch_transition(fwk_id_t psu_id);
+
 /*
  * DVFS Request Complete handling.
  */
@@ -669,6 +1077,12 @@ static int dvfs_complete(
             ctx->domain_id, ctx->request.cookie, ctx->current_opp.level);
     }
 
+    /* The power supply is available to the next transition of the batch */
+    if (ctx->batch_transition) {
+        ctx->batch_transition = false;
+        dvfs_start_batch_transition(ctx->config->psu_id);
+    }
+
     /*
      * Now we need to start processing the pending request if any,
      * note that we do not set the state to DOMAIN_STATE_IDLE
@@ -692,14 +1106,19 @@ static int dvfs_complete(
 
 /*
  * The SET_OPP() request has successfully completed the first step,
- * reading the voltage.
+ * reading the voltage. The frequency is the clock rate the domain is
+ * running at, which is zero when it is not known.
  */
 static int dvfs_handle_set_opp(
     struct mod_dvfs_domain_ctx *ctx,
-    uint32_t voltage)
+    uint32_t voltage,
+    uint32_t frequency)
 {
     int status = FWK_SUCCESS;
 
+    ctx->step_voltage = voltage;
+    ctx->step_frequency = frequency;
+
     if (ctx->request.new_opp.voltage > voltage) {
         /*
          * Current < request, increase voltage then set frequency
@@ -756,11 +1175,11 @@ static int dvfs_handle_set_opp(
             ctx->state = DVFS_DOMAIN_SET_OPP_DONE;
             return status;
         }
-    } else if (ctx->current_opp.frequency == 0) {
+    } else if (frequency != ctx->request.new_opp.frequency) {
         /*
-         * At startup the voltage may be set without the frequency having
-         * been set. In this case we must set the frequency regardless of
-         * the voltage.
+         * The voltage is already correct, only the frequency must be set.
+         * This is also the case at startup, when the voltage may be set
+         * without the frequency having been set.
          */
         status = ctx->apis.clock->set_rate(
             ctx->config->clock_id,
@@ -783,6 +1202,38 @@ static int dvfs_handle_set_opp(
     return dvfs_complete(ctx, NULL, status);
 }
 
+/*
+ * A step of a SET_OPP() request has completed and a newer request arrived in
+ * the meantime. Rather than completing the transition to an operating point
+ * that is already stale, continue from the voltage and frequency reached so
+ * far towards the newer one. Requests that need a response are not merged.
+ */
+static bool dvfs_retarget_request(
+    struct mod_dvfs_domain_ctx *ctx,
+    uint32_t voltage,
+    uint32_t frequency,
+    int *status)
+{
+    if (!ctx->request_pending || ctx->request.response_required ||
+        ctx->pending_request.response_required) {
+        return false;
+    }
+
+    ctx->request_pending = false;
+    ctx->request.cookie = ctx->pending_request.cookie;
+    ctx->request.new_opp = ctx->pending_request.new_opp;
+    ctx->request.retry_request = ctx->pending_request.retry_request;
+    ctx->request.num_retries = ctx->pending_request.num_retries;
+    ctx->pending_request = (struct mod_dvfs_request){ 0 };
+
+    ctx->stats.skipped_transitions++;
+
+    ctx->state = DVFS_DOMAIN_SET_OPP;
+    *status = dvfs_handle_set_opp(ctx, voltage, frequency);
+
+    return true;
+}
+
 /*
  * The current voltage has been read. This is the first step of a SET_OPP()
  * request and the only step of a GET_OPP() request. It may have been handled
@@ -802,7 +1253,7 @@ static int dvfs_handle_psu_get_voltage_resp(
     }
 
     if (ctx->state == DVFS_DOMAIN_SET_OPP) {
-        return dvfs_handle_set_opp(ctx, voltage);
+        return dvfs_handle_set_opp(ctx, voltage, ctx->current_opp.frequency);
     }
 
     /*
@@ -844,6 +1295,18 @@ static int dvfs_handle_psu_set_voltage_resp(
     }
 
     if (ctx->state == DVFS_DOMAIN_SET_FREQUENCY) {
+        /*
+         * The voltage has been raised but the frequency is unchanged, the
+         * frequency step can be skipped if the request has been superseded.
+         */
+        if (dvfs_retarget_request(
+                ctx,
+                ctx->request.new_opp.voltage,
+                ctx->step_frequency,
+                &status)) {
+            return status;
+        }
+
         status = ctx->apis.clock->set_rate(
             ctx->config->clock_id,
             (uint64_t)ctx->request.new_opp.frequency * FWK_KHZ,
@@ -885,6 +1348,18 @@ static int dvfs_handle_clk_set_freq_resp(
     }
 
     if (ctx->state == DVFS_DOMAIN_SET_VOLTAGE) {
+        /*
+         * The frequency has been lowered but the voltage is unchanged, the
+         * voltage step can be skipped if the request has been superseded.
+         */
+        if (dvfs_retarget_request(
+                ctx,
+                ctx->step_voltage,
+                ctx->request.new_opp.frequency,
+                &status)) {
+            return status;
+        }
+
         /*
          * Clock set_rate() completed successfully, continue to set_voltage()
          */
@@ -911,6 +1386,101 @@ static int dvfs_handle_clk_set_freq_resp(
     return dvfs_complete(ctx, NULL, status);
 }
 
+/*
+ * Start a SET_OPP() request, the first step is reading the voltage.
+ */
+static int dvfs_start_set_opp(struct mod_dvfs_domain_ctx *ctx)
+{
+    int status;
+    uint32_t voltage;
+
+    if (ctx->current_opp.voltage != 0) {
+        voltage = ctx->current_opp.voltage;
+        status = FWK_SUCCESS;
+    } else {
+        status = ctx->apis.psu->get_voltage(ctx->config->psu_id, &voltage);
+        if (status == FWK_PENDING) {
+            return FWK_SUCCESS;
+        }
+    }
+
+    /*
+     * Handle get_voltage() synchronously
+     */
+    status = dvfs_handle_psu_get_voltage_resp(ctx, NULL, status, voltage);
+    if (status == FWK_PENDING) {
+        return FWK_SUCCESS;
+    }
+    return status;
+}
+
+/*
+ * Start the next transition of a batch on a power supply, unless one is in
+ * progress. The transitions of the domains sharing a supply are carried out
+ * one after the other, the ones lowering the performance of a domain first so
+ * that the voltage of the supply is raised last.
+ */
+static void dvfs_start_batch_transition(fwk_id_t psu_id)
+{
+    struct mod_dvfs_domain_ctx *ctx;
+    struct mod_dvfs_domain_ctx *next = NULL;
+    bool raise, next_raise = false;
+    uint32_t idx;
+    int status;
+
+    if (is_batch_psu_busy(psu_id)) {
+        return;
+    }
+
+    for (idx = 0; idx < dvfs_ctx.dvfs_domain_element_count; idx++) {
+        ctx = &(*dvfs_ctx.domain_ctx)[idx];
+        if (!ctx->batched || !fwk_id_is_equal(ctx->config->psu_id, psu_id)) {
+            continue;
+        }
+
+        raise = (ctx->request.new_opp.frequency > ctx->current_opp.frequency);
+        if ((next == NULL) || (next_raise && !raise)) {
+            next = ctx;
+            next_raise = raise;
+        }
+    }
+
+    if (next == NULL) {
+        return;
+    }
+
+    next->batched = false;
+    next->batch_transition = true;
+
+    /* A transition that fails to start is completed with its error */
+    status = dvfs_start_set_opp(next);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[DVFS] %s @%d", __func__, __LINE__);
+    }
+}
+
+/*
+ * Start the transitions of a batch of requests, one per power supply. The
+ * power supply and clock responses are received by the module while the batch
+ * is processed, and routed to the domain by get_batch_transition_ctx().
+ */
+static int dvfs_process_batch(void)
+{
+    struct mod_dvfs_domain_ctx *ctx;
+    uint32_t idx;
+
+    dvfs_ctx.batch_event_pending = false;
+
+    for (idx = 0; idx < dvfs_ctx.dvfs_domain_element_count; idx++) {
+        ctx = &(*dvfs_ctx.domain_ctx)[idx];
+        if (ctx->batched) {
+            dvfs_start_batch_transition(ctx->config->psu_id);
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
 /*
  * DVFS Module Framework Support
  */
@@ -922,9 +1492,16 @@ static int mod_dvfs_process_event(
     int status;
     struct mod_dvfs_domain_ctx *ctx;
     struct mod_psu_driver_response *psu_response;
-    uint32_t voltage;
 
-    ctx = get_domain_ctx(event->target_id);
+    if (fwk_id_is_equal(event->id, mod_dvfs_event_id_set_batch)) {
+        return dvfs_process_batch();
+    }
+
+    if (fwk_id_is_type(event->target_id, FWK_ID_TYPE_MODULE)) {
+        ctx = get_batch_transition_ctx(event->source_id);
+    } else {
+        ctx = get_domain_ctx(event->target_id);
+    }
     if (ctx == NULL) {
         return FWK_E_PARAM;
     }
@@ -956,24 +1533,7 @@ static int mod_dvfs_process_event(
      * local DVFS event from dvfs_set_level()
      */
     if (fwk_id_is_equal(event->id, mod_dvfs_event_id_set)) {
-        if (ctx->current_opp.voltage != 0) {
-            voltage = ctx->current_opp.voltage;
-            status = FWK_SUCCESS;
-        } else {
-            status = ctx->apis.psu->get_voltage(ctx->config->psu_id, &voltage);
-            if (status == FWK_PENDING) {
-                return FWK_SUCCESS;
-            }
-        }
-
-        /*
-         * Handle get_voltage() synchronously
-         */
-        status = dvfs_handle_psu_get_voltage_resp(ctx, NULL, status, voltage);
-        if (status == FWK_PENDING) {
-            return FWK_SUCCESS;
-        }
-        return status;
+        return dvfs_start_set_opp(ctx);
     }
 
     /*
@@ -1100,6 +1660,8 @@ static int dvfs_element_init(
     ctx->opp_count = count_opps(ctx->config->opps);
     fwk_assert(ctx->opp_count > 0);
 
+    dvfs_index_opps(ctx);
+
     return FWK_SUCCESS;
 }
 
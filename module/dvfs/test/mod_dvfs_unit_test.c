@@ -478,6 +478,610 @@ void utest_dvfs_get_level_id_level_not_found(void)
     TEST_ASSERT_EQUAL(FWK_E_PARAM, return_level_id);
 }
 
+static struct mod_dvfs_opp test_sorted_opps[] = {
+    { .level = 100, .voltage = 10, .frequency = 1000 },
+    { .level = 200, .voltage = 10, .frequency = 2000 },
+    { .level = 300, .voltage = 20, .frequency = 3000 },
+    { .level = 400, .voltage = 30, .frequency = 4000 },
+    { 0 },
+};
+
+void utest_dvfs_index_opps(void)
+{
+    struct mod_dvfs_domain_config config = {
+        .opps = test_sorted_opps,
+    };
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx = {
+        .config = &config,
+        .opp_count = 4,
+    };
+    struct mod_dvfs_opp contiguous_opps[] = {
+        { .level = 5, .voltage = 10, .frequency = 1000 },
+        { .level = 6, .voltage = 20, .frequency = 2000 },
+        { .level = 7, .voltage = 30, .frequency = 3000 },
+    };
+
+    dvfs_index_opps(&dvfs_domain_ctx);
+
+    TEST_ASSERT_TRUE(dvfs_domain_ctx.opps_sorted);
+    TEST_ASSERT_TRUE(dvfs_domain_ctx.voltages_sorted);
+    TEST_ASSERT_FALSE(dvfs_domain_ctx.levels_contiguous);
+
+    config.opps = contiguous_opps;
+    dvfs_domain_ctx.opp_count = FWK_ARRAY_SIZE(contiguous_opps);
+
+    dvfs_index_opps(&dvfs_domain_ctx);
+
+    TEST_ASSERT_TRUE(dvfs_domain_ctx.opps_sorted);
+    TEST_ASSERT_TRUE(dvfs_domain_ctx.levels_contiguous);
+    TEST_ASSERT_EQUAL_PTR(
+        &contiguous_opps[1], get_opp_for_level(&dvfs_domain_ctx, 6));
+    TEST_ASSERT_NULL(get_opp_for_level(&dvfs_domain_ctx, 4));
+    TEST_ASSERT_NULL(get_opp_for_level(&dvfs_domain_ctx, 8));
+}
+
+void utest_dvfs_get_opp_sorted_opps(void)
+{
+    struct mod_dvfs_domain_config config = {
+        .opps = test_sorted_opps,
+    };
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx = {
+        .config = &config,
+        .opp_count = 4,
+    };
+
+    dvfs_index_opps(&dvfs_domain_ctx);
+
+    TEST_ASSERT_EQUAL_PTR(
+        &test_sorted_opps[2], get_opp_for_level(&dvfs_domain_ctx, 300));
+    TEST_ASSERT_NULL(get_opp_for_level(&dvfs_domain_ctx, 250));
+    TEST_ASSERT_NULL(get_opp_for_level(&dvfs_domain_ctx, 500));
+
+    /* The first operating point with a matching voltage is returned */
+    TEST_ASSERT_EQUAL_PTR(
+        &test_sorted_opps[0], get_opp_for_voltage(&dvfs_domain_ctx, 10));
+    TEST_ASSERT_NULL(get_opp_for_voltage(&dvfs_domain_ctx, 15));
+}
+
+void utest_dvfs_get_nearest_opp_for_level(void)
+{
+    fwk_id_t dvfs_id;
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx[1] = { 0 };
+    struct mod_dvfs_domain_config config = {
+        .opps = test_sorted_opps,
+    };
+    struct mod_dvfs_opp opp;
+    int status;
+
+    dvfs_ctx.dvfs_domain_element_count = 1;
+    dvfs_ctx.domain_ctx = &dvfs_domain_ctx;
+
+    dvfs_domain_ctx[0].config = &config;
+    dvfs_domain_ctx[0].opp_count = 4;
+    dvfs_index_opps(&dvfs_domain_ctx[0]);
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 0);
+    status = dvfs_get_nearest_opp_for_level(
+        dvfs_id, 250, MOD_DVFS_OPP_ROUNDING_DOWN, &opp);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(200, opp.level);
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 0);
+    status = dvfs_get_nearest_opp_for_level(
+        dvfs_id, 250, MOD_DVFS_OPP_ROUNDING_UP, &opp);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(300, opp.level);
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 0);
+    status = dvfs_get_nearest_opp_for_level(
+        dvfs_id, 300, MOD_DVFS_OPP_ROUNDING_DOWN, &opp);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(300, opp.level);
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 0);
+    status = dvfs_get_nearest_opp_for_level(
+        dvfs_id, 50, MOD_DVFS_OPP_ROUNDING_DOWN, &opp);
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 0);
+    status = dvfs_get_nearest_opp_for_level(
+        dvfs_id, 450, MOD_DVFS_OPP_ROUNDING_UP, &opp);
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+}
+
+void utest_dvfs_get_nearest_opp_for_frequency(void)
+{
+    fwk_id_t dvfs_id;
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx[1] = { 0 };
+    struct mod_dvfs_domain_config config = {
+        .opps = test_sorted_opps,
+    };
+    struct mod_dvfs_opp opp;
+    int status;
+
+    dvfs_ctx.dvfs_domain_element_count = 1;
+    dvfs_ctx.domain_ctx = &dvfs_domain_ctx;
+
+    dvfs_domain_ctx[0].config = &config;
+    dvfs_domain_ctx[0].opp_count = 4;
+    dvfs_index_opps(&dvfs_domain_ctx[0]);
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 0);
+    status = dvfs_get_nearest_opp_for_frequency(
+        dvfs_id, 3500, MOD_DVFS_OPP_ROUNDING_DOWN, &opp);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(3000, opp.frequency);
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 0);
+    status = dvfs_get_nearest_opp_for_frequency(
+        dvfs_id, 500, MOD_DVFS_OPP_ROUNDING_UP, &opp);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1000, opp.frequency);
+
+    status = dvfs_get_nearest_opp_for_frequency(
+        dvfs_id, 500, MOD_DVFS_OPP_ROUNDING_COUNT, &opp);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+static unsigned int fake_set_rate_count;
+static uint64_t fake_set_rate_rate;
+static unsigned int fake_set_voltage_count;
+static uint32_t fake_set_voltage_voltage;
+
+/* Frequencies (kHz) and voltages (mV) in the order they were set */
+static uint32_t fake_op_log[8];
+static unsigned int fake_op_count;
+
+static int fake_set_rate(
+    fwk_id_t clock_id,
+    uint64_t rate,
+    enum mod_clock_round_mode round_mode)
+{
+    fake_set_rate_count++;
+    fake_set_rate_rate = rate;
+    fake_op_log[fake_op_count++ % FWK_ARRAY_SIZE(fake_op_log)] =
+        (uint32_t)(rate / FWK_KHZ);
+
+    return FWK_SUCCESS;
+}
+
+static int fake_set_voltage(fwk_id_t device_id, uint32_t voltage)
+{
+    fake_set_voltage_count++;
+    fake_set_voltage_voltage = voltage;
+    fake_op_log[fake_op_count++ % FWK_ARRAY_SIZE(fake_op_log)] = voltage;
+
+    return FWK_SUCCESS;
+}
+
+static void fake_notify_level_updated(
+    fwk_id_t domain_id,
+    uintptr_t cookie,
+    uint32_t level)
+{
+}
+
+void utest_dvfs_create_pending_level_request_merged(void)
+{
+    struct mod_dvfs_domain_ctx ctx = {
+        .current_opp = test_sorted_opps[0],
+    };
+
+    dvfs_create_pending_level_request(&ctx, 1, &test_sorted_opps[1], false);
+    TEST_ASSERT_TRUE(ctx.request_pending);
+    TEST_ASSERT_EQUAL(0, ctx.stats.merged_requests);
+
+    /* A request for the pending operating point is not a merge */
+    dvfs_create_pending_level_request(&ctx, 2, &test_sorted_opps[1], false);
+    TEST_ASSERT_EQUAL(0, ctx.stats.merged_requests);
+
+    dvfs_create_pending_level_request(&ctx, 3, &test_sorted_opps[3], false);
+    TEST_ASSERT_EQUAL(1, ctx.stats.merged_requests);
+    TEST_ASSERT_EQUAL(400, ctx.pending_request.new_opp.level);
+    TEST_ASSERT_EQUAL(3, ctx.pending_request.cookie);
+}
+
+void utest_dvfs_retarget_request_after_voltage_raised(void)
+{
+    struct mod_clock_api clock_api = {
+        .set_rate = fake_set_rate,
+    };
+    struct mod_psu_device_api psu_api = {
+        .set_voltage = fake_set_voltage,
+    };
+    struct mod_scmi_perf_updated_api perf_updated_api = {
+        .notify_level_updated = fake_notify_level_updated,
+    };
+    struct mod_dvfs_domain_config config = {
+        .opps = test_sorted_opps,
+    };
+    struct mod_dvfs_domain_ctx ctx = {
+        .config = &config,
+        .apis.clock = &clock_api,
+        .apis.psu = &psu_api,
+        .current_opp = test_sorted_opps[0],
+        .request.new_opp = test_sorted_opps[3],
+        .state = DVFS_DOMAIN_SET_FREQUENCY,
+        .step_voltage = 10,
+        .step_frequency = 1000,
+    };
+    struct fwk_event event = { 0 };
+    struct mod_psu_driver_response *psu_response =
+        (struct mod_psu_driver_response *)event.params;
+    int status;
+
+    dvfs_ctx.scmi_perf_updated_api = &perf_updated_api;
+    fake_set_rate_count = 0;
+    fake_set_voltage_count = 0;
+
+    /* The voltage was raised for level 400, level 300 was requested since */
+    dvfs_create_pending_level_request(&ctx, 0, &test_sorted_opps[2], false);
+
+    psu_response->status = FWK_SUCCESS;
+    status = dvfs_handle_psu_set_voltage_resp(&ctx, &event);
+
+    /* The clock goes to level 300 directly and the voltage is lowered */
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, fake_set_rate_count);
+    TEST_ASSERT_EQUAL(3000 * FWK_KHZ, fake_set_rate_rate);
+    TEST_ASSERT_EQUAL(1, fake_set_voltage_count);
+    TEST_ASSERT_EQUAL(20, fake_set_voltage_voltage);
+    TEST_ASSERT_EQUAL(300, ctx.current_opp.level);
+    TEST_ASSERT_EQUAL(1, ctx.stats.skipped_transitions);
+    TEST_ASSERT_FALSE(ctx.request_pending);
+    TEST_ASSERT_EQUAL(DVFS_DOMAIN_STATE_IDLE, ctx.state);
+}
+
+void utest_dvfs_retarget_request_skips_voltage_step(void)
+{
+    struct mod_clock_api clock_api = {
+        .set_rate = fake_set_rate,
+    };
+    struct mod_psu_device_api psu_api = {
+        .set_voltage = fake_set_voltage,
+    };
+    struct mod_scmi_perf_updated_api perf_updated_api = {
+        .notify_level_updated = fake_notify_level_updated,
+    };
+    struct mod_dvfs_domain_config config = {
+        .opps = test_sorted_opps,
+    };
+    struct mod_dvfs_domain_ctx ctx = {
+        .config = &config,
+        .apis.clock = &clock_api,
+        .apis.psu = &psu_api,
+        .current_opp = test_sorted_opps[2],
+        .request.new_opp = test_sorted_opps[0],
+        .state = DVFS_DOMAIN_SET_VOLTAGE,
+        .step_voltage = 20,
+        .step_frequency = 3000,
+    };
+    struct fwk_event event = { 0 };
+    struct mod_clock_driver_resp_params *clock_response =
+        (struct mod_clock_driver_resp_params *)event.params;
+    int status;
+
+    dvfs_ctx.scmi_perf_updated_api = &perf_updated_api;
+    fake_set_rate_count = 0;
+    fake_set_voltage_count = 0;
+
+    /*
+     * The clock was lowered for level 100, then level 400 and level 300 were
+     * requested. The voltage is still correct for level 300, so only the
+     * clock is restored.
+     */
+    dvfs_create_pending_level_request(&ctx, 0, &test_sorted_opps[3], false);
+    dvfs_create_pending_level_request(&ctx, 0, &test_sorted_opps[2], false);
+    TEST_ASSERT_TRUE(ctx.request_pending);
+    TEST_ASSERT_EQUAL(1, ctx.stats.merged_requests);
+
+    clock_response->status = FWK_SUCCESS;
+    status = dvfs_handle_clk_set_freq_resp(&ctx, &event);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, fake_set_rate_count);
+    TEST_ASSERT_EQUAL(3000 * FWK_KHZ, fake_set_rate_rate);
+    TEST_ASSERT_EQUAL(0, fake_set_voltage_count);
+    TEST_ASSERT_EQUAL(300, ctx.current_opp.level);
+    TEST_ASSERT_EQUAL(1, ctx.stats.skipped_transitions);
+    TEST_ASSERT_EQUAL(DVFS_DOMAIN_STATE_IDLE, ctx.state);
+}
+
+void utest_dvfs_set_levels(void)
+{
+    fwk_id_t dvfs_id[2] = {
+        FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_DVFS, 0),
+        FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_DVFS, 1),
+    };
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx[2] = { 0 };
+    struct mod_dvfs_domain_config config = {
+        .opps = test_sorted_opps,
+    };
+    struct mod_dvfs_level_request requests[] = {
+        { .domain_id = dvfs_id[0], .level = 300 },
+        { .domain_id = dvfs_id[1], .level = 250 },
+    };
+    int status;
+
+    dvfs_ctx.dvfs_domain_element_count = 2;
+    dvfs_ctx.domain_ctx = &dvfs_domain_ctx;
+    dvfs_ctx.batch_event_pending = false;
+
+    dvfs_domain_ctx[0].config = &config;
+    dvfs_domain_ctx[0].opp_count = 4;
+    dvfs_domain_ctx[0].current_opp = test_sorted_opps[0];
+    dvfs_domain_ctx[1].config = &config;
+    dvfs_domain_ctx[1].opp_count = 4;
+    dvfs_domain_ctx[1].current_opp = test_sorted_opps[0];
+
+    /* The valid request is batched even though the other one is not */
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id[0], 0);
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id[1], 1);
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = dvfs_set_levels(requests, FWK_ARRAY_SIZE(requests));
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+    TEST_ASSERT_TRUE(dvfs_domain_ctx[0].batched);
+    TEST_ASSERT_EQUAL(DVFS_DOMAIN_SET_OPP, dvfs_domain_ctx[0].state);
+    TEST_ASSERT_EQUAL(300, dvfs_domain_ctx[0].request.new_opp.level);
+    TEST_ASSERT_FALSE(dvfs_domain_ctx[1].batched);
+    TEST_ASSERT_TRUE(dvfs_ctx.batch_event_pending);
+
+    /*
+     * Further requests join the batch whose event is pending, or are
+     * coalesced for domains already part of it.
+     */
+    requests[0].level = 400;
+    requests[1].level = 200;
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id[0], 0);
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id[1], 1);
+
+    status = dvfs_set_levels(requests, FWK_ARRAY_SIZE(requests));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_TRUE(dvfs_domain_ctx[1].batched);
+    TEST_ASSERT_TRUE(dvfs_domain_ctx[0].request_pending);
+    TEST_ASSERT_EQUAL(400, dvfs_domain_ctx[0].pending_request.new_opp.level);
+}
+
+void utest_dvfs_set_levels_put_event_fail(void)
+{
+    fwk_id_t dvfs_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_DVFS, 0);
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx[1] = { 0 };
+    struct mod_dvfs_domain_config config = {
+        .opps = test_sorted_opps,
+    };
+    struct mod_dvfs_level_request request = {
+        .domain_id = dvfs_id,
+        .level = 200,
+    };
+    int status;
+
+    dvfs_ctx.dvfs_domain_element_count = 1;
+    dvfs_ctx.domain_ctx = &dvfs_domain_ctx;
+    dvfs_ctx.batch_event_pending = false;
+
+    dvfs_domain_ctx[0].config = &config;
+    dvfs_domain_ctx[0].opp_count = 4;
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 0);
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_E_NOMEM);
+
+    status = dvfs_set_levels(&request, 1);
+    TEST_ASSERT_EQUAL(FWK_E_NOMEM, status);
+    TEST_ASSERT_FALSE(dvfs_domain_ctx[0].batched);
+    TEST_ASSERT_EQUAL(DVFS_DOMAIN_STATE_IDLE, dvfs_domain_ctx[0].state);
+    TEST_ASSERT_FALSE(dvfs_ctx.batch_event_pending);
+}
+
+/* Events sent by the module, in the order they were sent */
+static struct fwk_event_light fake_events[4];
+static unsigned int fake_event_count;
+
+static int fake_put_event_light(struct fwk_event_light *event, int num_calls)
+{
+    TEST_ASSERT_LESS_THAN(FWK_ARRAY_SIZE(fake_events), fake_event_count);
+    fake_events[fake_event_count++] = *event;
+
+    return FWK_SUCCESS;
+}
+
+static bool fake_id_is_equal(fwk_id_t left, fwk_id_t right, int num_calls)
+{
+    return left.value == right.value;
+}
+
+static bool fake_id_is_type(fwk_id_t id, enum fwk_id_type type, int num_calls)
+{
+    return id.common.type == type;
+}
+
+static int fake_set_voltage_pending(fwk_id_t device_id, uint32_t voltage)
+{
+    fake_set_voltage(device_id, voltage);
+
+    return FWK_PENDING;
+}
+
+void utest_dvfs_process_batch_lowers_first(void)
+{
+    struct mod_clock_api clock_api = {
+        .set_rate = fake_set_rate,
+    };
+    struct mod_psu_device_api psu_api = {
+        .set_voltage = fake_set_voltage,
+    };
+    struct mod_scmi_perf_updated_api perf_updated_api = {
+        .notify_level_updated = fake_notify_level_updated,
+    };
+    struct mod_dvfs_domain_config config = {
+        .psu_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_PSU, 0),
+        .opps = test_sorted_opps,
+    };
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx[2] = { 0 };
+    unsigned int i;
+    int status;
+
+    dvfs_ctx.dvfs_domain_element_count = 2;
+    dvfs_ctx.domain_ctx = &dvfs_domain_ctx;
+    dvfs_ctx.scmi_perf_updated_api = &perf_updated_api;
+    dvfs_ctx.batch_event_pending = true;
+
+    for (i = 0; i < 2; i++) {
+        dvfs_domain_ctx[i].domain_id =
+            (fwk_id_t)FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_DVFS, i);
+        dvfs_domain_ctx[i].config = &config;
+        dvfs_domain_ctx[i].apis.clock = &clock_api;
+        dvfs_domain_ctx[i].apis.psu = &psu_api;
+        dvfs_domain_ctx[i].state = DVFS_DOMAIN_SET_OPP;
+        dvfs_domain_ctx[i].batched = true;
+    }
+
+    /* Domain 0 is raised from level 100 to 400, domain 1 lowered */
+    dvfs_domain_ctx[0].current_opp = test_sorted_opps[0];
+    dvfs_domain_ctx[0].request.new_opp = test_sorted_opps[3];
+    dvfs_domain_ctx[1].current_opp = test_sorted_opps[3];
+    dvfs_domain_ctx[1].request.new_opp = test_sorted_opps[0];
+
+    fake_op_count = 0;
+    fake_event_count = 0;
+    fwk_id_is_equal_Stub(fake_id_is_equal);
+    __fwk_put_event_light_Stub(fake_put_event_light);
+
+    status = dvfs_process_batch();
+    __fwk_put_event_light_Stub(NULL);
+    fwk_id_is_equal_Stub(NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_FALSE(dvfs_ctx.batch_event_pending);
+
+    /* The transitions are started by the batch event itself */
+    TEST_ASSERT_EQUAL(0, fake_event_count);
+    TEST_ASSERT_EQUAL(4, fake_op_count);
+    TEST_ASSERT_EQUAL(1000, fake_op_log[0]);
+    TEST_ASSERT_EQUAL(10, fake_op_log[1]);
+    TEST_ASSERT_EQUAL(30, fake_op_log[2]);
+    TEST_ASSERT_EQUAL(4000, fake_op_log[3]);
+
+    for (i = 0; i < 2; i++) {
+        TEST_ASSERT_FALSE(dvfs_domain_ctx[i].batched);
+        TEST_ASSERT_FALSE(dvfs_domain_ctx[i].batch_transition);
+        TEST_ASSERT_EQUAL(DVFS_DOMAIN_STATE_IDLE, dvfs_domain_ctx[i].state);
+    }
+    TEST_ASSERT_EQUAL(400, dvfs_domain_ctx[0].current_opp.level);
+    TEST_ASSERT_EQUAL(100, dvfs_domain_ctx[1].current_opp.level);
+}
+
+void utest_dvfs_process_batch_shared_psu(void)
+{
+    struct mod_clock_api clock_api = {
+        .set_rate = fake_set_rate,
+    };
+    struct mod_psu_device_api psu_api = {
+        .set_voltage = fake_set_voltage_pending,
+    };
+    struct mod_scmi_perf_updated_api perf_updated_api = {
+        .notify_level_updated = fake_notify_level_updated,
+    };
+    struct mod_dvfs_domain_config config = {
+        .psu_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_PSU, 0),
+        .opps = test_sorted_opps,
+    };
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx[2] = { 0 };
+    struct fwk_event event = {
+        .id = mod_psu_event_id_set_voltage,
+        .source_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_PSU, 0),
+        .target_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_DVFS),
+        .is_response = true,
+    };
+    struct fwk_event resp_event = { 0 };
+    struct mod_psu_driver_response *psu_response =
+        (struct mod_psu_driver_response *)event.params;
+    unsigned int i;
+    int status;
+
+    dvfs_ctx.dvfs_domain_element_count = 2;
+    dvfs_ctx.domain_ctx = &dvfs_domain_ctx;
+    dvfs_ctx.scmi_perf_updated_api = &perf_updated_api;
+    dvfs_ctx.batch_event_pending = true;
+
+    /* Both domains are raised and share the same power supply */
+    for (i = 0; i < 2; i++) {
+        dvfs_domain_ctx[i].domain_id =
+            (fwk_id_t)FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_DVFS, i);
+        dvfs_domain_ctx[i].config = &config;
+        dvfs_domain_ctx[i].apis.clock = &clock_api;
+        dvfs_domain_ctx[i].apis.psu = &psu_api;
+        dvfs_domain_ctx[i].state = DVFS_DOMAIN_SET_OPP;
+        dvfs_domain_ctx[i].batched = true;
+        dvfs_domain_ctx[i].current_opp = test_sorted_opps[0];
+        dvfs_domain_ctx[i].request.new_opp = test_sorted_opps[i + 2];
+    }
+
+    fake_set_voltage_count = 0;
+    fake_set_rate_count = 0;
+    fake_event_count = 0;
+    fwk_id_is_equal_Stub(fake_id_is_equal);
+    fwk_id_is_type_Stub(fake_id_is_type);
+    __fwk_put_event_light_Stub(fake_put_event_light);
+
+    /* Only one transition uses the power supply at a time */
+    status = dvfs_process_batch();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, fake_set_voltage_count);
+    TEST_ASSERT_EQUAL(20, fake_set_voltage_voltage);
+    TEST_ASSERT_TRUE(dvfs_domain_ctx[0].batch_transition);
+    TEST_ASSERT_TRUE(dvfs_domain_ctx[1].batched);
+
+    /*
+     * The power supply responds to the module, the response is routed to
+     * domain 0, whose completion starts the transition of domain 1.
+     */
+    psu_response->status = FWK_SUCCESS;
+    status = mod_dvfs_process_event(&event, &resp_event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, fake_set_rate_count);
+    TEST_ASSERT_EQUAL(300, dvfs_domain_ctx[0].current_opp.level);
+    TEST_ASSERT_FALSE(dvfs_domain_ctx[0].batch_transition);
+    TEST_ASSERT_EQUAL(DVFS_DOMAIN_STATE_IDLE, dvfs_domain_ctx[0].state);
+    TEST_ASSERT_EQUAL(2, fake_set_voltage_count);
+    TEST_ASSERT_EQUAL(30, fake_set_voltage_voltage);
+    TEST_ASSERT_FALSE(dvfs_domain_ctx[1].batched);
+    TEST_ASSERT_TRUE(dvfs_domain_ctx[1].batch_transition);
+
+    status = mod_dvfs_process_event(&event, &resp_event);
+    __fwk_put_event_light_Stub(NULL);
+    fwk_id_is_type_Stub(NULL);
+    fwk_id_is_equal_Stub(NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, fake_set_rate_count);
+    TEST_ASSERT_EQUAL(400, dvfs_domain_ctx[1].current_opp.level);
+    TEST_ASSERT_FALSE(dvfs_domain_ctx[1].batch_transition);
+    TEST_ASSERT_EQUAL(DVFS_DOMAIN_STATE_IDLE, dvfs_domain_ctx[1].state);
+    TEST_ASSERT_EQUAL(0, fake_event_count);
+}
+
+void utest_dvfs_get_stats(void)
+{
+    fwk_id_t dvfs_id;
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx[1] = { 0 };
+    struct mod_dvfs_stats stats;
+    int status;
+
+    dvfs_ctx.dvfs_domain_element_count = 1;
+    dvfs_ctx.domain_ctx = &dvfs_domain_ctx;
+
+    dvfs_domain_ctx[0].stats.merged_requests = 5;
+    dvfs_domain_ctx[0].stats.skipped_transitions = 2;
+
+    status = dvfs_get_stats(dvfs_id, NULL);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 0);
+    status = dvfs_get_stats(dvfs_id, &stats);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(5, stats.merged_requests);
+    TEST_ASSERT_EQUAL(2, stats.skipped_transitions);
+}
+
 void utest_dvfs_get_opp_count_null_opp_count(void)
 {
     fwk_id_t dvfs_id;
@@ -608,6 +1212,21 @@ int dvfs_test_main(void)
     RUN_TEST(utest_dvfs_get_level_id_opp_level_matches_level);
     RUN_TEST(utest_dvfs_get_level_id_level_not_found);
 
+    RUN_TEST(utest_dvfs_index_opps);
+    RUN_TEST(utest_dvfs_get_opp_sorted_opps);
+    RUN_TEST(utest_dvfs_get_nearest_opp_for_level);
+    RUN_TEST(utest_dvfs_get_nearest_opp_for_frequency);
+
+    RUN_TEST(utest_dvfs_create_pending_level_request_merged);
+    RUN_TEST(utest_dvfs_retarget_request_after_voltage_raised);
+    RUN_TEST(utest_dvfs_retarget_request_skips_voltage_step);
+    RUN_TEST(utest_dvfs_get_stats);
+
+    RUN_TEST(utest_dvfs_set_levels);
+    RUN_TEST(utest_dvfs_set_levels_put_event_fail);
+    RUN_TEST(utest_dvfs_process_batch_lowers_first);
+    RUN_TEST(utest_dvfs_process_batch_shared_psu);
+
     RUN_TEST(utest_dvfs_get_opp_count_null_opp_count);
     RUN_TEST(utest_dvfs_get_opp_count_invalid_dvfs_id);
     RUN_TEST(utest_dvfs_get_opp_count);
@@ -13,6 +13,7 @@
 #include <fwk_attributes.h>
 #include <fwk_event.h>
 #include <fwk_log.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
@@ -195,6 +196,58 @@ static bool mod_pl011_getch(fwk_id_t id, char *ch)
     return true;
 }
 
+static size_t mod_pl011_write(fwk_id_t id, const char *buffer, size_t size)
+{
+    const struct mod_pl011_element_cfg *cfg = fwk_module_get_data(id);
+    struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(id)];
+
+    struct pl011_reg *reg = (void *)cfg->reg_base;
+
+    size_t written = 0;
+    size_t burst;
+
+    fwk_assert(ctx->powered);
+    fwk_assert(ctx->clocked);
+
+    while (written < size) {
+        if ((reg->FR & PL011_FR_TXFE) > 0) {
+            /* The FIFO is empty, fill it without polling the flags. */
+            burst = FWK_MIN(size - written, PL011_TX_FIFO_DEPTH);
+        } else if ((reg->FR & PL011_FR_TXFF) == 0) {
+            burst = 1;
+        } else {
+            break;
+        }
+
+        for (; burst > 0; burst--) {
+            reg->DR = (uint16_t)buffer[written++];
+        }
+    }
+
+    return written;
+}
+
+static size_t mod_pl011_read(fwk_id_t id, char *buffer, size_t size)
+{
+    const struct mod_pl011_element_cfg *cfg = fwk_module_get_data(id);
+    struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(id)];
+
+    struct pl011_reg *reg = (void *)cfg->reg_base;
+
+    size_t read = 0;
+
+    fwk_assert(ctx->powered);
+    fwk_assert(ctx->clocked);
+
+    while ((read < size) && ((reg->FR & PL011_FR_RXFE) == 0)) {
+        buffer[read++] = (char)reg->DR;
+    }
+
+    return read;
+}
+
 static void mod_pl011_flush(fwk_id_t id)
 {
     const struct mod_pl011_element_cfg *cfg = fwk_module_get_data(id);
@@ -625,6 +678,52 @@ static int mod_pl011_io_putch(const struct fwk_io_stream *stream, char ch)
     return FWK_SUCCESS;
 }
 
+static int mod_pl011_io_read(
+    const struct fwk_io_stream *restrict stream,
+    char *restrict buffer,
+    size_t size,
+    size_t *restrict read)
+{
+    const struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(stream->id)];
+
+    fwk_assert(ctx->open);
+
+    if (!ctx->powered || !ctx->clocked) {
+        return FWK_E_PWRSTATE;
+    }
+
+    *read = mod_pl011_read(stream->id, buffer, size);
+    if (*read == 0) {
+        return FWK_PENDING;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int mod_pl011_io_write(
+    const struct fwk_io_stream *restrict stream,
+    const char *restrict buffer,
+    size_t size,
+    size_t *restrict written)
+{
+    const struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(stream->id)];
+
+    fwk_assert(ctx->open);
+
+    if (!ctx->powered || !ctx->clocked) {
+        return FWK_E_PWRSTATE;
+    }
+
+    *written = mod_pl011_write(stream->id, buffer, size);
+    if (*written == 0) {
+        return FWK_E_BUSY;
+    }
+
+    return FWK_SUCCESS;
+}
+
 static int mod_pl011_close(const struct fwk_io_stream *stream)
 {
     struct mod_pl011_element_ctx *ctx;
@@ -655,7 +754,9 @@ const struct fwk_module module_pl011 = {
         (struct fwk_io_adapter){
             .open = mod_pl011_io_open,
             .getch = mod_pl011_io_getch,
+            .read = mod_pl011_io_read,
             .putch = mod_pl011_io_putch,
+            .write = mod_pl011_io_write,
             .close = mod_pl011_close,
         },
 };
@@ -78,6 +78,12 @@ struct pl011_reg {
 #define PL011_FR_TXFE (uint16_t)0x0080
 #define PL011_FR_RI   (uint16_t)0x0100
 
+/*
+ * Depth of the transmit FIFO. Revisions r1p5 and later have deeper FIFOs, the
+ * depth of the earlier revisions is safe for all of them.
+ */
+#define PL011_TX_FIFO_DEPTH 16U
+
 #define PL011_LCR_H_BRK        (uint16_t)0x0001
 #define PL011_LCR_H_PEN        (uint16_t)0x0002
 #define PL011_LCR_H_EPS        (uint16_t)0x0004
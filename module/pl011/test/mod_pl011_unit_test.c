@@ -228,6 +228,71 @@ void test_mod_pl011_io_getch(void)
     TEST_ASSERT_EQUAL(ch, 64);
 }
 
+void test_mod_pl011_write_burst(void)
+{
+    size_t written;
+    char buffer[PL011_TX_FIFO_DEPTH + 4];
+    fwk_id_t id;
+
+    memset(buffer, 64, sizeof(buffer));
+
+    /* The FIFO is reported empty so it is filled without polling */
+    mod_reg.FR = PL011_FR_TXFE;
+
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    written = mod_pl011_write(id, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL(written, sizeof(buffer));
+    TEST_ASSERT_EQUAL(mod_reg.DR, 64);
+
+    mod_reg.FR = 0;
+}
+
+void test_mod_pl011_io_write_busy(void)
+{
+    int status;
+    size_t written;
+    struct fwk_io_stream stream;
+
+    mod_reg.FR = PL011_FR_TXFF;
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    pl011_ctx.elements[0].open = true;
+
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    status = mod_pl011_io_write(&stream, "ab", 2, &written);
+    TEST_ASSERT_EQUAL(status, FWK_E_BUSY);
+    TEST_ASSERT_EQUAL(written, 0);
+
+    mod_reg.FR = 0;
+}
+
+void test_mod_pl011_io_read(void)
+{
+    int status;
+    size_t read;
+    char buffer[4] = { 0 };
+    struct fwk_io_stream stream;
+
+    mod_reg.DR = 64;
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    pl011_ctx.elements[0].open = true;
+
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    status = mod_pl011_io_read(&stream, buffer, sizeof(buffer), &read);
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(read, sizeof(buffer));
+    TEST_ASSERT_EQUAL(buffer[3], 64);
+}
+
 void test_mod_pl011_flush(void)
 {
     fwk_id_t id;
@@ -253,6 +318,9 @@ int pl011_test_main(void)
     RUN_TEST(test_mod_pl011_io_open_support);
     RUN_TEST(test_mod_pl011_io_open_success);
     RUN_TEST(test_mod_pl011_io_getch);
+    RUN_TEST(test_mod_pl011_write_burst);
+    RUN_TEST(test_mod_pl011_io_write_busy);
+    RUN_TEST(test_mod_pl011_io_read);
     RUN_TEST(test_mod_pl011_flush);
     return UNITY_END();
 }
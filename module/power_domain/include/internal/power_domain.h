@@ -69,6 +69,72 @@ struct mod_power_state_pre_transition_notification_ctx {
     bool valid;
 };
 
+/* Request of a batch of set state requests */
+struct pd_batch_request {
+    /* Target of the request */
+    struct pd_ctx *pd;
+
+    /* Requested composite state */
+    uint32_t composite_state;
+
+    /*
+     * Highest level of the power domain tree targeted by the request, relative
+     * to the level of the target of the request.
+     */
+    unsigned int highest_level;
+
+    /*
+     * Flag indicating if the request is processed walking up the power domain
+     * tree (true) or walking it down (false).
+     */
+    bool up;
+
+    /*
+     * Flag indicating if a power state transition has been initiated as part
+     * of the processing of the request.
+     */
+    bool transition_initiated;
+
+    /*
+     * Power domain whose power state transition completes the processing of
+     * the request, NULL if none.
+     */
+    struct pd_ctx *pd_in_charge_of_response;
+
+    /* Status of the processing of the request */
+    int status;
+};
+
+/* Context of the batch of set state requests */
+struct pd_batch_ctx {
+    /* Table of the requests of the batch, one entry per power domain at most */
+    struct pd_batch_request *request_table;
+
+    /* Number of requests in the batch */
+    unsigned int request_count;
+
+    /* Flag indicating if the batch is waiting for its event to be processed */
+    bool queued;
+
+    /* Flag indicating if a response to the batch has been requested */
+    bool response_requested;
+
+    /* Pending response context */
+    struct response_ctx response;
+
+    /* Number of requests of the batch the pending response is related to */
+    unsigned int response_request_count;
+
+    /*
+     * Number of power domains whose power state transition has to complete
+     * before the pending response can be sent.
+     */
+    unsigned int pending_pd_count;
+
+    /* Status of the pending response */
+    int response_status;
+};
+
 struct pd_ctx {
     /* Identifier of the power domain */
     fwk_id_t id;
@@ -124,10 +190,41 @@ struct pd_ctx {
     struct fwk_slist children_list;
 
     /*
-     * Node in the parent list if not the root
+     * Node in the parent list if not the root, in the module list of root
+     * power domains otherwise
      */
     struct fwk_slist_node child_node;
 
+    /*
+     * Table of the power domain and its ancestors, indexed by their level
+     * relative to the power domain. The entries above the root are NULL.
+     */
+    struct pd_ctx *ancestors[MOD_PD_LEVEL_COUNT];
+
+    /*
+     * Number of children not allowing each power state, given the power
+     * states requested for them.
+     */
+    uint16_t requested_state_denial_count[MOD_PD_STATE_COUNT_MAX];
+
+    /*
+     * Number of children not allowing each power state, given their current
+     * power states.
+     */
+    uint16_t current_state_denial_count[MOD_PD_STATE_COUNT_MAX];
+
+    /*
+     * Number of core power domains, in the subtree of the power domain, that
+     * are not off or not requested to be off.
+     */
+    unsigned int active_core_count;
+
+    /*
+     * Number of cluster power domains, in the subtree of the power domain,
+     * that are not off or not requested to be off.
+     */
+    unsigned int active_cluster_count;
+
     /* Requested power state for the power domain */
     unsigned int requested_state;
 
@@ -148,6 +245,27 @@ struct pd_ctx {
     /* Pending response context */
     struct response_ctx response;
 
+    /*
+     * Entry of the power domain in the batch of set state requests waiting to
+     * be processed, NULL if the power domain is not part of it.
+     */
+    struct pd_batch_request *batch_request;
+
+    /*
+     * Flag indicating if the response to the last processed batch of set
+     * state requests waits for the completion of the power state transition
+     * of the power domain.
+     */
+    bool batch_response_pending;
+
+    /*
+     * Flag indicating if a 'set state' request was submitted for the power
+     * domain after the batch of set state requests waiting to be processed.
+     * Requests for the power domain cannot be merged into that batch without
+     * overtaking it.
+     */
+    bool set_state_after_batch;
+
     /* Context for the power state transition notification */
     struct mod_power_state_transition_notification_ctx
         power_state_transition_notification_ctx;
@@ -212,11 +330,17 @@ struct mod_pd_mod_ctx {
     /* Context of the system power domain */
     struct pd_ctx *system_pd_ctx;
 
+    /* List of the power domains without a parent */
+    struct fwk_slist root_list;
+
     /* System suspend context */
     struct system_suspend_ctx system_suspend;
 
     /* System shutdown context */
     struct system_shutdown_ctx system_shutdown;
+
+    /* Batch of set state requests context */
+    struct pd_batch_ctx batch;
 };
 
 extern struct mod_pd_mod_ctx mod_pd_ctx;
@@ -253,6 +377,12 @@ struct pd_set_state_request {
     uint32_t composite_state;
 };
 
+/*
+ * MOD_PD_PUBLIC_EVENT_IDX_SET_STATE_BATCH
+ * The set state requests of the batch are stored in the batch context of the
+ * module, the event does not have any parameter.
+ */
+
 /*
  * PD_EVENT_IDX_REPORT_POWER_STATE_TRANSITION
  * Parameters of the power state transition report event
@@ -351,6 +481,65 @@ bool is_allowed_by_child(
  */
 bool is_allowed_by_children(const struct pd_ctx *pd, unsigned int state);
 
+/*
+ * Get the mask of the parent power states that are not allowed by a child.
+ *
+ * \param child Child power domain description.
+ * \param child_state Child power state.
+ *
+ * \return The mask of the parent power states not allowed by the child.
+ */
+static inline uint32_t get_parent_state_denial_mask(
+    const struct pd_ctx *child,
+    unsigned int child_state)
+{
+    unsigned int parent_state;
+    uint32_t mask = 0;
+
+    for (parent_state = 0; parent_state < MOD_PD_STATE_COUNT_MAX;
+         parent_state++) {
+        if ((child_state >= MOD_PD_STATE_COUNT_MAX) ||
+            (parent_state >= child->allowed_state_mask_table_size) ||
+            ((child->allowed_state_mask_table[parent_state] &
+              ((uint32_t)1 << child_state)) == (uint32_t)0)) {
+            mask |= (uint32_t)1 << parent_state;
+        }
+    }
+
+    return mask;
+}
+
+/*
+ * Add or remove a child power state to or from the number of children not
+ * allowing each power state of their parent.
+ *
+ * \param denial_count_table Table of the parent denial counts.
+ * \param child Child power domain description.
+ * \param child_state Child power state.
+ * \param add Add (true) or remove (false) the child power state.
+ */
+static inline void update_state_denial_count(
+    uint16_t *denial_count_table,
+    const struct pd_ctx *child,
+    unsigned int child_state,
+    bool add)
+{
+    unsigned int parent_state;
+    uint32_t mask = get_parent_state_denial_mask(child, child_state);
+
+    for (parent_state = 0; mask != (uint32_t)0; parent_state++, mask >>= 1) {
+        if ((mask & (uint32_t)1) == (uint32_t)0) {
+            continue;
+        }
+
+        if (add) {
+            denial_count_table[parent_state]++;
+        } else {
+            denial_count_table[parent_state]--;
+        }
+    }
+}
+
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
 /*
  * Get the name of a state.
@@ -166,7 +166,10 @@ struct mod_power_domain_element_config {
      */
     const uint32_t *composite_state_mask_table;
 
-    /*! Size of the composite state mask table */
+    /*!
+     * Size of the composite state mask table. It must not be greater than
+     * ::MOD_PD_LEVEL_COUNT.
+     */
     size_t composite_state_mask_table_size;
 
     /*! Size of the table of allowed state masks */
@@ -456,6 +459,20 @@ struct mod_pd_public_api {
     int (*get_domain_parent_id)(fwk_id_t pd_id, fwk_id_t *parent_pd_id);
 };
 
+/*!
+ * \brief Power state request of a batch of set state requests.
+ */
+struct mod_pd_set_state_request {
+    /*! Identifier of the power domain whose state has to be set */
+    fwk_id_t pd_id;
+
+    /*!
+     * \brief State the power domain has to be put into and possibly the
+     *      state(s) its ancestor(s) has(have) to be put into.
+     */
+    uint32_t state;
+};
+
 /*!
  * \brief Power domain module restricted interface.
  *
@@ -525,6 +542,62 @@ struct mod_pd_restricted_api {
      */
     int (*set_state)(fwk_id_t pd_id, bool resp_requested, uint32_t state);
 
+    /*!
+     * \brief Request asynchronous power state transitions for a batch of
+     *      power domains.
+     *
+     * \details The requests of the batch are processed as a single request.
+     *      The states requested for the power domains going to shallower
+     *      states are applied first, walking down the power domain tree, and
+     *      then the states requested for the power domains going to deeper
+     *      states, walking up the power domain tree. Each level of the tree is
+     *      processed for all the requests of the batch before moving to the
+     *      next one, thus an ancestor shared by several power domains of the
+     *      batch is evaluated and transitioned once for the whole batch. If
+     *      several requests of the batch target the same power domain, the
+     *      last one prevails.
+     *
+     *      When a batch without response requested has been submitted but not
+     *      processed yet, the requests of a new batch without response
+     *      requested are merged into it. Requests are not merged for a power
+     *      domain that was the target of a ::mod_pd_restricted_api::set_state
+     *      request submitted after that batch, so that the requests for a
+     *      power domain are processed in order.
+     *
+     * \note The function must be called from a thread, it is rejected if
+     *      called from an interrupt handler. A batch with a response requested
+     *      must be submitted while processing an event, the response being
+     *      sent to the target of that event.
+     *
+     * \warning Successful completion of this function does not indicate
+     *      completion of the transitions, but instead that the requests have
+     *      been submitted.
+     *
+     * \param requests Table of the power state requests. The table is copied
+     *      and can be released when the function returns.
+     *
+     * \param request_count Number of entries in the table of power state
+     *      requests.
+     *
+     * \param resp_requested True if the caller wants to be notified with a
+     *      single event response once all the power state transitions
+     *      initiated by the batch have completed.
+     *
+     * \retval ::FWK_SUCCESS The power state transitions were submitted.
+     * \retval ::FWK_E_ACCESS The function was called from an interrupt
+     *      handler, or the framework has rejected the call to the API.
+     * \retval ::FWK_E_BUSY A batch that cannot be merged with the requests
+     *      is pending.
+     * \retval ::FWK_E_PARAM One or more parameters were invalid. None of the
+     *      requests of the batch were submitted.
+     * \retval ::FWK_E_STATE A response was requested outside of the
+     *      processing of an event.
+     */
+    int (*set_state_batch)(
+        const struct mod_pd_set_state_request *requests,
+        unsigned int request_count,
+        bool resp_requested);
+
     /*!
      * \brief Get the state of a given power domain.
      *
@@ -835,6 +908,9 @@ enum mod_pd_public_event_idx {
     /*! Set state request event */
     MOD_PD_PUBLIC_EVENT_IDX_SET_STATE,
 
+    /*! Batch of set state requests event */
+    MOD_PD_PUBLIC_EVENT_IDX_SET_STATE_BATCH,
+
     /*! Number of public Power Domain events */
     MOD_PD_PUBLIC_EVENT_IDX_COUNT,
 };
@@ -862,6 +938,22 @@ struct pd_set_state_response {
     uint32_t composite_state;
 };
 
+/*!
+ * \brief Parameters of the batch of set state requests response event
+ */
+struct pd_set_state_batch_response {
+    /*!
+     * \brief Status of the batch of set state requests event processing
+     *
+     * \details ::FWK_SUCCESS if all the requests of the batch have been
+     *      completed, the status of the first request that failed otherwise.
+     */
+    int status;
+
+    /*! Number of requests of the batch */
+    unsigned int request_count;
+};
+
 /*!
  * \brief Public Events identifiers.
  */
@@ -871,6 +963,11 @@ static const fwk_id_t mod_pd_public_event_id_set_state =
     FWK_ID_EVENT_INIT(FWK_MODULE_IDX_POWER_DOMAIN,
                       MOD_PD_PUBLIC_EVENT_IDX_SET_STATE);
 
+/*! Identifier of the public event set_state_batch identifier */
+static const fwk_id_t mod_pd_public_event_id_set_state_batch =
+    FWK_ID_EVENT_INIT(FWK_MODULE_IDX_POWER_DOMAIN,
+                      MOD_PD_PUBLIC_EVENT_IDX_SET_STATE_BATCH);
+
 #endif
 
 /*!
@@ -17,6 +17,8 @@
 #include <fwk_core.h>
 #include <fwk_event.h>
 #include <fwk_id.h>
+#include <fwk_interrupt.h>
+#include <fwk_list.h>
 #include <fwk_log.h>
 #include <fwk_macros.h>
 #include <fwk_mm.h>
@@ -91,10 +93,13 @@ static int connect_pd_tree(void)
     unsigned int index;
     struct pd_ctx *pd, *parent;
 
+    fwk_list_init(&mod_pd_ctx.root_list);
+
     for (index = 0; index < mod_pd_ctx.pd_count; index++) {
         pd = &mod_pd_ctx.pd_ctx_table[index];
         if (pd->config->parent_idx >= mod_pd_ctx.pd_count) {
             pd->parent = NULL;
+            fwk_list_push_tail(&mod_pd_ctx.root_list, &pd->child_node);
             continue;
         }
 
@@ -108,6 +113,182 @@ static int connect_pd_tree(void)
     return FWK_SUCCESS;
 }
 
+/* Sub-routine of 'pd_post_init()', to build the ancestor table of a domain */
+static void build_pd_ancestor_table(struct pd_ctx *pd)
+{
+    unsigned int level;
+    struct pd_ctx *ancestor = pd;
+
+    for (level = 0; level < MOD_PD_LEVEL_COUNT; level++) {
+        pd->ancestors[level] = ancestor;
+        if (ancestor != NULL) {
+            ancestor = ancestor->parent;
+        }
+    }
+}
+
+/*
+ * Check whether a power domain is active, that is not off or not requested to
+ * be off.
+ */
+static bool is_pd_active(const struct pd_ctx *pd)
+{
+    return (pd->requested_state != MOD_PD_STATE_OFF) ||
+        (pd->current_state != MOD_PD_STATE_OFF);
+}
+
+/* Get the number of active power domains of a type in a domain subtree */
+static unsigned int get_active_pd_count(
+    const struct pd_ctx *pd,
+    enum mod_pd_type type)
+{
+    if (type == MOD_PD_TYPE_CORE) {
+        return pd->active_core_count;
+    }
+
+    return pd->active_cluster_count;
+}
+
+/*
+ * Update the active core and cluster counts of a power domain and its
+ * ancestors following a change of the power domain states.
+ *
+ * \param pd Description of the power domain whose states changed
+ * \param was_active Whether the power domain was active before the change
+ */
+static void update_active_pd_count(struct pd_ctx *pd, bool was_active)
+{
+    bool active = is_pd_active(pd);
+    enum mod_pd_type type = pd->config->attributes.pd_type;
+    struct pd_ctx *ancestor;
+    unsigned int *count;
+
+    if ((active == was_active) ||
+        ((type != MOD_PD_TYPE_CORE) && (type != MOD_PD_TYPE_CLUSTER))) {
+        return;
+    }
+
+    for (ancestor = pd; ancestor != NULL; ancestor = ancestor->parent) {
+        count = (type == MOD_PD_TYPE_CORE) ? &ancestor->active_core_count :
+                                             &ancestor->active_cluster_count;
+        if (active) {
+            (*count)++;
+        } else {
+            (*count)--;
+        }
+    }
+}
+
+/*
+ * Set the requested power state of a power domain and update the summaries
+ * of the states of its parent and ancestors.
+ */
+static void set_requested_state(struct pd_ctx *pd, unsigned int state)
+{
+    bool was_active = is_pd_active(pd);
+
+    if (pd->parent != NULL) {
+        update_state_denial_count(
+            pd->parent->requested_state_denial_count,
+            pd,
+            pd->requested_state,
+            false);
+        update_state_denial_count(
+            pd->parent->requested_state_denial_count, pd, state, true);
+    }
+
+    pd->requested_state = state;
+    update_active_pd_count(pd, was_active);
+}
+
+/*
+ * Set the current power state of a power domain and update the summaries of
+ * the states of its parent and ancestors.
+ */
+static void set_current_state(struct pd_ctx *pd, unsigned int state)
+{
+    bool was_active = is_pd_active(pd);
+
+    if (pd->parent != NULL) {
+        update_state_denial_count(
+            pd->parent->current_state_denial_count,
+            pd,
+            pd->current_state,
+            false);
+        update_state_denial_count(
+            pd->parent->current_state_denial_count, pd, state, true);
+    }
+
+    pd->current_state = state;
+    update_active_pd_count(pd, was_active);
+}
+
+/*
+ * Sub-routine of 'pd_post_init()', to build the summaries of the states of the
+ * power domain tree from the states of the power domains.
+ */
+static void build_pd_state_summaries(void)
+{
+    unsigned int index;
+    struct pd_ctx *pd;
+
+    for (index = 0; index < mod_pd_ctx.pd_count; index++) {
+        pd = &mod_pd_ctx.pd_ctx_table[index];
+
+        build_pd_ancestor_table(pd);
+
+        if (pd->parent != NULL) {
+            update_state_denial_count(
+                pd->parent->requested_state_denial_count,
+                pd,
+                pd->requested_state,
+                true);
+            update_state_denial_count(
+                pd->parent->current_state_denial_count,
+                pd,
+                pd->current_state,
+                true);
+        }
+
+        update_active_pd_count(pd, false);
+    }
+}
+
+/*
+ * Find the active power domain of a given type, descending only into the
+ * subtrees that contain active power domains of that type.
+ *
+ * \param type Type of the power domain to find. There must be at most one
+ *      active power domain of that type.
+ *
+ * \return The active power domain of the given type, NULL if there is none.
+ */
+static struct pd_ctx *find_active_pd(enum mod_pd_type type)
+{
+    struct fwk_slist *list = &mod_pd_ctx.root_list;
+    struct fwk_slist_node *node;
+    struct pd_ctx *pd;
+
+    node = fwk_list_head(list);
+    while (node != NULL) {
+        pd = FWK_LIST_GET(node, struct pd_ctx, child_node);
+
+        if (get_active_pd_count(pd, type) == 0) {
+            node = fwk_list_next(list, node);
+            continue;
+        }
+
+        if ((pd->config->attributes.pd_type == type) && is_pd_active(pd)) {
+            return pd;
+        }
+
+        list = &pd->children_list;
+        node = fwk_list_head(list);
+    }
+
+    return NULL;
+}
+
 int initiate_power_state_transition(struct pd_ctx *pd)
 {
     int status;
@@ -154,6 +335,46 @@ int initiate_power_state_transition(struct pd_ctx *pd)
     return status;
 }
 
+/*
+ * Account for the completion of a power state transition the response to the
+ * last processed batch of set state requests waits for.
+ *
+ * \param resp_status Status of the power state transition
+ */
+static void complete_batch_pd_transition(int resp_status)
+{
+    int status;
+    struct pd_batch_ctx *batch = &mod_pd_ctx.batch;
+    struct fwk_event resp_event;
+    struct pd_set_state_batch_response *resp_params =
+        (struct pd_set_state_batch_response *)(&resp_event.params);
+
+    if (batch->response_status == FWK_SUCCESS) {
+        batch->response_status = resp_status;
+    }
+
+    batch->pending_pd_count--;
+    if ((batch->pending_pd_count > 0) || (!batch->response.pending)) {
+        return;
+    }
+
+    status = fwk_get_delayed_response(
+        fwk_module_id_power_domain, batch->response.cookie, &resp_event);
+    batch->response.pending = false;
+
+    if (status != FWK_SUCCESS) {
+        return;
+    }
+
+    resp_params->status = batch->response_status;
+    resp_params->request_count = batch->response_request_count;
+
+    status = fwk_put_event(&resp_event);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[PD] %s @%d", __func__, __LINE__);
+    }
+}
+
 /*
  * Send a power domain's delayed response to a set state request.
  *
@@ -171,6 +392,11 @@ static void send_pd_set_state_delayed_response(
     struct pd_set_state_response *resp_params =
         (struct pd_set_state_response *)(&resp_event.params);
 
+    if (pd->batch_response_pending) {
+        pd->batch_response_pending = false;
+        complete_batch_pd_transition(resp_status);
+    }
+
     if (!pd->response.pending) {
         return;
     }
@@ -191,6 +417,121 @@ static void send_pd_set_state_delayed_response(
     }
 }
 
+/*
+ * Process the power state requested for one of the power domains involved in
+ * a 'set state' request
+ *
+ * \param pd Description of the power domain
+ * \param state Power state requested for the power domain
+ * \param [in, out] transition_initiated Flag indicating if a power state
+ *      transition has already been initiated as part of the request
+ * \param [out] pd_in_charge_of_response Set to the power domain if the
+ *      processing of the request completes with its power state transition
+ *
+ * \retval ::FWK_SUCCESS The power state request has been processed, the
+ *      processing of the request can go on with the next power domain.
+ * \retval ::FWK_E_PWRSTATE The power state is not allowed by the power state
+ *      requested for the parent of the power domain.
+ * \return Status code of the failed power state transition initiation.
+ */
+static int process_pd_state_request(
+    struct pd_ctx *pd,
+    unsigned int state,
+    bool *transition_initiated,
+    struct pd_ctx **pd_in_charge_of_response)
+{
+    int status;
+    unsigned int prev_state;
+    const struct pd_ctx *parent;
+
+    if (state == pd->requested_state) {
+        return FWK_SUCCESS;
+    }
+
+    /*
+     * Check that the requested power state is compatible with the states
+     * currently requested for the parent and children of the power domain.
+     */
+    parent = pd->parent;
+    if ((parent != NULL) &&
+        (!is_allowed_by_child(pd, parent->requested_state, state))) {
+        return FWK_E_PWRSTATE;
+    }
+
+    if (!is_allowed_by_children(pd, state)) {
+        return FWK_SUCCESS;
+    }
+
+    /*
+     * A new valid power state is requested for the power domain. Send any
+     * pending response concerning the previous requested power state.
+     */
+    prev_state = pd->requested_state;
+    set_requested_state(pd, state);
+    pd->power_state_pre_transition_notification_ctx.valid = false;
+    send_pd_set_state_delayed_response(pd, FWK_E_OVERWRITTEN);
+
+    if (pd->state_requested_to_driver == state) {
+        return FWK_SUCCESS;
+    }
+
+    /*
+     * The driver must be called thus the processing of the set state
+     * request is going to be asynchronous. Assign the responsibility of
+     * the response to the request to the power domain. If there is no
+     * need for a driver call for the ancestors or descendants of the power
+     * domain as part of the processing of the requested composite state,
+     * the response to the request will be sent when the transition to the
+     * new requested power state is completed.
+     */
+    *pd_in_charge_of_response = pd;
+
+    /*
+     * If a power state transition has already been initiated for an
+     * ancestor or descendant, we don't initiate the power state transition
+     * now. It will be initiated on completion of the transition of one
+     * of its ancestor or descendant.
+     */
+    if (*transition_initiated) {
+        return FWK_SUCCESS;
+    }
+
+    /*
+     * If the parent or a child is not currently in a power state
+     * compatible with the new requested state for the power domain, do not
+     * initiate the transition now as well. It will be initiated when the
+     * parent and the children are in a proper state.
+     */
+    if (!is_allowed_by_parent_and_children(pd, state)) {
+        return FWK_SUCCESS;
+    }
+
+    /*
+     * Defer the power state transition if power state pre-transition
+     * notification responses need to be waited for.
+     */
+    if (power_state_pre_transition_notification_wrapper(pd)) {
+        return FWK_SUCCESS;
+    }
+
+    status = initiate_power_state_transition(pd);
+    if (status != FWK_SUCCESS) {
+        /*
+         * If the power state transition failed, then this power domain is
+         * no longer in charge to delay the response.
+         */
+        *pd_in_charge_of_response = NULL;
+
+        /* The power state change failed, restore the previous state */
+        set_requested_state(pd, prev_state);
+        return status;
+    }
+
+    *transition_initiated = true;
+
+    return FWK_SUCCESS;
+}
+
 /*
  * Process a 'set state' request
  *
@@ -208,10 +549,9 @@ static void process_set_state_request(
     struct pd_set_state_response *resp_params;
     uint32_t composite_state;
     bool up, first_power_state_transition_initiated, composite_state_operation;
-    unsigned int lowest_level, highest_level, level;
-    unsigned int nb_pds, pd_index, state, prev_state;
+    unsigned int highest_level, level;
+    unsigned int nb_pds, pd_index, state;
     struct pd_ctx *pd, *pd_in_charge_of_response;
-    const struct pd_ctx *parent;
     const uint32_t *state_mask_table = NULL;
 
     req_params = (struct pd_set_state_request *)event->params;
@@ -227,10 +567,8 @@ static void process_set_state_request(
 
     /*
      * It has already been tested as part of the composite state validation that
-     * 'highest_level >= lowest_level' and 'highest_level' is lower
-     * than the highest power level.
+     * 'highest_level' is lower than the highest power level.
      */
-    lowest_level = 0;
     highest_level = (unsigned int)get_highest_level_from_composite_state(
         lowest_pd, composite_state);
     nb_pds = highest_level + 1U;
@@ -251,11 +589,8 @@ static void process_set_state_request(
              * When walking down the power domain tree, get the context of the
              * next power domain to process as well as its level.
              */
-            pd = lowest_pd;
-            for (level = lowest_level; level < (highest_level - pd_index);
-                 level++) {
-                pd = pd->parent;
-            }
+            level = highest_level - pd_index;
+            pd = lowest_pd->ancestors[level];
         }
 
         if (composite_state_operation) {
@@ -265,105 +600,170 @@ static void process_set_state_request(
             state = composite_state;
         }
 
-        if (state == pd->requested_state) {
-            continue;
-        }
-
-        /*
-         * Check that the requested power state is compatible with the states
-         * currently requested for the parent and children of the power domain.
-         */
-        parent = pd->parent;
-        if ((parent != NULL) &&
-            (!is_allowed_by_child(pd, parent->requested_state, state))) {
-            status = FWK_E_PWRSTATE;
+        status = process_pd_state_request(
+            pd,
+            state,
+            &first_power_state_transition_initiated,
+            &pd_in_charge_of_response);
+        if (status != FWK_SUCCESS) {
             break;
         }
+    }
 
-        if (!is_allowed_by_children(pd, state)) {
-            continue;
-        }
+    if (!event->response_requested) {
+        return;
+    }
 
-        /*
-         * A new valid power state is requested for the power domain. Send any
-         * pending response concerning the previous requested power state.
-         */
-        prev_state = pd->requested_state;
-        pd->requested_state = state;
-        pd->power_state_pre_transition_notification_ctx.valid = false;
-        send_pd_set_state_delayed_response(pd, FWK_E_OVERWRITTEN);
+    if (pd_in_charge_of_response != NULL) {
+        resp_event->is_delayed_response = true;
+        resp_event->source_id = pd_in_charge_of_response->id;
+        pd_in_charge_of_response->response.pending = true;
+        pd_in_charge_of_response->response.cookie = resp_event->cookie;
+    } else {
+        resp_params->status = status;
+        resp_params->composite_state = composite_state;
+    }
+}
 
-        if (pd->state_requested_to_driver == state) {
-            continue;
-        }
+/*
+ * Process the power domain of a given level of a request of a batch of 'set
+ * state' requests
+ *
+ * \param request Request of the batch
+ * \param level Level of the power domain relative to the target of the request
+ */
+static void process_batch_request_level(
+    struct pd_batch_request *request,
+    unsigned int level)
+{
+    unsigned int state;
+    const struct pd_ctx *lowest_pd = request->pd;
 
-        /*
-         * The driver must be called thus the processing of the set state
-         * request is going to be asynchronous. Assign the responsibility of
-         * the response to the request to the power domain. If there is no
-         * need for a driver call for the ancestors or descendants of the power
-         * domain as part of the processing of the requested composite state,
-         * the response to the request will be sent when the transition to the
-         * new requested power state is completed.
-         */
-        pd_in_charge_of_response = pd;
+    if ((request->status != FWK_SUCCESS) || (level > request->highest_level)) {
+        return;
+    }
 
-        /*
-         * If a power state transition has already been initiated for an
-         * ancestor or descendant, we don't initiate the power state transition
-         * now. It will be initiated on completion of the transition of one
-         * of its ancestor or descendant.
-         */
-        if (first_power_state_transition_initiated) {
-            continue;
-        }
+    if (lowest_pd->cs_support) {
+        state = get_level_state_from_composite_state(
+            lowest_pd->composite_state_mask_table,
+            request->composite_state,
+            (int)level);
+    } else {
+        state = request->composite_state;
+    }
 
-        /*
-         * If the parent or a child is not currently in a power state
-         * compatible with the new requested state for the power domain, do not
-         * initiate the transition now as well. It will be initiated when the
-         * parent and the children are in a proper state.
-         */
-        if (!is_allowed_by_parent_and_children(pd, state)) {
-            continue;
-        }
+    request->status = process_pd_state_request(
+        lowest_pd->ancestors[level],
+        state,
+        &request->transition_initiated,
+        &request->pd_in_charge_of_response);
+}
 
-        /*
-         * Defer the power state transition if power state pre-transition
-         * notification responses need to be waited for.
-         */
-        if (power_state_pre_transition_notification_wrapper(pd)) {
-            continue;
-        }
+/*
+ * Process a batch of 'set state' requests
+ *
+ * \details The requests walking down the power domain tree are processed
+ *      first, then the requests walking up the power domain tree. In both
+ *      cases, a level of the tree is processed for all the requests before
+ *      moving to the next one. That way, the power state requested for an
+ *      ancestor shared by several requests is evaluated once all the
+ *      requests have been applied to its children, and its power state
+ *      transition, pre-transition notification included, is initiated once
+ *      for the whole batch.
+ *
+ * \param event Batch of 'set state' requests event
+ * \param [out] resp_event Response event
+ */
+static void process_set_state_batch_request(
+    const struct fwk_event *event,
+    struct fwk_event *resp_event)
+{
+    int status;
+    struct pd_batch_ctx *batch = &mod_pd_ctx.batch;
+    struct pd_batch_request *request;
+    struct pd_set_state_batch_response *resp_params =
+        (struct pd_set_state_batch_response *)resp_event->params;
+    struct pd_ctx *pd;
+    unsigned int i, level, max_level;
 
-        status = initiate_power_state_transition(pd);
-        if (status != FWK_SUCCESS) {
-            /*
-             * If the power state transition failed, then this power domain is
-             * no longer in charge to delay the response.
-             */
-            pd_in_charge_of_response = NULL;
+    batch->queued = false;
 
-            /* The power state change failed, restore the previous state */
-            pd->requested_state = prev_state;
-            break;
+    /* Requests submitted from now on follow this batch */
+    for (i = 0; i < mod_pd_ctx.pd_count; i++) {
+        mod_pd_ctx.pd_ctx_table[i].set_state_after_batch = false;
+    }
+
+    /* A set state request cancels the completion of system suspend. */
+    mod_pd_ctx.system_suspend.last_core_off_ongoing = false;
+
+    /*
+     * The propagation direction of all the requests is determined before any
+     * of them modifies the requested power states.
+     */
+    max_level = 0;
+    for (i = 0; i < batch->request_count; i++) {
+        request = &batch->request_table[i];
+        request->pd->batch_request = NULL;
+        request->up = is_upwards_transition_propagation(
+            request->pd, request->composite_state);
+        request->highest_level =
+            (unsigned int)get_highest_level_from_composite_state(
+                request->pd, request->composite_state);
+        request->transition_initiated = false;
+        request->pd_in_charge_of_response = NULL;
+        request->status = FWK_SUCCESS;
+
+        max_level = FWK_MAX(max_level, request->highest_level);
+    }
+
+    for (level = max_level + 1U; level-- > 0U;) {
+        for (i = 0; i < batch->request_count; i++) {
+            request = &batch->request_table[i];
+            if (!request->up) {
+                process_batch_request_level(request, level);
+            }
         }
+    }
 
-        first_power_state_transition_initiated = true;
+    for (level = 0; level <= max_level; level++) {
+        for (i = 0; i < batch->request_count; i++) {
+            request = &batch->request_table[i];
+            if (request->up) {
+                process_batch_request_level(request, level);
+            }
+        }
     }
 
     if (!event->response_requested) {
+        batch->request_count = 0;
         return;
     }
 
-    if (pd_in_charge_of_response != NULL) {
+    status = FWK_SUCCESS;
+    for (i = 0; i < batch->request_count; i++) {
+        request = &batch->request_table[i];
+        if (status == FWK_SUCCESS) {
+            status = request->status;
+        }
+
+        pd = request->pd_in_charge_of_response;
+        if ((pd != NULL) && (!pd->batch_response_pending)) {
+            pd->batch_response_pending = true;
+            batch->pending_pd_count++;
+        }
+    }
+
+    resp_params->request_count = batch->request_count;
+    batch->request_count = 0;
+
+    if (batch->pending_pd_count > 0) {
         resp_event->is_delayed_response = true;
-        resp_event->source_id = pd_in_charge_of_response->id;
-        pd_in_charge_of_response->response.pending = true;
-        pd_in_charge_of_response->response.cookie = resp_event->cookie;
+        batch->response.pending = true;
+        batch->response.cookie = resp_event->cookie;
+        batch->response_request_count = resp_params->request_count;
+        batch->response_status = status;
     } else {
         resp_params->status = status;
-        resp_params->composite_state = composite_state;
     }
 }
 
@@ -615,7 +1015,7 @@ static void process_power_state_transition_report(
      * not the received state, to compensate for the
      * possible state mapping that may have occured.
      */
-    pd->current_state = pd->requested_state;
+    set_current_state(pd, pd->requested_state);
 
 #ifdef BUILD_HAS_NOTIFICATION
     if (pd->power_state_transition_notification_ctx.pending_responses == 0 &&
@@ -671,7 +1071,8 @@ static void process_power_state_transition_report(
 #endif
 
     /* Update the pd states to follow the new transition */
-    pd->requested_state = pd->state_requested_to_driver = pd->current_state;
+    set_requested_state(pd, pd->current_state);
+    pd->state_requested_to_driver = pd->current_state;
 
     if (is_deeper_state(new_state, previous_state)) {
         process_power_state_transition_report_deeper_state(pd);
@@ -692,37 +1093,32 @@ static void process_system_suspend_request(
     struct pd_response *resp_params)
 {
     int status;
-    unsigned int pd_idx;
-    struct pd_ctx *pd;
-    struct pd_ctx *last_core_pd = NULL;
-    struct pd_ctx *last_cluster_pd = NULL;
+    unsigned int active_core_count = 0;
+    unsigned int active_cluster_count = 0;
+    struct pd_ctx *root = NULL;
+    struct fwk_slist *r_node = NULL;
+    struct pd_ctx *last_core_pd;
+    struct pd_ctx *last_cluster_pd;
 
     /*
      * All core related power domains have to be in the MOD_PD_STATE_OFF state
      * but one core and its ancestors.
      */
-    for (pd_idx = 0; pd_idx < mod_pd_ctx.pd_count; pd_idx++) {
-        pd = &mod_pd_ctx.pd_ctx_table[pd_idx];
-        if ((pd->requested_state == MOD_PD_STATE_OFF) &&
-            (pd->current_state == MOD_PD_STATE_OFF)) {
-            continue;
-        }
+    FWK_LIST_FOR_EACH(
+        &mod_pd_ctx.root_list, r_node, struct pd_ctx, child_node, root)
+    {
+        active_core_count += root->active_core_count;
+        active_cluster_count += root->active_cluster_count;
+    }
 
-        if (pd->config->attributes.pd_type == MOD_PD_TYPE_CORE) {
-            if (last_core_pd != NULL) {
-                resp_params->status = FWK_E_STATE;
-                return;
-            }
-            last_core_pd = pd;
-        } else if (pd->config->attributes.pd_type == MOD_PD_TYPE_CLUSTER) {
-            if (last_cluster_pd != NULL) {
-                resp_params->status = FWK_E_STATE;
-                return;
-            }
-            last_cluster_pd = pd;
-        }
+    if ((active_core_count > 1) || (active_cluster_count > 1)) {
+        resp_params->status = FWK_E_STATE;
+        return;
     }
 
+    last_core_pd = find_active_pd(MOD_PD_TYPE_CORE);
+    last_cluster_pd = find_active_pd(MOD_PD_TYPE_CLUSTER);
+
     if (last_core_pd == NULL) {
         status = complete_system_suspend(
             (last_cluster_pd != NULL) ? last_cluster_pd :
@@ -735,9 +1131,9 @@ static void process_system_suspend_request(
 
             mod_pd_ctx.system_suspend.last_core_pd = last_core_pd;
             mod_pd_ctx.system_suspend.state = req_params->state;
-            last_core_pd->requested_state =
-                last_core_pd->state_requested_to_driver =
-                    (unsigned int)MOD_PD_STATE_OFF;
+            set_requested_state(last_core_pd, (unsigned int)MOD_PD_STATE_OFF);
+            last_core_pd->state_requested_to_driver =
+                (unsigned int)MOD_PD_STATE_OFF;
         }
     }
 
@@ -816,8 +1212,9 @@ void perform_shutdown(enum mod_pd_system_shutdown system_shutdown)
                 "[PD] %s shutdown", fwk_module_get_element_name(pd_id));
         }
 
-        pd->requested_state = pd->state_requested_to_driver =
-            pd->current_state = (unsigned int)MOD_PD_STATE_OFF;
+        set_requested_state(pd, (unsigned int)MOD_PD_STATE_OFF);
+        set_current_state(pd, (unsigned int)MOD_PD_STATE_OFF);
+        pd->state_requested_to_driver = (unsigned int)MOD_PD_STATE_OFF;
     }
 
     /*
@@ -934,6 +1331,7 @@ static int pd_get_domain_parent_id(fwk_id_t pd_id, fwk_id_t *parent_pd_id)
 /* Functions specific to the restricted API */
 static int pd_set_state(fwk_id_t pd_id, bool response_requested, uint32_t state)
 {
+    int status;
     struct pd_ctx *pd;
     struct fwk_event req;
     struct pd_set_state_request *req_params =
@@ -961,7 +1359,126 @@ static int pd_set_state(fwk_id_t pd_id, bool response_requested, uint32_t state)
 
     req_params->composite_state = state;
 
-    return fwk_put_event(&req);
+    status = fwk_put_event(&req);
+    if ((status == FWK_SUCCESS) && mod_pd_ctx.batch.queued) {
+        pd->set_state_after_batch = true;
+    }
+
+    return status;
+}
+
+static int pd_set_state_batch(
+    const struct mod_pd_set_state_request *requests,
+    unsigned int request_count,
+    bool response_requested)
+{
+    int status;
+    unsigned int i;
+    struct pd_batch_ctx *batch = &mod_pd_ctx.batch;
+    struct pd_batch_request *request;
+    struct pd_ctx *pd;
+    struct fwk_event req;
+
+    /* The batch context is only accessed from the thread */
+    if (fwk_is_interrupt_context()) {
+        return FWK_E_ACCESS;
+    }
+
+    /*
+     * The response is sent to the entity whose event is being processed.
+     * Outside of the processing of an event, it would be sent back to the
+     * power domain module itself.
+     */
+    if (response_requested && (__fwk_get_current_event() == NULL)) {
+        return FWK_E_STATE;
+    }
+
+    if ((requests == NULL) || (request_count == 0)) {
+        return FWK_E_PARAM;
+    }
+
+    for (i = 0; i < request_count; i++) {
+        if (!fwk_module_is_valid_element_id(requests[i].pd_id)) {
+            return FWK_E_PARAM;
+        }
+
+        pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(
+            requests[i].pd_id)];
+
+        if (pd->cs_support) {
+            if (!is_valid_composite_state(pd, requests[i].state)) {
+                return FWK_E_PARAM;
+            }
+        } else {
+            if (!is_valid_state(pd, requests[i].state)) {
+                return FWK_E_PARAM;
+            }
+        }
+    }
+
+    /*
+     * Requests without response can be merged into a batch that is waiting
+     * to be processed, provided no response is expected for it either.
+     */
+    if (batch->queued) {
+        if (response_requested || batch->response_requested) {
+            return FWK_E_BUSY;
+        }
+
+        /*
+         * A request merged into the batch would be processed before the
+         * 'set state' requests submitted for the same power domain after
+         * the batch.
+         */
+        for (i = 0; i < request_count; i++) {
+            pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(
+                requests[i].pd_id)];
+            if (pd->set_state_after_batch) {
+                return FWK_E_BUSY;
+            }
+        }
+    } else {
+        if (response_requested && batch->response.pending) {
+            return FWK_E_BUSY;
+        }
+
+        req = (struct fwk_event){
+            .id = FWK_ID_EVENT(
+                FWK_MODULE_IDX_POWER_DOMAIN,
+                MOD_PD_PUBLIC_EVENT_IDX_SET_STATE_BATCH),
+            .source_id = fwk_module_id_power_domain,
+            .target_id = fwk_module_id_power_domain,
+            .response_requested = response_requested,
+        };
+
+        status = fwk_put_event(&req);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        batch->queued = true;
+        batch->response_requested = response_requested;
+    }
+
+    /*
+     * The batch holds at most one request per power domain, a new request for
+     * a power domain replaces the previous one.
+     */
+    for (i = 0; i < request_count; i++) {
+        pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(
+            requests[i].pd_id)];
+
+        request = pd->batch_request;
+        if (request == NULL) {
+            request = &batch->request_table[batch->request_count++];
+            request->pd = pd;
+            pd->batch_request = request;
+        }
+
+        request->composite_state = requests[i].state;
+    }
+
+    return FWK_SUCCESS;
 }
 
 static int pd_get_state(fwk_id_t pd_id, unsigned int *state)
@@ -1111,6 +1628,7 @@ static const struct mod_pd_restricted_api pd_restricted_api = {
     .get_domain_parent_id = pd_get_domain_parent_id,
 
     .set_state = pd_set_state,
+    .set_state_batch = pd_set_state_batch,
     .get_state = pd_get_state,
     .reset = pd_reset,
     .system_suspend = pd_system_suspend,
@@ -1141,6 +1659,8 @@ static int pd_init(fwk_id_t module_id, unsigned int dev_count, const void *data)
     }
 
     mod_pd_ctx.pd_ctx_table = fwk_mm_calloc(dev_count, sizeof(struct pd_ctx));
+    mod_pd_ctx.batch.request_table =
+        fwk_mm_calloc(dev_count, sizeof(struct pd_batch_request));
 
     mod_pd_ctx.pd_count = dev_count;
     mod_pd_ctx.system_pd_ctx = &mod_pd_ctx.pd_ctx_table[dev_count - 1];
@@ -1179,6 +1699,11 @@ static int pd_power_domain_init(
         pd->valid_state_mask |= pd->allowed_state_mask_table[state];
     }
 
+    if ((pd_config->composite_state_mask_table != NULL) &&
+        (pd_config->composite_state_mask_table_size > MOD_PD_LEVEL_COUNT)) {
+        return FWK_E_PARAM;
+    }
+
     if ((pd_config->composite_state_mask_table != NULL) &&
         (pd_config->composite_state_mask_table_size > 0)) {
         pd->composite_state_mask_table = pd_config->composite_state_mask_table;
@@ -1215,6 +1740,8 @@ static int pd_post_init(fwk_id_t module_id)
         return status;
     }
 
+    build_pd_state_summaries();
+
     return FWK_SUCCESS;
 }
 
@@ -1269,9 +1796,9 @@ static int pd_start(fwk_id_t id)
 
     for (index = (int)(mod_pd_ctx.pd_count - 1); index >= 0; index--) {
         pd = &mod_pd_ctx.pd_ctx_table[index];
-        pd->requested_state = (unsigned int)MOD_PD_STATE_OFF;
+        set_requested_state(pd, (unsigned int)MOD_PD_STATE_OFF);
+        set_current_state(pd, (unsigned int)MOD_PD_STATE_OFF);
         pd->state_requested_to_driver = (unsigned int)MOD_PD_STATE_OFF;
-        pd->current_state = (unsigned int)MOD_PD_STATE_OFF;
 
         /*
          * If the power domain parent is powered down, don't call the driver
@@ -1296,7 +1823,8 @@ static int pd_start(fwk_id_t id)
                 __LINE__);
 #endif
         } else {
-            pd->requested_state = pd->state_requested_to_driver = state;
+            set_requested_state(pd, state);
+            pd->state_requested_to_driver = state;
 
             if (state == MOD_PD_STATE_OFF) {
                 continue;
@@ -1375,6 +1903,13 @@ static int pd_process_event(
 {
     struct pd_ctx *pd = NULL;
 
+    /* The module does not request responses to the events it sends */
+    if (event->is_response) {
+        FWK_LOG_DEBUG("[PD] %s @%d", __func__, __LINE__);
+
+        return FWK_SUCCESS;
+    }
+
     if (fwk_id_is_type(event->target_id, FWK_ID_TYPE_ELEMENT)) {
         pd = &mod_pd_ctx.pd_ctx_table[fwk_id_get_element_idx(event->target_id)];
     }
@@ -1387,6 +1922,11 @@ static int pd_process_event(
 
         return FWK_SUCCESS;
 
+    case (unsigned int)MOD_PD_PUBLIC_EVENT_IDX_SET_STATE_BATCH:
+        process_set_state_batch_request(event, resp);
+
+        return FWK_SUCCESS;
+
     case (unsigned int)PD_EVENT_IDX_RESET:
         fwk_assert(pd != NULL);
 
@@ -1427,6 +1967,7 @@ const struct fwk_module module_power_domain = {
     .type = FWK_MODULE_TYPE_HAL,
     .api_count = (unsigned int)MOD_PD_API_IDX_COUNT,
     .event_count = (unsigned int)PD_EVENT_COUNT,
+    .event_priority = FWK_EVENT_PRIORITY_HIGH,
 #ifdef BUILD_HAS_NOTIFICATION
     .notification_count = (unsigned int)MOD_PD_NOTIFICATION_COUNT,
 #endif
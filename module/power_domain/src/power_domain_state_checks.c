@@ -13,6 +13,7 @@
 #include <mod_power_domain.h>
 
 #include <fwk_assert.h>
+#include <fwk_list.h>
 #include <fwk_log.h>
 #include <fwk_macros.h>
 #include <fwk_module.h>
@@ -84,18 +85,11 @@ bool is_allowed_by_child(
 
 bool is_allowed_by_children(const struct pd_ctx *pd, unsigned int state)
 {
-    const struct pd_ctx *child = NULL;
-    struct fwk_slist *c_node = NULL;
-
-    FWK_LIST_FOR_EACH(
-        &pd->children_list, c_node, struct pd_ctx, child_node, child)
-    {
-        if (!is_allowed_by_child(child, state, child->requested_state)) {
-            return false;
-        }
+    if (state >= MOD_PD_STATE_COUNT_MAX) {
+        return fwk_list_is_empty(&pd->children_list);
     }
 
-    return true;
+    return pd->requested_state_denial_count[state] == 0;
 }
 
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
@@ -277,8 +271,7 @@ bool is_upwards_transition_propagation(
 
 bool is_allowed_by_parent_and_children(struct pd_ctx *pd, unsigned int state)
 {
-    struct pd_ctx *parent, *child = NULL;
-    struct fwk_slist *c_node = NULL;
+    struct pd_ctx *parent;
 
     parent = pd->parent;
     if (parent != NULL) {
@@ -287,15 +280,11 @@ bool is_allowed_by_parent_and_children(struct pd_ctx *pd, unsigned int state)
         }
     }
 
-    FWK_LIST_FOR_EACH(
-        &pd->children_list, c_node, struct pd_ctx, child_node, child)
-    {
-        if (!is_allowed_by_child(child, state, child->current_state)) {
-            return false;
-        }
+    if (state >= MOD_PD_STATE_COUNT_MAX) {
+        return fwk_list_is_empty(&pd->children_list);
     }
 
-    return true;
+    return pd->current_state_denial_count[state] == 0;
 }
 
 bool is_state_in_transition(struct pd_ctx *pd, unsigned int state)
@@ -99,6 +99,56 @@ static void construct_pd_relations(void)
     pd_ctx[PD_IDX_CLUS1CORE1].parent = &pd_ctx[PD_IDX_CLUSTER1];
 }
 
+static void build_state_summaries(void)
+{
+    for (int i = 0; i < PD_IDX_COUNT; ++i) {
+        if (pd_ctx[i].parent == NULL) {
+            continue;
+        }
+
+        update_state_denial_count(
+            pd_ctx[i].parent->requested_state_denial_count,
+            &pd_ctx[i],
+            pd_ctx[i].requested_state,
+            true);
+        update_state_denial_count(
+            pd_ctx[i].parent->current_state_denial_count,
+            &pd_ctx[i],
+            pd_ctx[i].current_state,
+            true);
+    }
+}
+
+static void change_requested_state(struct pd_ctx *pd, unsigned int state)
+{
+    if (pd->parent != NULL) {
+        update_state_denial_count(
+            pd->parent->requested_state_denial_count,
+            pd,
+            pd->requested_state,
+            false);
+        update_state_denial_count(
+            pd->parent->requested_state_denial_count, pd, state, true);
+    }
+
+    pd->requested_state = state;
+}
+
+static void change_current_state(struct pd_ctx *pd, unsigned int state)
+{
+    if (pd->parent != NULL) {
+        update_state_denial_count(
+            pd->parent->current_state_denial_count,
+            pd,
+            pd->current_state,
+            false);
+        update_state_denial_count(
+            pd->parent->current_state_denial_count, pd, state, true);
+    }
+
+    pd->current_state = state;
+}
+
 static void change_child_states(struct pd_ctx *pd, unsigned int state)
 {
     struct pd_ctx *child = NULL;
@@ -107,7 +157,7 @@ static void change_child_states(struct pd_ctx *pd, unsigned int state)
     FWK_LIST_FOR_EACH(
         &pd->children_list, c_node, struct pd_ctx, child_node, child)
     {
-        child->requested_state = state;
+        change_requested_state(child, state);
     }
 }
 
@@ -118,6 +168,7 @@ void setUp(void)
     init_module_ctx();
     evaluate_valid_state_mask();
     construct_pd_relations();
+    build_state_summaries();
 }
 
 void tearDown(void)
@@ -250,6 +301,28 @@ void test_is_allowed_by_children_denied(void)
     TEST_ASSERT_EQUAL(false, result);
 }
 
+void test_is_allowed_by_children_follows_child_state_changes(void)
+{
+    struct pd_ctx *pd = &mod_pd_ctx_temp.pd_ctx_table[PD_IDX_CLUSTER0];
+
+    change_child_states(pd, MOD_PD_STATE_ON);
+    TEST_ASSERT_EQUAL(2, pd->requested_state_denial_count[MOD_PD_STATE_OFF]);
+
+    /* A single child left on still prevents the cluster from turning off */
+    change_requested_state(
+        &mod_pd_ctx_temp.pd_ctx_table[PD_IDX_CLUS0CORE0], MOD_PD_STATE_OFF);
+    TEST_ASSERT_EQUAL(false, is_allowed_by_children(pd, MOD_PD_STATE_OFF));
+
+    change_requested_state(
+        &mod_pd_ctx_temp.pd_ctx_table[PD_IDX_CLUS0CORE1], MOD_PD_STATE_OFF);
+    TEST_ASSERT_EQUAL(true, is_allowed_by_children(pd, MOD_PD_STATE_OFF));
+    TEST_ASSERT_EQUAL(0, pd->requested_state_denial_count[MOD_PD_STATE_OFF]);
+
+    /* The current states of the children are summarized separately */
+    TEST_ASSERT_EQUAL(
+        true, is_allowed_by_parent_and_children(pd, MOD_PD_STATE_OFF));
+}
+
 void test_get_state_name_off(void)
 {
     struct pd_ctx *pd = &mod_pd_ctx_temp.pd_ctx_table[PD_IDX_CLUSTER0];
@@ -507,7 +580,7 @@ void test_is_allowed_by_parent_and_children_denied(void)
 
     /* Swap this round so a pd can deny it is permitted */
     for (int i = 0; i < PD_IDX_COUNT; ++i) {
-        pd_ctx[i].current_state = MOD_PD_STATE_ON;
+        change_current_state(&pd_ctx[i], MOD_PD_STATE_ON);
     }
 
     valid = is_allowed_by_parent_and_children(pd, MOD_PD_STATE_OFF);
@@ -593,6 +666,7 @@ int power_domain_state_checks_test_main(void)
     RUN_TEST(test_is_allowed_by_child_denied);
     RUN_TEST(test_is_allowed_by_children_permitted);
     RUN_TEST(test_is_allowed_by_children_denied);
+    RUN_TEST(test_is_allowed_by_children_follows_child_state_changes);
     RUN_TEST(test_get_state_name_off);
     RUN_TEST(test_get_state_name_on);
     RUN_TEST(test_get_state_name_sleep);
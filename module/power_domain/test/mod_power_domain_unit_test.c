@@ -8,6 +8,7 @@
 #include "unity.h"
 
 #include <Mockfwk_id.h>
+#include <Mockfwk_interrupt.h>
 #include <Mockfwk_module.h>
 #include <Mockfwk_notification.h>
 #include <Mockmod_power_domain_extra.h>
@@ -27,9 +28,12 @@ static const char *const default_state_name_table[] = {
 static struct mod_pd_driver_api pd_driver = {
     .set_state = pd_driver_set_state,
     .deny = pd_driver_deny,
+    .prepare_core_for_system_suspend =
+        pd_driver_prepare_core_for_system_suspend,
 };
 
 static struct pd_ctx pd_ctx[PD_IDX_COUNT];
+static struct pd_batch_request batch_request_table[PD_IDX_COUNT];
 
 /*
  * Utility functions for initializing the PD context table
@@ -39,6 +43,9 @@ static void init_module_ctx(void)
     mod_pd_ctx.pd_ctx_table = pd_ctx;
     mod_pd_ctx.pd_count = PD_IDX_COUNT;
     mod_pd_ctx.system_pd_ctx = &mod_pd_ctx.pd_ctx_table[PD_IDX_COUNT - 1];
+    mod_pd_ctx.batch = (struct pd_batch_ctx){
+        .request_table = batch_request_table,
+    };
 
     for (int i = 0; i < PD_IDX_COUNT; ++i) {
         pd_ctx[i] = pd_ctx_config[i];
@@ -86,6 +93,14 @@ static void construct_pd_relations(void)
         &pd_ctx[PD_IDX_CLUS1CORE1].child_node);
     pd_ctx[PD_IDX_CLUS1CORE0].parent = &pd_ctx[PD_IDX_CLUSTER1];
     pd_ctx[PD_IDX_CLUS1CORE1].parent = &pd_ctx[PD_IDX_CLUSTER1];
+
+    fwk_list_init(&mod_pd_ctx.root_list);
+    fwk_list_push_tail(
+        &mod_pd_ctx.root_list, &pd_ctx[PD_IDX_SYSTOP].child_node);
+
+    for (int i = 0; i < PD_IDX_COUNT; ++i) {
+        build_pd_ancestor_table(&pd_ctx[i]);
+    }
 }
 
 void setUp(void)
@@ -904,6 +919,392 @@ void test_system_suspend_single_active_core(void)
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
 }
 
+static void set_pd_on(enum pd_idx pd_idx)
+{
+    set_requested_state(&pd_ctx[pd_idx], MOD_PD_STATE_ON);
+    set_current_state(&pd_ctx[pd_idx], MOD_PD_STATE_ON);
+    pd_ctx[pd_idx].state_requested_to_driver = MOD_PD_STATE_ON;
+}
+
+void test_pd_ancestor_table(void)
+{
+    struct pd_ctx *pd = &pd_ctx[PD_IDX_CLUS1CORE0];
+
+    TEST_ASSERT_EQUAL_PTR(pd, pd->ancestors[MOD_PD_LEVEL_0]);
+    TEST_ASSERT_EQUAL_PTR(&pd_ctx[PD_IDX_CLUSTER1], pd->ancestors[1]);
+    TEST_ASSERT_EQUAL_PTR(&pd_ctx[PD_IDX_SYSTOP], pd->ancestors[2]);
+    TEST_ASSERT_NULL(pd->ancestors[3]);
+}
+
+void test_process_system_suspend_request_single_active_core(void)
+{
+    struct pd_system_suspend_request req_params = {
+        .state = MOD_SYSTEM_POWER_POWER_STATE_SLEEP0,
+    };
+    struct pd_response resp_params;
+
+    set_pd_on(PD_IDX_SYSTOP);
+    set_pd_on(PD_IDX_CLUSTER1);
+    set_pd_on(PD_IDX_CLUS1CORE1);
+
+    TEST_ASSERT_EQUAL(1, pd_ctx[PD_IDX_SYSTOP].active_core_count);
+    TEST_ASSERT_EQUAL(1, pd_ctx[PD_IDX_SYSTOP].active_cluster_count);
+    TEST_ASSERT_EQUAL(0, pd_ctx[PD_IDX_CLUSTER0].active_core_count);
+
+    pd_driver_prepare_core_for_system_suspend_ExpectAndReturn(
+        pd_ctx[PD_IDX_CLUS1CORE1].driver_id, FWK_SUCCESS);
+
+    process_system_suspend_request(&req_params, &resp_params);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, resp_params.status);
+    TEST_ASSERT_TRUE(mod_pd_ctx.system_suspend.last_core_off_ongoing);
+    TEST_ASSERT_EQUAL_PTR(
+        &pd_ctx[PD_IDX_CLUS1CORE1], mod_pd_ctx.system_suspend.last_core_pd);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_OFF, pd_ctx[PD_IDX_CLUS1CORE1].requested_state);
+
+    /* The core remains active until its transition to off completes */
+    TEST_ASSERT_EQUAL(1, pd_ctx[PD_IDX_SYSTOP].active_core_count);
+    set_current_state(&pd_ctx[PD_IDX_CLUS1CORE1], MOD_PD_STATE_OFF);
+    TEST_ASSERT_EQUAL(0, pd_ctx[PD_IDX_SYSTOP].active_core_count);
+}
+
+void test_process_system_suspend_request_multiple_active_cores(void)
+{
+    struct pd_system_suspend_request req_params = {
+        .state = MOD_SYSTEM_POWER_POWER_STATE_SLEEP0,
+    };
+    struct pd_response resp_params;
+
+    mod_pd_ctx.system_suspend.last_core_off_ongoing = false;
+
+    set_pd_on(PD_IDX_SYSTOP);
+    set_pd_on(PD_IDX_CLUSTER0);
+    set_pd_on(PD_IDX_CLUS0CORE0);
+    set_pd_on(PD_IDX_CLUS0CORE1);
+
+    process_system_suspend_request(&req_params, &resp_params);
+
+    TEST_ASSERT_EQUAL(FWK_E_STATE, resp_params.status);
+    TEST_ASSERT_FALSE(mod_pd_ctx.system_suspend.last_core_off_ongoing);
+}
+
+static void add_batch_request(enum pd_idx pd_idx, uint32_t composite_state)
+{
+    struct pd_batch_request *request =
+        &mod_pd_ctx.batch.request_table[mod_pd_ctx.batch.request_count++];
+
+    request->pd = &pd_ctx[pd_idx];
+    request->composite_state = composite_state;
+    pd_ctx[pd_idx].batch_request = request;
+}
+
+void test_process_set_state_batch_cores_on_share_cluster_transition(void)
+{
+    struct fwk_event event = { .response_requested = true };
+    struct fwk_event resp_event = { .cookie = 42 };
+    uint32_t composite_state = MOD_PD_COMPOSITE_STATE(
+        MOD_PD_LEVEL_1, 0, 0, MOD_PD_STATE_ON, MOD_PD_STATE_ON);
+
+    mod_pd_ctx.batch.queued = true;
+    add_batch_request(PD_IDX_CLUS0CORE0, composite_state);
+    add_batch_request(PD_IDX_CLUS0CORE1, composite_state);
+    pd_ctx[PD_IDX_CLUS0CORE1].set_state_after_batch = true;
+
+    is_upwards_transition_propagation_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE0], composite_state, false);
+    get_highest_level_from_composite_state_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE0], composite_state, MOD_PD_LEVEL_1);
+    is_upwards_transition_propagation_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE1], composite_state, false);
+    get_highest_level_from_composite_state_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE1], composite_state, MOD_PD_LEVEL_1);
+
+    /* Cluster level, the second request finds the cluster already requested */
+    get_level_state_from_composite_state_ExpectAnyArgsAndReturn(
+        MOD_PD_STATE_ON);
+    prepare_allow_tree(true, true, true);
+    initiate_power_state_pre_transition_notification_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUSTER0], false);
+    prepare_mocks_for_set_state_request(
+        PD_IDX_CLUSTER0, MOD_PD_STATE_ON, false, FWK_SUCCESS);
+    prepare_state_name(MOD_PD_STATE_ON);
+    retrieve_mapped_state_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUSTER0], MOD_PD_STATE_ON, MOD_PD_STATE_ON);
+    get_level_state_from_composite_state_ExpectAnyArgsAndReturn(
+        MOD_PD_STATE_ON);
+
+    /*
+     * Core level, the cores wait for the cluster transition to be completed
+     * to initiate their own transitions.
+     */
+    get_level_state_from_composite_state_ExpectAnyArgsAndReturn(
+        MOD_PD_STATE_ON);
+    is_allowed_by_child_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE0], MOD_PD_STATE_ON, MOD_PD_STATE_ON, true);
+    is_allowed_by_children_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE0], MOD_PD_STATE_ON, true);
+    get_level_state_from_composite_state_ExpectAnyArgsAndReturn(
+        MOD_PD_STATE_ON);
+    prepare_allow_tree(true, true, false);
+
+    process_set_state_batch_request(&event, &resp_event);
+
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_ON, pd_ctx[PD_IDX_CLUSTER0].requested_state);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_ON, pd_ctx[PD_IDX_CLUSTER0].state_requested_to_driver);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_ON, pd_ctx[PD_IDX_CLUS0CORE0].requested_state);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_OFF, pd_ctx[PD_IDX_CLUS0CORE0].state_requested_to_driver);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_ON, pd_ctx[PD_IDX_CLUS0CORE1].requested_state);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_OFF, pd_ctx[PD_IDX_CLUS0CORE1].state_requested_to_driver);
+
+    /* A single response, delayed until both cores are on */
+    TEST_ASSERT_TRUE(resp_event.is_delayed_response);
+    TEST_ASSERT_TRUE(mod_pd_ctx.batch.response.pending);
+    TEST_ASSERT_EQUAL(42, mod_pd_ctx.batch.response.cookie);
+    TEST_ASSERT_EQUAL(2, mod_pd_ctx.batch.pending_pd_count);
+    TEST_ASSERT_EQUAL(2, mod_pd_ctx.batch.response_request_count);
+    TEST_ASSERT_TRUE(pd_ctx[PD_IDX_CLUS0CORE0].batch_response_pending);
+    TEST_ASSERT_TRUE(pd_ctx[PD_IDX_CLUS0CORE1].batch_response_pending);
+    TEST_ASSERT_FALSE(pd_ctx[PD_IDX_CLUSTER0].batch_response_pending);
+
+    TEST_ASSERT_FALSE(mod_pd_ctx.batch.queued);
+    TEST_ASSERT_EQUAL(0, mod_pd_ctx.batch.request_count);
+    TEST_ASSERT_NULL(pd_ctx[PD_IDX_CLUS0CORE0].batch_request);
+    TEST_ASSERT_NULL(pd_ctx[PD_IDX_CLUS0CORE1].batch_request);
+    TEST_ASSERT_FALSE(pd_ctx[PD_IDX_CLUS0CORE1].set_state_after_batch);
+}
+
+void test_set_state_batch_response_sent_on_last_transition(void)
+{
+    mod_pd_ctx.batch.response.pending = true;
+    mod_pd_ctx.batch.pending_pd_count = 2;
+    mod_pd_ctx.batch.response_status = FWK_SUCCESS;
+    pd_ctx[PD_IDX_CLUS0CORE0].batch_response_pending = true;
+    pd_ctx[PD_IDX_CLUS0CORE1].batch_response_pending = true;
+
+    send_pd_set_state_delayed_response(
+        &pd_ctx[PD_IDX_CLUS0CORE0], FWK_SUCCESS);
+
+    TEST_ASSERT_TRUE(mod_pd_ctx.batch.response.pending);
+    TEST_ASSERT_EQUAL(1, mod_pd_ctx.batch.pending_pd_count);
+
+    fwk_get_delayed_response_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    __fwk_put_event_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    send_pd_set_state_delayed_response(
+        &pd_ctx[PD_IDX_CLUS0CORE1], FWK_SUCCESS);
+
+    TEST_ASSERT_FALSE(mod_pd_ctx.batch.response.pending);
+    TEST_ASSERT_EQUAL(0, mod_pd_ctx.batch.pending_pd_count);
+    TEST_ASSERT_FALSE(pd_ctx[PD_IDX_CLUS0CORE0].batch_response_pending);
+    TEST_ASSERT_FALSE(pd_ctx[PD_IDX_CLUS0CORE1].batch_response_pending);
+}
+
+/* Event being processed when the API is called from an event handler */
+static const struct fwk_event current_event;
+
+void test_set_state_batch_merges_into_queued_batch(void)
+{
+    int status;
+    uint32_t composite_state = MOD_PD_COMPOSITE_STATE(
+        MOD_PD_LEVEL_1, 0, 0, MOD_PD_STATE_ON, MOD_PD_STATE_ON);
+    struct mod_pd_set_state_request requests[] = {
+        {
+            .pd_id = FWK_ID_ELEMENT(
+                FWK_MODULE_IDX_POWER_DOMAIN, PD_IDX_CLUS0CORE0),
+            .state = composite_state,
+        },
+        {
+            .pd_id = FWK_ID_ELEMENT(
+                FWK_MODULE_IDX_POWER_DOMAIN, PD_IDX_CLUS0CORE1),
+            .state = composite_state,
+        },
+    };
+
+    mod_pd_ctx.batch.queued = true;
+    add_batch_request(PD_IDX_CLUS0CORE0, MOD_PD_STATE_OFF);
+
+    fwk_is_interrupt_context_ExpectAndReturn(false);
+    fwk_module_is_valid_element_id_ExpectAnyArgsAndReturn(true);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(PD_IDX_CLUS0CORE0);
+    is_valid_composite_state_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE0], composite_state, true);
+    fwk_module_is_valid_element_id_ExpectAnyArgsAndReturn(true);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(PD_IDX_CLUS0CORE1);
+    is_valid_composite_state_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE1], composite_state, true);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(PD_IDX_CLUS0CORE0);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(PD_IDX_CLUS0CORE1);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(PD_IDX_CLUS0CORE0);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(PD_IDX_CLUS0CORE1);
+
+    /* No new event, the requests are merged into the queued batch */
+    status = pd_set_state_batch(requests, FWK_ARRAY_SIZE(requests), false);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, mod_pd_ctx.batch.request_count);
+    TEST_ASSERT_EQUAL_PTR(
+        &pd_ctx[PD_IDX_CLUS0CORE0], batch_request_table[0].pd);
+    TEST_ASSERT_EQUAL(composite_state, batch_request_table[0].composite_state);
+    TEST_ASSERT_EQUAL_PTR(
+        &pd_ctx[PD_IDX_CLUS0CORE1], batch_request_table[1].pd);
+    TEST_ASSERT_EQUAL(composite_state, batch_request_table[1].composite_state);
+
+    /* A batch expecting a response cannot be merged */
+    fwk_is_interrupt_context_ExpectAndReturn(false);
+    __fwk_get_current_event_ExpectAndReturn(&current_event);
+    fwk_module_is_valid_element_id_ExpectAnyArgsAndReturn(true);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(PD_IDX_CLUS0CORE0);
+    is_valid_composite_state_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE0], composite_state, true);
+
+    status = pd_set_state_batch(requests, 1, true);
+
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, status);
+    TEST_ASSERT_EQUAL(2, mod_pd_ctx.batch.request_count);
+}
+
+void test_set_state_batch_not_merged_after_set_state(void)
+{
+    int status;
+    uint32_t composite_state = MOD_PD_COMPOSITE_STATE(
+        MOD_PD_LEVEL_1, 0, 0, MOD_PD_STATE_ON, MOD_PD_STATE_ON);
+    fwk_id_t pd_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, PD_IDX_CLUS0CORE1);
+    struct mod_pd_set_state_request request = {
+        .pd_id = pd_id,
+        .state = composite_state,
+    };
+
+    mod_pd_ctx.batch.queued = true;
+    add_batch_request(PD_IDX_CLUS0CORE0, MOD_PD_STATE_OFF);
+
+    /* A request submitted on its own follows the queued batch */
+    fwk_id_get_element_idx_ExpectAndReturn(pd_id, PD_IDX_CLUS0CORE1);
+    is_valid_composite_state_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE1], composite_state, true);
+    __fwk_put_event_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = pd_set_state(pd_id, false, composite_state);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_TRUE(pd_ctx[PD_IDX_CLUS0CORE1].set_state_after_batch);
+
+    /* Merging a request for that power domain would overtake it */
+    fwk_is_interrupt_context_ExpectAndReturn(false);
+    fwk_module_is_valid_element_id_ExpectAnyArgsAndReturn(true);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(PD_IDX_CLUS0CORE1);
+    is_valid_composite_state_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE1], composite_state, true);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(PD_IDX_CLUS0CORE1);
+
+    status = pd_set_state_batch(&request, 1, false);
+
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, status);
+    TEST_ASSERT_EQUAL(1, mod_pd_ctx.batch.request_count);
+    TEST_ASSERT_NULL(pd_ctx[PD_IDX_CLUS0CORE1].batch_request);
+}
+
+static struct fwk_event put_event;
+
+static int put_event_callback(struct fwk_event *event, int num_calls)
+{
+    put_event = *event;
+
+    return FWK_SUCCESS;
+}
+
+void test_set_state_batch_queues_event(void)
+{
+    int status;
+    uint32_t composite_state = MOD_PD_COMPOSITE_STATE(
+        MOD_PD_LEVEL_1, 0, 0, MOD_PD_STATE_ON, MOD_PD_STATE_ON);
+    struct mod_pd_set_state_request request = {
+        .pd_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, PD_IDX_CLUS0CORE0),
+        .state = composite_state,
+    };
+
+    fwk_is_interrupt_context_ExpectAndReturn(false);
+    __fwk_get_current_event_ExpectAndReturn(&current_event);
+    fwk_module_is_valid_element_id_ExpectAnyArgsAndReturn(true);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(PD_IDX_CLUS0CORE0);
+    is_valid_composite_state_ExpectAndReturn(
+        &pd_ctx[PD_IDX_CLUS0CORE0], composite_state, true);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(PD_IDX_CLUS0CORE0);
+    __fwk_put_event_Stub(put_event_callback);
+
+    status = pd_set_state_batch(&request, 1, true);
+
+    __fwk_put_event_Stub(NULL);
+
+    /*
+     * The event has a valid source, replaced by the framework with the target
+     * of the event being processed.
+     */
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_TRUE(
+        fwk_id_is_equal(put_event.source_id, fwk_module_id_power_domain));
+    TEST_ASSERT_TRUE(
+        fwk_id_is_equal(put_event.target_id, fwk_module_id_power_domain));
+    TEST_ASSERT_TRUE(put_event.response_requested);
+    TEST_ASSERT_TRUE(mod_pd_ctx.batch.queued);
+    TEST_ASSERT_EQUAL(1, mod_pd_ctx.batch.request_count);
+}
+
+void test_set_state_batch_interrupt_context(void)
+{
+    struct mod_pd_set_state_request request = {
+        .pd_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, PD_IDX_CLUS0CORE0),
+        .state = MOD_PD_STATE_ON,
+    };
+
+    fwk_is_interrupt_context_ExpectAndReturn(true);
+
+    TEST_ASSERT_EQUAL(FWK_E_ACCESS, pd_set_state_batch(&request, 1, false));
+    TEST_ASSERT_FALSE(mod_pd_ctx.batch.queued);
+    TEST_ASSERT_EQUAL(0, mod_pd_ctx.batch.request_count);
+}
+
+void test_set_state_batch_response_outside_event(void)
+{
+    struct mod_pd_set_state_request request = {
+        .pd_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, PD_IDX_CLUS0CORE0),
+        .state = MOD_PD_STATE_ON,
+    };
+
+    /* The response would be sent back to the power domain module */
+    fwk_is_interrupt_context_ExpectAndReturn(false);
+    __fwk_get_current_event_ExpectAndReturn(NULL);
+
+    TEST_ASSERT_EQUAL(FWK_E_STATE, pd_set_state_batch(&request, 1, true));
+    TEST_ASSERT_FALSE(mod_pd_ctx.batch.queued);
+    TEST_ASSERT_EQUAL(0, mod_pd_ctx.batch.request_count);
+}
+
+void test_process_event_response_ignored(void)
+{
+    struct fwk_event event = {
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_POWER_DOMAIN,
+            MOD_PD_PUBLIC_EVENT_IDX_SET_STATE_BATCH),
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_POWER_DOMAIN),
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_POWER_DOMAIN),
+        .is_response = true,
+    };
+    struct fwk_event resp_event = { 0 };
+
+    mod_pd_ctx.system_suspend.last_core_off_ongoing = true;
+
+    /* The response is not processed as a new batch */
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, pd_process_event(&event, &resp_event));
+    TEST_ASSERT_TRUE(mod_pd_ctx.system_suspend.last_core_off_ongoing);
+}
+
 int power_domain_test_main(void)
 {
     UNITY_BEGIN();
@@ -932,8 +1333,19 @@ int power_domain_test_main(void)
     RUN_TEST(test_initiate_power_state_transition_fail_param);
     RUN_TEST(test_complete_system_suspend_no_cs);
     RUN_TEST(test_complete_system_suspend);
+    RUN_TEST(test_pd_ancestor_table);
+    RUN_TEST(test_process_system_suspend_request_single_active_core);
+    RUN_TEST(test_process_system_suspend_request_multiple_active_cores);
     RUN_TEST(test_system_suspend_multiple_active_cores);
     RUN_TEST(test_system_suspend_single_active_core);
+    RUN_TEST(test_process_set_state_batch_cores_on_share_cluster_transition);
+    RUN_TEST(test_set_state_batch_response_sent_on_last_transition);
+    RUN_TEST(test_set_state_batch_merges_into_queued_batch);
+    RUN_TEST(test_set_state_batch_not_merged_after_set_state);
+    RUN_TEST(test_set_state_batch_queues_event);
+    RUN_TEST(test_set_state_batch_interrupt_context);
+    RUN_TEST(test_set_state_batch_response_outside_event);
+    RUN_TEST(test_process_event_response_ignored);
     return UNITY_END();
 }
 
@@ -59,8 +59,18 @@ struct scmi_service_ctx {
 
     /* SCMI type of the message currently being processed */
     enum mod_scmi_message_type scmi_message_type;
+
+    /*
+     * SCMI protocol identifier to the index of the entry in protocol_table[]
+     * as seen by the agent of the service. Protocols the agent is not allowed
+     * to use are mapped to SCMI_PROTOCOL_IDX_DENIED.
+     */
+    const uint8_t *protocol_id_to_idx;
 };
 
+/* Protocol table index of the protocols denied to an agent */
+#define SCMI_PROTOCOL_IDX_DENIED UINT8_MAX
+
 struct scmi_protocol {
     /* SCMI protocol message handler */
     mod_scmi_message_handler_t *message_handler;
@@ -105,6 +115,20 @@ struct mod_scmi_ctx {
     /* Table of service contexts */
     struct scmi_service_ctx *service_ctx_table;
 
+#ifndef BUILD_HAS_MOD_RESOURCE_PERMS
+    /*
+     * Copy of scmi_protocol_id_to_idx[] with the protocols disabled for the
+     * PSCI agent denied. NULL if no protocol is disabled for it.
+     */
+    uint8_t *psci_protocol_id_to_idx;
+#endif
+
+    /*
+     * Dispatch statistics, indexed by protocol_table[] index and message
+     * identifier. NULL if statistics are disabled.
+     */
+    struct mod_scmi_message_stats *message_stats;
+
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
     /* SCMI Resource Permissions API */
     const struct mod_res_permissions_api *res_perms_api;
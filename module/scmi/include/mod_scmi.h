@@ -41,6 +41,7 @@ enum mod_scmi_api_idx {
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
     MOD_SCMI_API_IDX_NOTIFICATION,
 #endif
+    MOD_SCMI_API_IDX_STATS,
     MOD_SCMI_API_IDX_COUNT,
 };
 
@@ -135,6 +136,17 @@ struct mod_scmi_config {
      *       if it exceeds this limit.
      */
     const char *sub_vendor_identifier;
+
+    /*!
+     *  \brief Number of message identifiers, per protocol, for which dispatch
+     *       statistics are recorded.
+     *
+     *  \details Statistics are kept for the messages with an identifier lower
+     *       than this value and can be read back through the
+     *       ::MOD_SCMI_API_IDX_STATS API. If set to zero then no statistics
+     *       are recorded.
+     */
+    unsigned int message_stats_count;
 };
 
 /*!
@@ -696,6 +708,59 @@ struct mod_scmi_from_protocol_req_api {
     int (*response_message_handler)(fwk_id_t service_id);
 };
 
+/*!
+ * \brief Dispatch statistics of an SCMI message.
+ */
+struct mod_scmi_message_stats {
+    /*! Number of messages dispatched to the protocol handler */
+    uint32_t count;
+
+    /*! Number of messages for which the protocol handler returned an error */
+    uint32_t error_count;
+
+    /*! Number of messages denied to the requesting agent */
+    uint32_t denied_count;
+
+    /*! Cumulated time spent in the protocol handler, in nanoseconds */
+    uint64_t total_latency;
+
+    /*! Longest time spent in the protocol handler, in nanoseconds */
+    uint64_t max_latency;
+};
+
+/*!
+ * \brief SCMI module statistics API.
+ *
+ * \details Debug interface used to read back the dispatch statistics recorded
+ *      by the SCMI module for the messages received by the platform.
+ */
+struct mod_scmi_stats_api {
+    /*!
+     * \brief Get the dispatch statistics of a message.
+     *
+     * \param protocol_id SCMI protocol identifier.
+     * \param message_id SCMI message identifier.
+     * \param[out] stats Statistics of the message.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_PARAM The protocol is not supported or `stats` is NULL.
+     * \retval ::FWK_E_RANGE No statistics are recorded for `message_id`.
+     * \retval ::FWK_E_SUPPORT Statistics are disabled.
+     */
+    int (*get_message_stats)(
+        uint8_t protocol_id,
+        uint8_t message_id,
+        struct mod_scmi_message_stats *stats);
+
+    /*!
+     * \brief Reset the dispatch statistics of all the messages.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_SUPPORT Statistics are disabled.
+     */
+    int (*reset_message_stats)(void);
+};
+
 /*!
  * \brief SCMI notification indices.
  */
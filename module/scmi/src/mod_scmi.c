@@ -29,6 +29,7 @@
 #include <fwk_notification.h>
 #include <fwk_status.h>
 #include <fwk_string.h>
+#include <fwk_time.h>
 
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
 #    include <mod_resource_perms.h>
@@ -729,6 +730,138 @@ static struct mod_scmi_notification_api mod_scmi_notif_api = {
 };
 #endif
 
+/*
+ * SCMI module statistics API
+ */
+
+static struct mod_scmi_message_stats *get_message_stats_entry(
+    unsigned int protocol_idx,
+    unsigned int message_id)
+{
+    unsigned int message_stats_count = scmi_ctx.config->message_stats_count;
+
+    if ((scmi_ctx.message_stats == NULL) ||
+        (message_id >= message_stats_count)) {
+        return NULL;
+    }
+
+    return &scmi_ctx
+                .message_stats[(protocol_idx * message_stats_count) + message_id];
+}
+
+static int get_message_stats(
+    uint8_t protocol_id,
+    uint8_t message_id,
+    struct mod_scmi_message_stats *stats)
+{
+    unsigned int protocol_idx;
+    const struct mod_scmi_message_stats *entry;
+
+    if (scmi_ctx.message_stats == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    protocol_idx = scmi_ctx.scmi_protocol_id_to_idx[protocol_id];
+    if ((stats == NULL) || (protocol_idx == 0)) {
+        return FWK_E_PARAM;
+    }
+
+    entry = get_message_stats_entry(protocol_idx, message_id);
+    if (entry == NULL) {
+        return FWK_E_RANGE;
+    }
+
+    *stats = *entry;
+
+    return FWK_SUCCESS;
+}
+
+static int reset_message_stats(void)
+{
+    if (scmi_ctx.message_stats == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    fwk_str_memset(
+        scmi_ctx.message_stats,
+        0,
+        (scmi_ctx.config->protocol_count_max +
+         PROTOCOL_TABLE_RESERVED_ENTRIES_COUNT) *
+            scmi_ctx.config->message_stats_count *
+            sizeof(scmi_ctx.message_stats[0]));
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_stats_api scmi_stats_api = {
+    .get_message_stats = get_message_stats,
+    .reset_message_stats = reset_message_stats,
+};
+
+#ifndef BUILD_HAS_MOD_RESOURCE_PERMS
+/*
+ * Build the dispatch table of the PSCI agents, a copy of the
+ * 'scmi_protocol_id_to_idx[]' table in which the protocols disabled for the
+ * PSCI agent are denied, and point the services of the PSCI agents to it.
+ */
+static int scmi_build_psci_dispatch_table(fwk_id_t module_id)
+{
+    const struct mod_scmi_config *config = scmi_ctx.config;
+    uint8_t *protocol_id_to_idx;
+    struct scmi_service_ctx *ctx;
+    enum scmi_agent_type agent_type;
+    unsigned int service_idx, service_count;
+    unsigned int index;
+    uint32_t protocol_id;
+    int status;
+
+    if (config->dis_protocol_count_psci == 0) {
+        return FWK_SUCCESS;
+    }
+
+    if (config->dis_protocol_list_psci == NULL) {
+        return FWK_E_DATA;
+    }
+
+    protocol_id_to_idx = fwk_mm_alloc(
+        FWK_ARRAY_SIZE(scmi_ctx.scmi_protocol_id_to_idx),
+        sizeof(protocol_id_to_idx[0]));
+    fwk_str_memcpy(
+        protocol_id_to_idx,
+        scmi_ctx.scmi_protocol_id_to_idx,
+        sizeof(scmi_ctx.scmi_protocol_id_to_idx));
+
+    for (index = 0; index < config->dis_protocol_count_psci; index++) {
+        protocol_id = config->dis_protocol_list_psci[index];
+        if ((protocol_id <= MOD_SCMI_PROTOCOL_ID_MAX) &&
+            (protocol_id_to_idx[protocol_id] != 0)) {
+            protocol_id_to_idx[protocol_id] = SCMI_PROTOCOL_IDX_DENIED;
+        }
+    }
+
+    scmi_ctx.psci_protocol_id_to_idx = protocol_id_to_idx;
+
+    service_count = (unsigned int)fwk_module_get_element_count(module_id);
+    for (service_idx = 0; service_idx < service_count; service_idx++) {
+        ctx = &scmi_ctx.service_ctx_table[service_idx];
+        if (ctx->config->scmi_entity_role != MOD_SCMI_ROLE_PLATFORM) {
+            continue;
+        }
+
+        status = get_agent_type(ctx->config->scmi_agent_id, &agent_type);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        if (agent_type == SCMI_AGENT_TYPE_PSCI) {
+            ctx->protocol_id_to_idx = protocol_id_to_idx;
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+#endif
+
 /*
  * Framework handlers
  */
@@ -748,6 +881,11 @@ static int scmi_init(fwk_id_t module_id, unsigned int service_count,
         return FWK_E_PARAM;
     }
 
+    if ((config->protocol_count_max + PROTOCOL_TABLE_RESERVED_ENTRIES_COUNT) >
+        SCMI_PROTOCOL_IDX_DENIED) {
+        return FWK_E_PARAM;
+    }
+
     /*
      * Loop over the agent descriptors. The MOD_SCMI_PLATFORM_ID(0) entry of
      * the table - that would refer to the platform - is ignored.
@@ -776,6 +914,16 @@ static int scmi_init(fwk_id_t module_id, unsigned int service_count,
     scmi_ctx.service_ctx_table = fwk_mm_calloc(
         service_count, sizeof(scmi_ctx.service_ctx_table[0]));
 
+    if (config->message_stats_count != 0) {
+        scmi_ctx.message_stats = fwk_mm_calloc(
+            (config->protocol_count_max +
+             PROTOCOL_TABLE_RESERVED_ENTRIES_COUNT) *
+                config->message_stats_count,
+            sizeof(scmi_ctx.message_stats[0]));
+    } else {
+        scmi_ctx.message_stats = NULL;
+    }
+
 #ifdef BUILD_HAS_BASE_PROTOCOL
     scmi_ctx.protocol_table[PROTOCOL_TABLE_BASE_PROTOCOL_IDX].message_handler =
         scmi_base_message_handler;
@@ -804,6 +952,7 @@ static int scmi_service_init(fwk_id_t service_id, unsigned int unused,
 
     ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
     ctx->config = config;
+    ctx->protocol_id_to_idx = scmi_ctx.scmi_protocol_id_to_idx;
 
     return FWK_SUCCESS;
 }
@@ -915,6 +1064,11 @@ static int scmi_bind(fwk_id_t id, unsigned int round)
     if (status != FWK_SUCCESS) {
         return status;
     }
+#else
+    status = scmi_build_psci_dispatch_table(id);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
 #endif
 
     return FWK_SUCCESS;
@@ -983,6 +1137,14 @@ static int scmi_process_bind_request(fwk_id_t source_id, fwk_id_t target_id,
         break;
 #endif
 
+    case MOD_SCMI_API_IDX_STATS:
+        if (!fwk_id_is_type(target_id, FWK_ID_TYPE_MODULE)) {
+            return FWK_E_SUPPORT;
+        }
+
+        *api = &scmi_stats_api;
+        break;
+
     default:
         return FWK_E_SUPPORT;
     };
@@ -1001,12 +1163,10 @@ static int scmi_process_event(const struct fwk_event *event,
     const void *payload;
     size_t payload_size;
     unsigned int protocol_idx;
-#ifndef BUILD_HAS_MOD_RESOURCE_PERMS
-    enum scmi_agent_type agent_type;
-    unsigned int agent_id;
-    unsigned int dis_protocol_list_psci_index;
-#endif
     struct scmi_protocol *protocol;
+    struct mod_scmi_message_stats *stats = NULL;
+    fwk_timestamp_t start = 0;
+    fwk_duration_ns_t latency;
     const char *service_name;
     const char *message_type_name;
 
@@ -1069,7 +1229,7 @@ static int scmi_process_event(const struct fwk_event *event,
         return FWK_SUCCESS;
     }
     if (ctx->config->scmi_entity_role == MOD_SCMI_ROLE_PLATFORM) {
-        protocol_idx = scmi_ctx.scmi_protocol_id_to_idx[ctx->scmi_protocol_id];
+        protocol_idx = ctx->protocol_id_to_idx[ctx->scmi_protocol_id];
         if (protocol_idx == 0) {
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
             FWK_LOG_ERR(
@@ -1090,55 +1250,34 @@ static int scmi_process_event(const struct fwk_event *event,
             return FWK_SUCCESS;
         }
 
-#ifndef BUILD_HAS_MOD_RESOURCE_PERMS
-    status = get_agent_id(event->target_id, &agent_id);
-    if (status != FWK_SUCCESS) {
-#    if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
-        FWK_LOG_ERR("[SCMI] %s: Unable to get agent id", service_name);
-#    endif
-        return status;
-    }
-
-    status = get_agent_type(agent_id, &agent_type);
-    if (status != FWK_SUCCESS) {
-#    if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
-        FWK_LOG_ERR("[SCMI] %s: Unable to get agent type", service_name);
-#    endif
-        return status;
-    }
+        if (protocol_idx == SCMI_PROTOCOL_IDX_DENIED) {
+#if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
+            FWK_LOG_ERR(
+                "[SCMI] %s: %s [%" PRIu16
+                "(0x%x:0x%x)] requested a denied protocol",
+                service_name,
+                message_type_name,
+                ctx->scmi_token,
+                ctx->scmi_protocol_id,
+                ctx->scmi_message_id);
+#endif
+            stats = get_message_stats_entry(
+                scmi_ctx.scmi_protocol_id_to_idx[ctx->scmi_protocol_id],
+                ctx->scmi_message_id);
+            if (stats != NULL) {
+                stats->denied_count++;
+            }
 
-    if (agent_type == SCMI_AGENT_TYPE_PSCI) {
-        /*
-         * check if the current protocol is within the disabled protocols
-         * list for PSCI agent.
-         */
-        for (dis_protocol_list_psci_index = 0; dis_protocol_list_psci_index <
-             scmi_ctx.config->dis_protocol_count_psci;
-             dis_protocol_list_psci_index++) {
-            if (ctx->scmi_protocol_id ==
-                scmi_ctx.config
-                    ->dis_protocol_list_psci[dis_protocol_list_psci_index]) {
-#    if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
-                FWK_LOG_ERR(
-                    "[SCMI] %s: %s [%" PRIu16
-                    "(0x%x:0x%x)] requested a denied protocol",
-                    service_name,
-                    message_type_name,
-                    ctx->scmi_token,
-                    ctx->scmi_protocol_id,
-                    ctx->scmi_message_id);
-#    endif
-                status = ctx->respond(
-                    transport_id, &(int32_t){ SCMI_DENIED }, sizeof(int32_t));
-                if (status != FWK_SUCCESS) {
-                    FWK_LOG_DEBUG("[SCMI] %s @%d", __func__, __LINE__);
-                }
-                return FWK_SUCCESS;
+            status = ctx->respond(
+                transport_id, &(int32_t){ SCMI_DENIED }, sizeof(int32_t));
+            if (status != FWK_SUCCESS) {
+                FWK_LOG_DEBUG("[SCMI] %s @%d", __func__, __LINE__);
             }
+            return FWK_SUCCESS;
         }
-    }
-#endif
-    protocol = &scmi_ctx.protocol_table[protocol_idx];
+
+        protocol = &scmi_ctx.protocol_table[protocol_idx];
+        stats = get_message_stats_entry(protocol_idx, ctx->scmi_message_id);
     } else if (ctx->config->scmi_entity_role == MOD_SCMI_ROLE_AGENT) {
         protocol_idx =
             scmi_ctx.scmi_protocol_requester_id_to_idx[ctx->scmi_protocol_id];
@@ -1147,9 +1286,25 @@ static int scmi_process_event(const struct fwk_event *event,
         return FWK_E_INIT;
     }
 
+    if (stats != NULL) {
+        start = fwk_time_current();
+    }
+
     status =
         send_to_message_handler(ctx, protocol, payload, payload_size, event);
 
+    if (stats != NULL) {
+        latency = fwk_time_stamp_duration(start);
+        stats->count++;
+        stats->total_latency += latency;
+        if (latency > stats->max_latency) {
+            stats->max_latency = latency;
+        }
+        if (status != FWK_SUCCESS) {
+            stats->error_count++;
+        }
+    }
+
     if (status != FWK_SUCCESS) {
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
         FWK_LOG_ERR(
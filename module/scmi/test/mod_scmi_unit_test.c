@@ -43,6 +43,11 @@ enum fake_services {
 #define FAKE_SCMI_AGENT_IDX_PSCI    0x6
 #define FAKE_SCMI_AGENT_IDX_OSPM    0x7
 
+#define FAKE_PROTOCOL_ID             0x15
+#define FAKE_PROTOCOL_IDX            PROTOCOL_TABLE_RESERVED_ENTRIES_COUNT
+#define FAKE_PROTOCOL_ID_UNSUPPORTED 0x16
+#define FAKE_MESSAGE_STATS_COUNT     4
+
 static const struct fwk_element element_table[] = {
     [FAKE_SERVICE_IDX_PSCI] = {
         .name = "PSCI",
@@ -154,6 +159,9 @@ void setUp(void)
         FAKE_SERVICE_IDX_COUNT, sizeof(scmi_ctx.service_ctx_table[0]));
     scmi_ctx.scmi_protocol_id_to_idx[MOD_SCMI_PROTOCOL_ID_BASE] =
         PROTOCOL_TABLE_BASE_PROTOCOL_IDX;
+    scmi_ctx.scmi_protocol_id_to_idx[FAKE_PROTOCOL_ID] = 0;
+    scmi_ctx.psci_protocol_id_to_idx = NULL;
+    scmi_ctx.message_stats = NULL;
 
     scmi_base_set_shared_ctx(&scmi_ctx);
     scmi_base_set_api(&from_protocol_api);
@@ -166,6 +174,7 @@ void setUp(void)
     ctx->transport_id = ctx->config->transport_id;
     ctx->respond = transport_api->respond;
     ctx->transmit = transport_api->transmit;
+    ctx->protocol_id_to_idx = scmi_ctx.scmi_protocol_id_to_idx;
 
     ctx = &scmi_ctx.service_ctx_table[FAKE_SERVICE_IDX_OSPM];
     ctx->config =
@@ -175,6 +184,54 @@ void setUp(void)
     ctx->transport_id = ctx->config->transport_id;
     ctx->respond = transport_api->respond;
     ctx->transmit = transport_api->transmit;
+    ctx->protocol_id_to_idx = scmi_ctx.scmi_protocol_id_to_idx;
+}
+
+static void setup_fake_protocol(void)
+{
+    scmi_ctx.protocol_table[FAKE_PROTOCOL_IDX].message_handler =
+        test_mod_scmi_message_handler;
+    scmi_ctx.scmi_protocol_id_to_idx[FAKE_PROTOCOL_ID] = FAKE_PROTOCOL_IDX;
+}
+
+static void setup_psci_dispatch_table(struct mod_scmi_config *config)
+{
+    static const uint32_t dis_protocol_list_psci[] = {
+        FAKE_PROTOCOL_ID,
+        FAKE_PROTOCOL_ID_UNSUPPORTED,
+    };
+    fwk_id_t module_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SCMI);
+
+    *config = *scmi_ctx.config;
+    config->dis_protocol_count_psci = FWK_ARRAY_SIZE(dis_protocol_list_psci);
+    config->dis_protocol_list_psci = dis_protocol_list_psci;
+    scmi_ctx.config = config;
+
+#if !defined(TEST_ON_TARGET)
+    fwk_module_get_element_count_ExpectAndReturn(
+        module_id, FAKE_SERVICE_IDX_COUNT);
+#endif
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_build_psci_dispatch_table(module_id));
+}
+
+static void expect_message(enum fake_services service_idx, uint8_t protocol_id)
+{
+    fwk_id_t service_id = FWK_ID_ELEMENT_INIT(FAKE_MODULE_ID, service_idx);
+    static uint32_t message_header;
+
+    message_header = scmi_message_header(
+        0x1, MOD_SCMI_MESSAGE_TYPE_COMMAND, protocol_id, 0x0);
+
+#if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_ExpectAndReturn(service_id, service_idx);
+    fwk_module_get_element_name_ExpectAndReturn(service_id, "Service");
+#endif
+    mod_scmi_to_transport_api_get_message_header_ExpectAnyArgsAndReturn(
+        FWK_SUCCESS);
+    mod_scmi_to_transport_api_get_message_header_ReturnThruPtr_message_header(
+        &message_header);
+    mod_scmi_to_transport_api_get_payload_ExpectAnyArgsAndReturn(FWK_SUCCESS);
 }
 
 void tearDown(void)
@@ -283,6 +340,114 @@ void test_send_to_notification_handler(void)
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
 }
 
+void test_scmi_build_psci_dispatch_table(void)
+{
+    struct mod_scmi_config config;
+    const uint8_t *psci_table;
+
+    setup_fake_protocol();
+    setup_psci_dispatch_table(&config);
+
+    psci_table = scmi_ctx.psci_protocol_id_to_idx;
+    TEST_ASSERT_NOT_NULL(psci_table);
+    TEST_ASSERT_EQUAL(SCMI_PROTOCOL_IDX_DENIED, psci_table[FAKE_PROTOCOL_ID]);
+    TEST_ASSERT_EQUAL(0, psci_table[FAKE_PROTOCOL_ID_UNSUPPORTED]);
+    TEST_ASSERT_EQUAL(
+        PROTOCOL_TABLE_BASE_PROTOCOL_IDX,
+        psci_table[MOD_SCMI_PROTOCOL_ID_BASE]);
+
+    TEST_ASSERT_EQUAL_PTR(
+        psci_table,
+        scmi_ctx.service_ctx_table[FAKE_SERVICE_IDX_PSCI].protocol_id_to_idx);
+    TEST_ASSERT_EQUAL_PTR(
+        scmi_ctx.scmi_protocol_id_to_idx,
+        scmi_ctx.service_ctx_table[FAKE_SERVICE_IDX_OSPM].protocol_id_to_idx);
+
+    scmi_ctx.config = (struct mod_scmi_config *)config_scmi.data;
+}
+
+void test_scmi_process_event_denied_protocol(void)
+{
+    struct mod_scmi_config config;
+    struct fwk_event event = {
+        .target_id = FWK_ID_ELEMENT_INIT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_PSCI),
+    };
+
+    setup_fake_protocol();
+    setup_psci_dispatch_table(&config);
+
+    /* The PSCI agent is denied the protocol, the handler is not called */
+    expect_message(FAKE_SERVICE_IDX_PSCI, FAKE_PROTOCOL_ID);
+    mod_scmi_to_transport_api_respond_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_process_event(&event, NULL));
+
+    /* Other agents are dispatched to the protocol handler */
+    event.target_id =
+        FWK_ID_ELEMENT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_OSPM);
+    expect_message(FAKE_SERVICE_IDX_OSPM, FAKE_PROTOCOL_ID);
+    test_mod_scmi_message_handler_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_process_event(&event, NULL));
+
+    scmi_ctx.config = (struct mod_scmi_config *)config_scmi.data;
+}
+
+void test_scmi_message_stats(void)
+{
+    struct mod_scmi_config config;
+    struct mod_scmi_message_stats stats;
+    struct fwk_event event = {
+        .target_id = FWK_ID_ELEMENT_INIT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_OSPM),
+    };
+
+    TEST_ASSERT_EQUAL(
+        FWK_E_SUPPORT, get_message_stats(FAKE_PROTOCOL_ID, 0x1, &stats));
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, reset_message_stats());
+
+    setup_fake_protocol();
+    setup_psci_dispatch_table(&config);
+    config.message_stats_count = FAKE_MESSAGE_STATS_COUNT;
+    scmi_ctx.message_stats = fwk_mm_calloc(
+        (config.protocol_count_max + PROTOCOL_TABLE_RESERVED_ENTRIES_COUNT) *
+            config.message_stats_count,
+        sizeof(scmi_ctx.message_stats[0]));
+
+    expect_message(FAKE_SERVICE_IDX_OSPM, FAKE_PROTOCOL_ID);
+    test_mod_scmi_message_handler_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_process_event(&event, NULL));
+
+    expect_message(FAKE_SERVICE_IDX_OSPM, FAKE_PROTOCOL_ID);
+    test_mod_scmi_message_handler_ExpectAnyArgsAndReturn(FWK_E_PARAM);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_process_event(&event, NULL));
+
+    event.target_id =
+        FWK_ID_ELEMENT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_PSCI);
+    expect_message(FAKE_SERVICE_IDX_PSCI, FAKE_PROTOCOL_ID);
+    mod_scmi_to_transport_api_respond_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_process_event(&event, NULL));
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, get_message_stats(FAKE_PROTOCOL_ID, 0x1, &stats));
+    TEST_ASSERT_EQUAL(2, stats.count);
+    TEST_ASSERT_EQUAL(1, stats.error_count);
+    TEST_ASSERT_EQUAL(1, stats.denied_count);
+    TEST_ASSERT_TRUE(stats.max_latency <= stats.total_latency);
+
+    TEST_ASSERT_EQUAL(
+        FWK_E_PARAM,
+        get_message_stats(FAKE_PROTOCOL_ID_UNSUPPORTED, 0x1, &stats));
+    TEST_ASSERT_EQUAL(
+        FWK_E_RANGE,
+        get_message_stats(FAKE_PROTOCOL_ID, FAKE_MESSAGE_STATS_COUNT, &stats));
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, reset_message_stats());
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, get_message_stats(FAKE_PROTOCOL_ID, 0x1, &stats));
+    TEST_ASSERT_EQUAL(0, stats.count);
+    TEST_ASSERT_EQUAL(0, stats.denied_count);
+
+    scmi_ctx.config = (struct mod_scmi_config *)config_scmi.data;
+}
+
 int scmi_test_main(void)
 {
     UNITY_BEGIN();
@@ -292,6 +457,10 @@ int scmi_test_main(void)
 
     RUN_TEST(test_send_to_message_handler);
     RUN_TEST(test_send_to_notification_handler);
+
+    RUN_TEST(test_scmi_build_psci_dispatch_table);
+    RUN_TEST(test_scmi_process_event_denied_protocol);
+    RUN_TEST(test_scmi_message_stats);
     return UNITY_END();
 }
 
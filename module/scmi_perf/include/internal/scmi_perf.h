@@ -390,6 +390,20 @@ struct scmi_perf_describe_fc_p2a {
 
 fwk_id_t get_dependency_id(unsigned int el_idx);
 
+/*
+ * Batch of performance level requests, committed to DVFS together.
+ */
+struct perf_level_batch {
+    /* Level requests, at most one per DVFS domain */
+    struct mod_dvfs_level_request *requests;
+
+    /* Number of requests in the batch */
+    unsigned int count;
+
+    /* Maximum number of requests in the batch */
+    unsigned int capacity;
+};
+
 /*
  * Interface to SCMI Perf FastChannels stub
  */
@@ -413,6 +427,20 @@ struct mod_scmi_perf_private_api_perf_stub {
         fwk_id_t domain_id,
         uint32_t range_min,
         uint32_t range_max);
+
+    int (*perf_batch_set_level)(
+        struct perf_level_batch *batch,
+        fwk_id_t domain_id,
+        unsigned int agent_id,
+        uint32_t perf_level);
+
+    int (*perf_batch_add_level)(
+        struct perf_level_batch *batch,
+        fwk_id_t domain_id,
+        unsigned int agent_id,
+        uint32_t perf_level);
+
+    int (*perf_batch_commit)(struct perf_level_batch *batch);
 };
 
 void perf_fch_set_fch_get_level(uint32_t domain_idx, uint32_t level);
@@ -116,10 +116,7 @@ static int find_opp_for_level(
 
 #if defined(BUILD_HAS_SCMI_PERF_PROTOCOL_OPS) || \
     defined(BUILD_HAS_SCMI_PERF_FAST_CHANNELS)
-static int perf_set_level(
-    fwk_id_t domain_id,
-    unsigned int agent_id,
-    uint32_t perf_level)
+static int perf_check_level(fwk_id_t domain_id, uint32_t *perf_level)
 {
     struct scmi_perf_domain_ctx *domain_ctx;
     int status;
@@ -127,18 +124,102 @@ static int perf_set_level(
     domain_ctx = get_ctx(domain_id);
 
     status = find_opp_for_level(
-        domain_ctx, &perf_level, scmi_perf_ctx.config->approximate_level);
+        domain_ctx, perf_level, scmi_perf_ctx.config->approximate_level);
     if (status != FWK_SUCCESS) {
         return status;
     }
 
-    if ((perf_level < domain_ctx->level_limits.minimum) ||
-        (perf_level > domain_ctx->level_limits.maximum)) {
+    if ((*perf_level < domain_ctx->level_limits.minimum) ||
+        (*perf_level > domain_ctx->level_limits.maximum)) {
         return FWK_E_RANGE;
     }
 
+    return FWK_SUCCESS;
+}
+
+static int perf_set_level(
+    fwk_id_t domain_id,
+    unsigned int agent_id,
+    uint32_t perf_level)
+{
+    int status;
+
+    status = perf_check_level(domain_id, &perf_level);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
     return scmi_perf_ctx.dvfs_api->set_level(domain_id, agent_id, perf_level);
 }
+
+/*
+ * Add a level request to a batch. A request for a DVFS domain already in the
+ * batch replaces the previous one, which would be superseded anyway. The level
+ * is not checked, as for the levels evaluated by the plugins handler.
+ */
+static int perf_level_batch_add(
+    struct perf_level_batch *batch,
+    fwk_id_t domain_id,
+    unsigned int agent_id,
+    uint32_t perf_level)
+{
+    unsigned int i;
+
+    for (i = 0; i < batch->count; i++) {
+        if (fwk_id_is_equal(batch->requests[i].domain_id, domain_id)) {
+            batch->requests[i].cookie = agent_id;
+            batch->requests[i].level = perf_level;
+
+            return FWK_SUCCESS;
+        }
+    }
+
+    if (batch->count == batch->capacity) {
+        return FWK_E_NOMEM;
+    }
+
+    batch->requests[batch->count++] = (struct mod_dvfs_level_request){
+        .domain_id = domain_id,
+        .cookie = agent_id,
+        .level = perf_level,
+    };
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Send the requests of a batch to DVFS, which starts their transitions
+ * together. The batch is empty afterwards.
+ */
+static int perf_level_batch_commit(struct perf_level_batch *batch)
+{
+    int status;
+
+    if (batch->count == 0) {
+        return FWK_SUCCESS;
+    }
+
+    status = scmi_perf_ctx.dvfs_api->set_levels(batch->requests, batch->count);
+    batch->count = 0;
+
+    return status;
+}
+
+static int perf_batch_set_level(
+    struct perf_level_batch *batch,
+    fwk_id_t domain_id,
+    unsigned int agent_id,
+    uint32_t perf_level)
+{
+    int status;
+
+    status = perf_check_level(domain_id, &perf_level);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    return perf_level_batch_add(batch, domain_id, agent_id, perf_level);
+}
 #endif
 
 static int validate_new_limits(
@@ -363,6 +444,9 @@ static struct mod_scmi_perf_private_api_perf_stub api_perf_stub = {
     .perf_set_limits = perf_set_limits,
     .find_opp_for_level = find_opp_for_level,
     .notify_limits_updated = scmi_perf_notify_limits_updated,
+    .perf_batch_set_level = perf_batch_set_level,
+    .perf_batch_add_level = perf_level_batch_add,
+    .perf_batch_commit = perf_level_batch_commit,
 };
 #endif
 
@@ -645,6 +729,7 @@ static int scmi_perf_process_event(
 const struct fwk_module module_scmi_perf = {
     .api_count = (unsigned int)MOD_SCMI_PERF_API_COUNT,
     .event_count = (unsigned int)SCMI_PERF_EVENT_IDX_COUNT,
+    .event_priority = FWK_EVENT_PRIORITY_HIGH,
     .type = FWK_MODULE_TYPE_PROTOCOL,
     .init = scmi_perf_init,
     .bind = scmi_perf_bind,
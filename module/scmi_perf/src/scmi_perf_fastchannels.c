@@ -25,11 +25,29 @@
 #include <fwk_core.h>
 #include <fwk_event.h>
 #include <fwk_id.h>
+#include <fwk_interrupt.h>
 #include <fwk_log.h>
 #include <fwk_macros.h>
+#include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_string.h>
 
+#include <limits.h>
+
+#ifndef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+/* Number of domains tracked by each word of the dirty domains bitmap */
+#    define FCH_DIRTY_WORD_BITS (sizeof(uint32_t) * CHAR_BIT)
+#else
+/*
+ * Performance last applied for a domain from the values returned by the
+ * plugins handler, once evaluated against the OPPs of the domain.
+ */
+struct perf_fch_applied {
+    uint32_t level;
+    struct mod_scmi_perf_level_limits limits;
+};
+#endif
+
 struct mod_scmi_perf_fc_ctx {
     struct mod_scmi_perf_ctx *perf_ctx;
 
@@ -40,6 +58,20 @@ struct mod_scmi_perf_fc_ctx {
 
     volatile uint32_t pending_req_count;
 
+    /* Level requests gathered while processing the fast channels */
+    struct perf_level_batch batch;
+
+#ifndef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+    /* Bitmap of the domains whose fast channels have been signalled */
+    volatile uint32_t *dirty_domains;
+
+    /* True if all the domains must be checked, e.g. on a polling tick */
+    volatile bool full_scan;
+#else
+    /* Table of the performance last applied, one per domain */
+    struct perf_fch_applied *applied;
+#endif
+
 #ifdef BUILD_HAS_MOD_TRANSPORT_FC
 
     /*
@@ -78,6 +110,19 @@ static inline struct scmi_perf_domain_ctx *perf_fch_get_ctx(fwk_id_t domain_id)
     return &perf_fch_ctx.perf_ctx
                 ->domain_ctx_table[fwk_id_get_element_idx(domain_id)];
 }
+
+/*
+ * The level of a domain has been updated. A level other than the one last
+ * applied from the fast channels was requested through another path, so the
+ * level of the fast channels is forwarded again on the next request.
+ */
+static void perf_fch_level_updated(uint32_t domain_idx, uint32_t level)
+{
+    if ((perf_fch_ctx.applied != NULL) &&
+        (perf_fch_ctx.applied[domain_idx].level != level)) {
+        perf_fch_ctx.applied[domain_idx].level = 0;
+    }
+}
 #endif
 
 #ifdef BUILD_HAS_MOD_TRANSPORT_FC
@@ -112,6 +157,9 @@ void perf_fch_set_fch_get_level(uint32_t domain_idx, uint32_t level)
     const struct fast_channel_ctx *fch_ctx;
     uint32_t *get_level;
     struct mod_scmi_perf_ctx *perf_ctx = perf_fch_ctx.perf_ctx;
+#ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+    perf_fch_level_updated(domain_idx, level);
+#endif
     domain_ctx = &perf_ctx->domain_ctx_table[domain_idx];
     if (perf_fch_ctx.supports_fast_channel) {
         fch_ctx = &domain_ctx->fch_ctx[MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_GET];
@@ -140,6 +188,7 @@ static struct fast_channel_ctx *get_fch_ctx(
 }
 
 static void fch_context_init(
+    unsigned int domain_idx,
     const struct scmi_perf_fch_config *fch_config,
     struct fast_channel_ctx *fch_ctx)
 {
@@ -160,8 +209,14 @@ static void fch_context_init(
             fch_config->transport_id, (uintptr_t)NULL, fast_channel_callback);
         perf_fch_ctx.callback_registered = true;
     } else if (interrupt_type == MOD_TRANSPORT_FCH_INTERRUPT_TYPE_HW) {
+        /*
+         * Doorbell fast channels identify their domain so that only that
+         * domain is processed.
+         */
         fch_ctx->transport_fch_api->transport_fch_register_callback(
-            fch_config->transport_id, (uintptr_t)NULL, fast_channel_callback);
+            fch_config->transport_id,
+            (uintptr_t)(domain_idx + 1U),
+            fast_channel_callback);
     }
 }
 
@@ -193,6 +248,10 @@ void perf_fch_set_fch_get_level(uint32_t domain_idx, uint32_t level)
     const struct mod_scmi_perf_domain_config *domain;
     uint32_t *get_level;
 
+#ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+    perf_fch_level_updated(domain_idx, level);
+#endif
+
     domain = &(*perf_ctx->config->domains)[domain_idx];
 
     if (domain->fast_channels_addr_scp != NULL) {
@@ -212,14 +271,34 @@ static inline void decrement_pending_req_count(void)
     }
 }
 
-static inline void log_and_increment_pending_req_count(void)
+#ifndef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+static inline unsigned int dirty_domains_word_count(void)
+{
+    return (unsigned int)(
+        (perf_fch_ctx.perf_ctx->domain_count + FCH_DIRTY_WORD_BITS - 1) /
+        FCH_DIRTY_WORD_BITS);
+}
+
+static inline void mark_domain_dirty(unsigned int domain_idx)
 {
-    if (perf_fch_ctx.pending_req_count > 0) {
-        FWK_LOG_INFO("[SCMI-PERF] Multiple FC events pending");
-    }
+    perf_fch_ctx.dirty_domains[domain_idx / FCH_DIRTY_WORD_BITS] |=
+        (uint32_t)1 << (domain_idx % FCH_DIRTY_WORD_BITS);
+}
 
-    perf_fch_ctx.pending_req_count++;
+/* Read and clear a word of the dirty domains bitmap */
+static uint32_t take_dirty_domains(unsigned int word_idx)
+{
+    unsigned int flags;
+    uint32_t dirty;
+
+    flags = fwk_interrupt_global_disable();
+    dirty = perf_fch_ctx.dirty_domains[word_idx];
+    perf_fch_ctx.dirty_domains[word_idx] = 0;
+    fwk_interrupt_global_enable(flags);
+
+    return dirty;
 }
+#endif
 
 /*
  * SCMI Performance helpers
@@ -495,6 +574,20 @@ static void fast_channel_callback(uintptr_t param)
 {
     int status;
 
+#ifndef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+    if (param == 0) {
+        /* Polling tick, any domain may have changed */
+        perf_fch_ctx.full_scan = true;
+    } else {
+        mark_domain_dirty((unsigned int)(param - 1));
+    }
+#endif
+
+    if (perf_fch_ctx.pending_req_count > 0) {
+        /* The pending event will also process this request */
+        return;
+    }
+
     struct fwk_event_light event = (struct fwk_event_light){
         .id = FWK_ID_EVENT(
             FWK_MODULE_IDX_SCMI_PERF,
@@ -509,7 +602,7 @@ static void fast_channel_callback(uintptr_t param)
         return;
     }
 
-    log_and_increment_pending_req_count();
+    perf_fch_ctx.pending_req_count++;
 }
 
 static inline void load_tlimits(
@@ -536,10 +629,25 @@ static inline void load_tlevel(
 }
 
 #ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+/*
+ * The levels last applied could not be forwarded. Forget them so that they are
+ * forwarded again on the next request.
+ */
+static void perf_fch_forget_applied_levels(void)
+{
+    unsigned int i;
+
+    for (i = 0; i < perf_fch_ctx.perf_ctx->domain_count; i++) {
+        perf_fch_ctx.applied[i].level = 0;
+    }
+}
+
 static void perf_fch_process_plugins_handler(void)
 {
     struct mod_scmi_perf_fast_channel_limit *set_limit;
     struct scmi_perf_domain_ctx *domain_ctx;
+    struct mod_scmi_perf_level_limits limits;
+    struct perf_fch_applied *applied;
     uint32_t *set_level;
     uint32_t tlevel, tmax, tmin;
     unsigned int i;
@@ -548,6 +656,16 @@ static void perf_fch_process_plugins_handler(void)
     struct mod_scmi_perf_ctx *perf_ctx = perf_fch_ctx.perf_ctx;
     struct fc_perf_update update;
 
+    /*
+     * Requests signalled up to this point are processed below, any later
+     * request raises a new event.
+     */
+    decrement_pending_req_count();
+
+    /*
+     * The plugins are updated with the values of all the domains, since they
+     * may act on other state than the fast channels.
+     */
     for (i = 0; i < perf_ctx->domain_count; i++) {
         if (perf_fch_domain_has_fastchannels(i)) {
             set_limit = get_fc_set_limit_addr(i);
@@ -590,78 +708,146 @@ static void perf_fch_process_plugins_handler(void)
             perf_plugins_handler_get(i, &update);
 
             tlevel = update.level;
-            tmax = update.adj_max_limit;
-            tmin = update.adj_min_limit;
+            limits = (struct mod_scmi_perf_level_limits){
+                .minimum = update.adj_min_limit,
+                .maximum = update.adj_max_limit,
+            };
 
             perf_eval_performance(
-                FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI_PERF, i),
-                &((struct mod_scmi_perf_level_limits){
-                    .minimum = tmin,
-                    .maximum = tmax,
-                }),
-                &tlevel);
-
-            status = perf_fch_ctx.perf_ctx->dvfs_api->set_level(
-                get_dependency_id(i), 0, tlevel);
+                FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI_PERF, i), &limits, &tlevel);
+
+            /*
+             * Only forward the domains whose evaluated performance differs
+             * from the one last applied.
+             */
+            applied = &perf_fch_ctx.applied[i];
+            if ((tlevel == applied->level) &&
+                (limits.maximum == applied->limits.maximum) &&
+                (limits.minimum == applied->limits.minimum)) {
+                continue;
+            }
+
+            status = perf_fch_ctx.api_fch_stub->perf_batch_add_level(
+                &perf_fch_ctx.batch, get_dependency_id(i), 0, tlevel);
             if (status != FWK_SUCCESS) {
                 FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
+                continue;
             }
+
+            applied->level = tlevel;
+            applied->limits = limits;
         }
     }
 
-    decrement_pending_req_count();
+    /* The levels of all the domains are committed to DVFS together */
+    status = perf_fch_ctx.api_fch_stub->perf_batch_commit(&perf_fch_ctx.batch);
+    if (status != FWK_SUCCESS) {
+        perf_fch_forget_applied_levels();
+        FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
+    }
 }
 #endif
 
 #ifndef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
-static void perf_fch_process(void)
+/*
+ * Forward the fast channel values of a domain. The values of a domain that has
+ * been signalled through its doorbell are always forwarded. Otherwise, only the
+ * values that differ from the current performance of the domain are forwarded.
+ * Without the plugins handler, a domain is its own dependency domain.
+ */
+static void perf_fch_process_domain(unsigned int i, bool signalled)
 {
     struct mod_scmi_perf_fast_channel_limit *set_limit;
     struct scmi_perf_domain_ctx *domain_ctx;
     uint32_t *set_level;
     uint32_t tlevel, tmax, tmin;
-    unsigned int i;
     int status;
 
+    set_limit = get_fc_set_limit_addr(i);
+    set_level = get_fc_set_level_addr(i);
+
+    domain_ctx = &perf_fch_ctx.perf_ctx->domain_ctx_table[i];
+
+    load_tlimits(set_limit, &tmax, &tmin, domain_ctx);
+
+    load_tlevel(set_level, &tlevel, domain_ctx);
+
+    if ((set_level != NULL) && (tlevel > 0) &&
+        (signalled || (tlevel != domain_ctx->curr_level))) {
+        status = perf_fch_ctx.api_fch_stub->perf_batch_set_level(
+            &perf_fch_ctx.batch, get_dependency_id(i), 0, tlevel);
+        if (status != FWK_SUCCESS) {
+            FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
+        }
+    }
+    if (set_limit != NULL) {
+        if ((tmax == 0) && (tmin == 0)) {
+            return;
+        }
+        if (!signalled && (tmax == domain_ctx->level_limits.maximum) &&
+            (tmin == domain_ctx->level_limits.minimum)) {
+            return;
+        }
+        status = perf_fch_ctx.api_fch_stub->perf_set_limits(
+            get_dependency_id(i),
+            0,
+            &((struct mod_scmi_perf_level_limits){
+                .minimum = tmin,
+                .maximum = tmax,
+            }));
+        if (status != FWK_SUCCESS) {
+            FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
+        }
+    }
+}
+
+static void perf_fch_process(void)
+{
     struct mod_scmi_perf_ctx *perf_ctx = perf_fch_ctx.perf_ctx;
+    unsigned int word_idx, bit, i;
+    unsigned int flags;
+    uint32_t signalled, dirty;
+    bool full_scan;
+    int status;
 
-    for (i = 0; i < perf_ctx->domain_count; i++) {
-        if (perf_fch_domain_has_fastchannels(i)) {
-            set_limit = get_fc_set_limit_addr(i);
-            set_level = get_fc_set_level_addr(i);
+    /*
+     * Requests signalled up to this point are processed below, any later
+     * request raises a new event.
+     */
+    decrement_pending_req_count();
 
-            domain_ctx = &perf_ctx->domain_ctx_table[i];
+    flags = fwk_interrupt_global_disable();
+    full_scan = perf_fch_ctx.full_scan;
+    perf_fch_ctx.full_scan = false;
+    fwk_interrupt_global_enable(flags);
 
-            load_tlimits(set_limit, &tmax, &tmin, domain_ctx);
+    for (word_idx = 0; word_idx < dirty_domains_word_count(); word_idx++) {
+        signalled = take_dirty_domains(word_idx);
+        dirty = full_scan ? UINT32_MAX : signalled;
 
-            load_tlevel(set_level, &tlevel, domain_ctx);
+        while (dirty != 0) {
+            bit = (unsigned int)__builtin_ctz(dirty);
+            dirty &= dirty - 1;
 
-            if (set_level != NULL && tlevel > 0) {
-                status = perf_fch_ctx.api_fch_stub->perf_set_level(
-                    get_dependency_id(i), 0, tlevel);
-                if (status != FWK_SUCCESS) {
-                    FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
-                }
+            i = (word_idx * FCH_DIRTY_WORD_BITS) + bit;
+            if (i >= perf_ctx->domain_count) {
+                break;
             }
-            if (set_limit != NULL) {
-                if ((tmax == 0) && (tmin == 0)) {
-                    continue;
-                }
-                status = perf_fch_ctx.api_fch_stub->perf_set_limits(
-                    get_dependency_id(i),
-                    0,
-                    &((struct mod_scmi_perf_level_limits){
-                        .minimum = tmin,
-                        .maximum = tmax,
-                    }));
-                if (status != FWK_SUCCESS) {
-                    FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
-                }
+
+            if (perf_fch_domain_has_fastchannels(i)) {
+                perf_fch_process_domain(
+                    i, (signalled & ((uint32_t)1 << bit)) != 0);
             }
         }
     }
 
-    decrement_pending_req_count();
+    /* The levels of all the domains are committed to DVFS together */
+    status = perf_fch_ctx.api_fch_stub->perf_batch_commit(&perf_fch_ctx.batch);
+    if (status != FWK_SUCCESS) {
+        /* Check all the domains again on the next request */
+        perf_fch_ctx.full_scan = true;
+        FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
+    }
 }
 #endif
 
@@ -678,6 +864,17 @@ int perf_fch_init(
     perf_fch_ctx.perf_ctx = mod_ctx;
     perf_fch_ctx.api_fch_stub = api;
 
+    perf_fch_ctx.batch.requests = fwk_mm_calloc(
+        mod_ctx->domain_count, sizeof(perf_fch_ctx.batch.requests[0]));
+    perf_fch_ctx.batch.capacity = mod_ctx->domain_count;
+#ifndef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+    perf_fch_ctx.dirty_domains = fwk_mm_calloc(
+        dirty_domains_word_count(), sizeof(perf_fch_ctx.dirty_domains[0]));
+#else
+    perf_fch_ctx.applied = fwk_mm_calloc(
+        mod_ctx->domain_count, sizeof(perf_fch_ctx.applied[0]));
+#endif
+
 #ifdef BUILD_HAS_MOD_TRANSPORT_FC
     const struct mod_scmi_perf_config *config;
     config = perf_fch_ctx.perf_ctx->config;
@@ -746,7 +943,7 @@ static void *get_fch_local_address(
     fch_config = get_fch_config(domain_idx, fch_idx);
     fch_ctx = get_fch_ctx(domain_idx, fch_idx);
 
-    fch_context_init(fch_config, fch_ctx);
+    fch_context_init(domain_idx, fch_config, fch_ctx);
 
     return (void *)fch_ctx->fch_address.local_view_address;
 #else
@@ -527,8 +527,16 @@ void utest_perf_fch_init_success(void)
     struct mod_scmi_perf_config config = {
         .fast_channels_rate_limit = SCMI_PERF_FC_MIN_RATE_LIMIT / 2,
     };
+    struct mod_dvfs_level_request requests[SCMI_PERF_ELEMENT_IDX_COUNT];
+    uint32_t dirty_domains[1];
+
     perf_fch_ctx.perf_ctx->config = &config;
 
+    fwk_mm_calloc_ExpectAndReturn(
+        scmi_perf_ctx.domain_count, sizeof(requests[0]), requests);
+    fwk_mm_calloc_ExpectAndReturn(
+        FWK_ARRAY_SIZE(dirty_domains), sizeof(dirty_domains[0]), dirty_domains);
+
     status = perf_fch_init(
         fwk_module_id_scmi_perf, element_count, data, &scmi_perf_ctx, &api);
     TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
@@ -538,6 +546,219 @@ void utest_perf_fch_init_success(void)
         SCMI_PERF_FC_MIN_RATE_LIMIT, perf_fch_ctx.fast_channels_rate_limit);
 }
 
+static unsigned int fch_set_level_count;
+static unsigned int fch_set_limits_count;
+static unsigned int fch_batch_commit_count;
+
+static int fch_perf_batch_set_level(
+    struct perf_level_batch *batch,
+    fwk_id_t domain_id,
+    unsigned int agent_id,
+    uint32_t perf_level)
+{
+    fch_set_level_count++;
+    batch->count++;
+
+    return FWK_SUCCESS;
+}
+
+static int fch_perf_batch_commit(struct perf_level_batch *batch)
+{
+    if (batch->count > 0) {
+        fch_batch_commit_count++;
+    }
+    batch->count = 0;
+
+    return FWK_SUCCESS;
+}
+
+static int fch_perf_set_limits(
+    fwk_id_t domain_id,
+    unsigned int agent_id,
+    const struct mod_scmi_perf_level_limits *limits)
+{
+    fch_set_limits_count++;
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Test that on a polling tick the fast channels of a domain are only forwarded
+ * when they differ from the current performance of the domain, and that the
+ * fast channels of a domain signalled through its doorbell are always
+ * forwarded.
+ */
+void utest_perf_fch_process_unchanged_domains_skipped(void)
+{
+    uint32_t set_level = 0;
+    struct mod_scmi_perf_fast_channel_limit set_limit = { 0 };
+    struct scmi_perf_domain_ctx domain_ctx[SCMI_PERF_ELEMENT_IDX_COUNT] = {
+        0
+    };
+    uint32_t dirty_domains[1] = { 0 };
+    struct mod_scmi_perf_private_api_perf_stub api = {
+        .perf_set_limits = fch_perf_set_limits,
+        .perf_batch_set_level = fch_perf_batch_set_level,
+        .perf_batch_commit = fch_perf_batch_commit,
+    };
+#ifdef BUILD_HAS_MOD_TRANSPORT_FC
+    domain_ctx[0]
+        .fch_ctx[MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET]
+        .fch_address.local_view_address = (uintptr_t)&set_level;
+    domain_ctx[0]
+        .fch_ctx[MOD_SCMI_PERF_FAST_CHANNEL_LIMIT_SET]
+        .fch_address.local_view_address = (uintptr_t)&set_limit;
+#else
+    uint64_t fch_addr[MOD_SCMI_PERF_FAST_CHANNEL_COUNT] = {
+        [MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET] = (uintptr_t)&set_level,
+        [MOD_SCMI_PERF_FAST_CHANNEL_LIMIT_SET] = (uintptr_t)&set_limit,
+    };
+    struct mod_scmi_perf_domain_config fch_domains[] = {
+        [SCMI_PERF_ELEMENT_IDX_0] = {
+            .fast_channels_addr_scp = fch_addr,
+        },
+        [SCMI_PERF_ELEMENT_IDX_1] = { 0 },
+        [SCMI_PERF_ELEMENT_IDX_2] = { 0 },
+    };
+    struct mod_scmi_perf_config config = {
+        .domains = &fch_domains,
+        .perf_doms_count = SCMI_PERF_ELEMENT_IDX_COUNT,
+    };
+
+    scmi_perf_ctx.config = &config;
+#endif
+    scmi_perf_ctx.domain_ctx_table = domain_ctx;
+    perf_fch_ctx.api_fch_stub = &api;
+    perf_fch_ctx.dirty_domains = dirty_domains;
+
+    fch_set_level_count = 0;
+    fch_set_limits_count = 0;
+    fch_batch_commit_count = 0;
+
+    /* A new level is forwarded when polled */
+    set_level = test_dvfs_config.opps[2].level;
+    perf_fch_ctx.full_scan = true;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(1, fch_set_level_count);
+    TEST_ASSERT_EQUAL(1, fch_batch_commit_count);
+    TEST_ASSERT_EQUAL(0, fch_set_limits_count);
+    TEST_ASSERT_FALSE(perf_fch_ctx.full_scan);
+
+    /* The level is forwarded again until the domain has reached it */
+    perf_fch_ctx.full_scan = true;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(2, fch_set_level_count);
+
+    domain_ctx[0].curr_level = test_dvfs_config.opps[2].level;
+    perf_fch_ctx.full_scan = true;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(2, fch_set_level_count);
+
+    /* The level is forwarded again once changed outside the fast channels */
+    domain_ctx[0].curr_level = test_dvfs_config.opps[1].level;
+    perf_fch_ctx.full_scan = true;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(3, fch_set_level_count);
+    domain_ctx[0].curr_level = test_dvfs_config.opps[2].level;
+
+    /* New limits are forwarded when polled, until they are applied */
+    set_limit.range_min = test_dvfs_config.opps[1].level;
+    set_limit.range_max = test_dvfs_config.opps[3].level;
+    perf_fch_ctx.full_scan = true;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(3, fch_set_level_count);
+    TEST_ASSERT_EQUAL(1, fch_set_limits_count);
+
+    domain_ctx[0].level_limits.minimum = set_limit.range_min;
+    domain_ctx[0].level_limits.maximum = set_limit.range_max;
+    perf_fch_ctx.full_scan = true;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(1, fch_set_limits_count);
+
+    /* A domain signalled through its doorbell is always forwarded */
+    mark_domain_dirty(SCMI_PERF_ELEMENT_IDX_0);
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(4, fch_set_level_count);
+    TEST_ASSERT_EQUAL(2, fch_set_limits_count);
+    TEST_ASSERT_EQUAL(0, dirty_domains[0]);
+
+    /* A domain that has not been signalled is not processed */
+    set_level = test_dvfs_config.opps[3].level;
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(4, fch_set_level_count);
+
+    mark_domain_dirty(SCMI_PERF_ELEMENT_IDX_0);
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(5, fch_set_level_count);
+    TEST_ASSERT_EQUAL(3, fch_set_limits_count);
+    TEST_ASSERT_EQUAL(5, fch_batch_commit_count);
+}
+
+static unsigned int dvfs_set_levels_count;
+static size_t dvfs_set_levels_request_count;
+
+static int fch_dvfs_set_levels(
+    const struct mod_dvfs_level_request *requests,
+    size_t count)
+{
+    dvfs_set_levels_count++;
+    dvfs_set_levels_request_count = count;
+
+    return FWK_SUCCESS;
+}
+
+void utest_perf_level_batch(void)
+{
+    fwk_id_t dvfs_id[3] = {
+        FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_DVFS, 0),
+        FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_DVFS, 1),
+        FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_DVFS, 2),
+    };
+    struct mod_dvfs_level_request requests[2];
+    struct perf_level_batch batch = {
+        .requests = requests,
+        .capacity = FWK_ARRAY_SIZE(requests),
+    };
+    struct mod_dvfs_domain_api dvfs_api = {
+        .set_levels = fch_dvfs_set_levels,
+    };
+    int status;
+
+    scmi_perf_ctx.dvfs_api = &dvfs_api;
+    dvfs_set_levels_count = 0;
+
+    /* An empty batch is not sent */
+    status = perf_level_batch_commit(&batch);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, dvfs_set_levels_count);
+
+    status = perf_level_batch_add(&batch, dvfs_id[0], 0, 100);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    fwk_id_is_equal_ExpectAndReturn(dvfs_id[0], dvfs_id[1], false);
+    status = perf_level_batch_add(&batch, dvfs_id[1], 0, 200);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* A later request for a domain replaces the earlier one */
+    fwk_id_is_equal_ExpectAndReturn(dvfs_id[0], dvfs_id[0], true);
+    status = perf_level_batch_add(&batch, dvfs_id[0], 0, 300);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, batch.count);
+    TEST_ASSERT_EQUAL(300, requests[0].level);
+
+    /* A full batch does not accept other domains */
+    fwk_id_is_equal_ExpectAndReturn(dvfs_id[0], dvfs_id[2], false);
+    fwk_id_is_equal_ExpectAndReturn(dvfs_id[1], dvfs_id[2], false);
+    status = perf_level_batch_add(&batch, dvfs_id[2], 0, 100);
+    TEST_ASSERT_EQUAL(FWK_E_NOMEM, status);
+
+    status = perf_level_batch_commit(&batch);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, dvfs_set_levels_count);
+    TEST_ASSERT_EQUAL(2, dvfs_set_levels_request_count);
+    TEST_ASSERT_EQUAL(0, batch.count);
+}
+
 int scmi_perf_fch_test_main(void)
 {
     UNITY_BEGIN();
@@ -553,6 +774,8 @@ int scmi_perf_fch_test_main(void)
     RUN_TEST(utest_scmi_perf_describe_fast_channels_invalid_message_id);
 
     RUN_TEST(utest_perf_fch_init_success);
+    RUN_TEST(utest_perf_fch_process_unchanged_domains_skipped);
+    RUN_TEST(utest_perf_level_batch);
 
     return UNITY_END();
 }
@@ -589,9 +589,22 @@ static int scmi_pd_power_state_set_handler(
     if (!is_sync) {
         /*
          * For a power domain that is managed asynchronously, schedule the
-         * request and respond to the agent immediately.
+         * request and respond to the agent immediately. The request is
+         * submitted as a batch so that the requests received before the
+         * power domain module processes it are merged into a single request,
+         * sharing the processing of the common ancestors. Fall back to a
+         * standalone request if the pending batch cannot be merged with.
          */
-        status = scmi_pd_ctx.pd_api->set_state(pd_id, false, power_state);
+        struct mod_pd_set_state_request request = {
+            .pd_id = pd_id,
+            .state = power_state,
+        };
+
+        status = scmi_pd_ctx.pd_api->set_state_batch(&request, 1, false);
+        if (status == FWK_E_BUSY) {
+            status = scmi_pd_ctx.pd_api->set_state(pd_id, false, power_state);
+        }
+
         if (status == FWK_SUCCESS) {
             return_values.status = (int32_t)SCMI_SUCCESS;
             return scmi_pd_ctx.scmi_api->respond(
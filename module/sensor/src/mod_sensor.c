@@ -748,6 +748,7 @@ static int sensor_process_event(const struct fwk_event *event,
 const struct fwk_module module_sensor = {
     .api_count = (unsigned int)MOD_SENSOR_API_IDX_COUNT,
     .event_count = (unsigned int)SENSOR_EVENT_IDX_COUNT,
+    .event_priority = FWK_EVENT_PRIORITY_LOW,
     .type = FWK_MODULE_TYPE_HAL,
     .init = sensor_init,
     .element_init = sensor_dev_init,
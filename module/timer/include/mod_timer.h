@@ -69,6 +69,18 @@ enum mod_timer_alarm_type {
     /*! Alarm that will trigger at regular intervals */
     MOD_TIMER_ALARM_TYPE_PERIODIC,
 
+    /*!
+     * Alarm that will trigger once, with its callback called in thread
+     * context
+     */
+    MOD_TIMER_ALARM_TYPE_ONCE_DEFERRED,
+
+    /*!
+     * Alarm that will trigger at regular intervals, with its callback called
+     * in thread context
+     */
+    MOD_TIMER_ALARM_TYPE_PERIODIC_DEFERRED,
+
     /*! Number of alarm types */
     MOD_TIMER_ALARM_TYPE_COUNT,
 };
@@ -283,14 +295,19 @@ struct mod_timer_alarm_api {
      *     case, internally, the alarm will be stopped then started again with
      *     the new configuration.
      *
-     * \warning \p callback will be called from within an interrupt service
-     *      routine.
+     *     If the alarm is deferred, the timer interrupt only queues an event
+     *     to the timer module and \p callback is called when the event is
+     *     processed. The triggers of a periodic deferred alarm that occur
+     *     while its callback is still pending are merged into that callback.
+     *     A pending callback is dropped if the alarm is stopped or restarted.
+     *
+     * \warning Unless the alarm is deferred, \p callback will be called from
+     *      within an interrupt service routine.
      *
      * \param alarm_id Sub-element identifier of the alarm.
      * \param milliseconds The time delay, given in milliseconds, until the
      *     alarm should trigger.
-     * \param type ::MOD_TIMER_ALARM_TYPE_ONCE or
-     *     ::MOD_TIMER_ALARM_TYPE_PERIODIC.
+     * \param type Type of the alarm, see ::mod_timer_alarm_type.
      * \param callback Pointer to the callback function.
      * \param param Parameter given to the callback function when called.
      *
@@ -331,6 +348,52 @@ struct mod_timer_alarm_api {
      * \return One of the other specific error codes described by the framework.
      */
     int (*stop)(fwk_id_t alarm_id);
+
+    /*!
+     * \brief Start an alarm that may trigger late by up to a given slack.
+     *
+     * \details Same as ::mod_timer_alarm_api::start, except that the alarm
+     *     triggers at any time between \p milliseconds and \p milliseconds +
+     *     \p slack_milliseconds after being started. When the timer interrupt
+     *     is taken, the alarms that can already trigger are handled within
+     *     the same interrupt, in the order of their latest trigger times,
+     *     until one that cannot trigger yet is found. This reduces the number
+     *     of interrupts taken by periodic alarms that do not require exact
+     *     timings. An alarm left behind one that cannot trigger yet is handled
+     *     by a later interrupt, still within its trigger window.
+     *
+     *     If the alarm is periodic, the slack applies to every period and
+     *     does not accumulate: each period is measured from the earliest
+     *     trigger time of the previous period.
+     *
+     * \warning Unless the alarm is deferred, \p callback will be called from
+     *      within an interrupt service routine.
+     *
+     * \param alarm_id Sub-element identifier of the alarm.
+     * \param milliseconds The time delay, given in milliseconds, until the
+     *     alarm may trigger.
+     * \param slack_milliseconds The time, given in milliseconds, by which the
+     *     alarm trigger may be delayed.
+     * \param type Type of the alarm, see ::mod_timer_alarm_type.
+     * \param callback Pointer to the callback function.
+     * \param param Parameter given to the callback function when called.
+     *
+     * \pre \p alarm_id must be a valid sub-element alarm identifier that has
+     *     previously been bound to.
+     *
+     * \retval ::FWK_E_ACCESS The function was called from an interrupt handler
+     *      OR could not attain call context.
+     * \retval ::FWK_E_DEVICE The timer driver failed.
+     * \retval ::FWK_SUCCESS The alarm was started.
+     * \return One of the other specific error codes described by the framework.
+     */
+    int (*start_with_slack)(
+        fwk_id_t alarm_id,
+        unsigned int milliseconds,
+        unsigned int slack_milliseconds,
+        enum mod_timer_alarm_type type,
+        void (*callback)(uintptr_t param),
+        uintptr_t param);
 };
 
 /*!
@@ -11,10 +11,10 @@
 #include <mod_timer.h>
 
 #include <fwk_assert.h>
-#include <fwk_dlist.h>
+#include <fwk_core.h>
+#include <fwk_event.h>
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
-#include <fwk_list.h>
 #include <fwk_log.h>
 #include <fwk_macros.h>
 #include <fwk_mm.h>
@@ -26,6 +26,18 @@
 #include <stdint.h>
 #include <string.h>
 
+/* Timer module events */
+enum timer_event_idx {
+    /* Deferred alarm callback */
+    TIMER_EVENT_IDX_DEFERRED_ALARM,
+
+    /* Number of events */
+    TIMER_EVENT_IDX_COUNT,
+};
+
+static const fwk_id_t timer_event_id_deferred_alarm =
+    FWK_ID_EVENT_INIT(FWK_MODULE_IDX_TIMER, TIMER_EVENT_IDX_DEFERRED_ALARM);
+
 /* Timer device context (element) */
 struct timer_dev_ctx {
     /* Pointer to the device's configuration */
@@ -36,30 +48,42 @@ struct timer_dev_ctx {
     fwk_id_t driver_dev_id;
     /* Storage for all alarms */
     struct alarm_sub_element_ctx *alarm_pool;
-    /* Queue of active alarms */
-    struct fwk_dlist alarms_active;
+    /* Queue of active alarms, a binary min-heap ordered by deadline */
+    struct alarm_sub_element_ctx **alarms_active;
+    /* Number of alarms in the active queue */
+    unsigned int active_count;
 };
 
 /* Alarm item context (sub-element) */
 struct alarm_sub_element_ctx {
-    /* List node */
-    struct fwk_dlist_node node;
+    /* Position of this alarm in the active queue */
+    unsigned int queue_idx;
     /* Time between starting this alarm and it triggering */
     uint32_t microseconds;
-    /* Timestamp of the time this alarm will trigger */
+    /* Timestamp of the earliest time this alarm can trigger */
     uint64_t timestamp;
+    /* Number of ticks the trigger of this alarm can be delayed by */
+    uint64_t slack;
+    /* Timestamp of the latest time this alarm can trigger */
+    uint64_t deadline;
     /* Pointer to the callback function */
     void (*callback)(uintptr_t param);
     /* Parameter of the callback function */
     uintptr_t param;
     /* Flag indicating if this alarm if periodic */
     bool periodic;
+    /* Flag indicating if the callback is called in thread context */
+    bool deferred;
+    /* Flag indicating if a deferred callback is waiting to be processed */
+    bool callback_pending;
     /* Flag indicating if this alarm is in the active queue */
     bool activated;
     /* Flag indicating if this alarm has been bound to */
     bool bound;
     /* Flag indicating if this alarm is started */
     bool started;
+    /* Next periodic alarm to re-arm at the end of the timer interrupt */
+    struct alarm_sub_element_ctx *rearm_next;
 };
 
 /* Table of timer device context structures */
@@ -148,6 +172,18 @@ static int _remaining(
     return FWK_SUCCESS;
 }
 
+static struct alarm_sub_element_ctx *_get_next_alarm(
+    const struct timer_dev_ctx *ctx)
+{
+    fwk_assert(ctx != NULL);
+
+    if (ctx->active_count == 0) {
+        return NULL;
+    }
+
+    return ctx->alarms_active[0];
+}
+
 static void _configure_timer_with_next_alarm(struct timer_dev_ctx *ctx)
 {
     int status;
@@ -155,12 +191,11 @@ static void _configure_timer_with_next_alarm(struct timer_dev_ctx *ctx)
 
     fwk_assert(ctx != NULL);
 
-    alarm_head =
-        (struct alarm_sub_element_ctx *)fwk_list_head(&ctx->alarms_active);
+    alarm_head = _get_next_alarm(ctx);
     if (alarm_head != NULL) {
         /* Configure timer device */
         status =
-            ctx->driver->set_timer(ctx->driver_dev_id, alarm_head->timestamp);
+            ctx->driver->set_timer(ctx->driver_dev_id, alarm_head->deadline);
         if (status != FWK_SUCCESS) {
             FWK_LOG_DEBUG("[Timer] %s @%d", __func__, __LINE__);
         }
@@ -172,36 +207,118 @@ static void _configure_timer_with_next_alarm(struct timer_dev_ctx *ctx)
     }
 }
 
-static void _insert_alarm_ctx_into_active_queue(
+static void _place_alarm_in_active_queue(
     struct timer_dev_ctx *ctx,
-    struct alarm_sub_element_ctx *alarm_new)
+    struct alarm_sub_element_ctx *alarm,
+    unsigned int queue_idx)
 {
-    struct fwk_dlist_node *alarm_node;
-    struct alarm_sub_element_ctx *alarm;
+    ctx->alarms_active[queue_idx] = alarm;
+    alarm->queue_idx = queue_idx;
+}
 
-    fwk_assert(ctx != NULL);
-    fwk_assert(alarm_new != NULL);
+/*
+ * Move an alarm towards the head of the active queue until its parent does not
+ * trigger after it.
+ */
+static void _sift_alarm_up(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    unsigned int queue_idx = alarm->queue_idx;
+    unsigned int parent_idx;
+    struct alarm_sub_element_ctx *parent;
+
+    while (queue_idx > 0) {
+        parent_idx = (queue_idx - 1) / 2;
+        parent = ctx->alarms_active[parent_idx];
+        if (parent->deadline <= alarm->deadline) {
+            break;
+        }
 
-    /*
-     * Search though the active queue to find the correct place to insert the
-     * new alarm item
-     */
-    alarm_node = fwk_list_head(&ctx->alarms_active);
-    alarm = FWK_LIST_GET(alarm_node, struct alarm_sub_element_ctx, node);
+        _place_alarm_in_active_queue(ctx, parent, queue_idx);
+        queue_idx = parent_idx;
+    }
+
+    _place_alarm_in_active_queue(ctx, alarm, queue_idx);
+}
+
+/*
+ * Move an alarm away from the head of the active queue until none of its
+ * children triggers before it.
+ */
+static void _sift_alarm_down(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    unsigned int queue_idx = alarm->queue_idx;
+    unsigned int child_idx;
+    struct alarm_sub_element_ctx *child;
+
+    while (true) {
+        child_idx = (2 * queue_idx) + 1;
+        if (child_idx >= ctx->active_count) {
+            break;
+        }
+
+        /* Select the child that triggers first */
+        if (((child_idx + 1) < ctx->active_count) &&
+            (ctx->alarms_active[child_idx + 1]->deadline <
+             ctx->alarms_active[child_idx]->deadline)) {
+            child_idx++;
+        }
 
-    while ((alarm_node != NULL) && (alarm_new->timestamp > alarm->timestamp)) {
-        alarm_node = fwk_list_next(&ctx->alarms_active, alarm_node);
-        alarm = FWK_LIST_GET(alarm_node, struct alarm_sub_element_ctx, node);
+        child = ctx->alarms_active[child_idx];
+        if (alarm->deadline <= child->deadline) {
+            break;
+        }
+
+        _place_alarm_in_active_queue(ctx, child, queue_idx);
+        queue_idx = child_idx;
     }
 
-    /* Insert alarm_new just BEFORE the alarm that was found */
-    fwk_list_insert(&ctx->alarms_active,
-                    &(alarm_new->node),
-                    alarm_node);
+    _place_alarm_in_active_queue(ctx, alarm, queue_idx);
+}
+
+static void _insert_alarm_ctx_into_active_queue(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm_new)
+{
+    fwk_assert(ctx != NULL);
+    fwk_assert(alarm_new != NULL);
+    fwk_assert(!alarm_new->activated);
+
+    /* Append the new alarm and restore the ordering of the queue */
+    _place_alarm_in_active_queue(ctx, alarm_new, ctx->active_count++);
+    _sift_alarm_up(ctx, alarm_new);
 
     alarm_new->activated = true;
 }
 
+static void _remove_alarm_ctx_from_active_queue(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    struct alarm_sub_element_ctx *alarm_last;
+
+    fwk_assert(ctx != NULL);
+    fwk_assert(alarm != NULL);
+    fwk_assert(alarm->activated);
+
+    alarm->activated = false;
+
+    /* Fill the hole left by the alarm with the last alarm of the queue */
+    alarm_last = ctx->alarms_active[--ctx->active_count];
+    if (alarm_last == alarm) {
+        return;
+    }
+
+    _place_alarm_in_active_queue(ctx, alarm_last, alarm->queue_idx);
+    if (alarm_last->deadline < alarm->deadline) {
+        _sift_alarm_up(ctx, alarm_last);
+    } else {
+        _sift_alarm_down(ctx, alarm_last);
+    }
+}
 
 /*
  * Functions fulfilling the timer API
@@ -333,7 +450,7 @@ static int get_next_alarm_remaining(fwk_id_t dev_id,
     int status, exit_status;
     const struct timer_dev_ctx *ctx;
     const struct alarm_sub_element_ctx *alarm_ctx;
-    const struct fwk_dlist_node *alarm_ctx_node;
+
     if (has_alarm == NULL) {
         return FWK_E_PARAM;
     }
@@ -353,14 +470,11 @@ static int get_next_alarm_remaining(fwk_id_t dev_id,
         return FWK_E_DEVICE;
     }
 
-    *has_alarm = !fwk_list_is_empty(&ctx->alarms_active);
+    alarm_ctx = _get_next_alarm(ctx);
+    *has_alarm = (alarm_ctx != NULL);
 
     if (*has_alarm) {
-        alarm_ctx_node = fwk_list_head(&ctx->alarms_active);
-        alarm_ctx =
-            FWK_LIST_GET(alarm_ctx_node, struct alarm_sub_element_ctx, node);
-
-        exit_status = _remaining(ctx, alarm_ctx->timestamp, remaining_ticks);
+        exit_status = _remaining(ctx, alarm_ctx->deadline, remaining_ticks);
     } else {
         exit_status = FWK_E_PARAM;
     }
@@ -438,6 +552,7 @@ static int alarm_stop(fwk_id_t alarm_id)
     }
 
     alarm->started = false;
+    alarm->callback_pending = false;
 
     if (!alarm->activated) {
         return FWK_SUCCESS;
@@ -457,19 +572,20 @@ static int alarm_stop(fwk_id_t alarm_id)
         return status;
     }
 
-    fwk_list_remove(&ctx->alarms_active, (struct fwk_dlist_node *)alarm);
-    alarm->activated = false;
+    _remove_alarm_ctx_from_active_queue(ctx, alarm);
 
     _configure_timer_with_next_alarm(ctx);
 
     return FWK_SUCCESS;
 }
 
-static int alarm_start(fwk_id_t alarm_id,
-                       unsigned int milliseconds,
-                       enum mod_timer_alarm_type type,
-                       void (*callback)(uintptr_t param),
-                       uintptr_t param)
+static int alarm_start_with_slack(
+    fwk_id_t alarm_id,
+    unsigned int milliseconds,
+    unsigned int slack_milliseconds,
+    enum mod_timer_alarm_type type,
+    void (*callback)(uintptr_t param),
+    uintptr_t param)
 {
     int status;
     struct timer_dev_ctx *ctx;
@@ -501,12 +617,15 @@ static int alarm_start(fwk_id_t alarm_id,
 
     /* Cap to ensure value will not overflow when stored as microseconds */
     milliseconds = FWK_MIN(milliseconds, UINT32_MAX / 1000);
+    slack_milliseconds = FWK_MIN(slack_milliseconds, UINT32_MAX / 1000);
 
     /* Populate alarm item */
     alarm->callback = callback;
     alarm->param = param;
-    alarm->periodic =
-        (type == MOD_TIMER_ALARM_TYPE_PERIODIC ? true : false);
+    alarm->periodic = ((type == MOD_TIMER_ALARM_TYPE_PERIODIC) ||
+                       (type == MOD_TIMER_ALARM_TYPE_PERIODIC_DEFERRED));
+    alarm->deferred = ((type == MOD_TIMER_ALARM_TYPE_ONCE_DEFERRED) ||
+                       (type == MOD_TIMER_ALARM_TYPE_PERIODIC_DEFERRED));
     alarm->microseconds = milliseconds * 1000;
     status = _timestamp_from_now(ctx,
                                  alarm->microseconds,
@@ -515,6 +634,13 @@ static int alarm_start(fwk_id_t alarm_id,
         return status;
     }
 
+    status = _time_to_timestamp(ctx, slack_milliseconds * 1000, &alarm->slack);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    alarm->deadline = alarm->timestamp + alarm->slack;
+
     /* Disable timer interrupts to work with the active queue */
     status = ctx->driver->disable(ctx->driver_dev_id);
     if (status != FWK_SUCCESS) {
@@ -528,17 +654,89 @@ static int alarm_start(fwk_id_t alarm_id,
     return FWK_SUCCESS;
 }
 
+static int alarm_start(fwk_id_t alarm_id,
+                       unsigned int milliseconds,
+                       enum mod_timer_alarm_type type,
+                       void (*callback)(uintptr_t param),
+                       uintptr_t param)
+{
+    return alarm_start_with_slack(
+        alarm_id, milliseconds, 0, type, callback, param);
+}
+
 static const struct mod_timer_alarm_api alarm_api = {
     .start = alarm_start,
     .stop = alarm_stop,
+    .start_with_slack = alarm_start_with_slack,
 };
 
+/*
+ * Call the callback of a triggered alarm, or queue it to be called in thread
+ * context if the alarm is deferred.
+ */
+static void _signal_alarm(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    int status;
+    struct fwk_event_light event;
+
+    if (!alarm->deferred) {
+        alarm->callback(alarm->param);
+        return;
+    }
+
+    /* A callback that is still pending also accounts for this trigger */
+    if (alarm->callback_pending) {
+        return;
+    }
+
+    event = (struct fwk_event_light){
+        .id = timer_event_id_deferred_alarm,
+        .source_id = FWK_ID_MODULE(FWK_MODULE_IDX_TIMER),
+        .target_id = FWK_ID_SUB_ELEMENT(
+            FWK_MODULE_IDX_TIMER,
+            (unsigned int)(ctx - ctx_table),
+            (unsigned int)(alarm - ctx->alarm_pool)),
+    };
+
+    status = fwk_put_event(&event);
+    if (status == FWK_SUCCESS) {
+        alarm->callback_pending = true;
+    } else {
+        FWK_LOG_ERR("[Timer] Error: Deferred alarm callback could not be "
+                    "queued.");
+    }
+}
+
+static void _rearm_periodic_alarm(
+    struct timer_dev_ctx *ctx,
+    struct alarm_sub_element_ctx *alarm)
+{
+    int status;
+    uint64_t timestamp = 0;
+
+    /* Put this alarm back into the active queue */
+    status = _time_to_timestamp(ctx, alarm->microseconds, &timestamp);
+
+    if (status == FWK_SUCCESS) {
+        alarm->timestamp += timestamp;
+        alarm->deadline = alarm->timestamp + alarm->slack;
+        _insert_alarm_ctx_into_active_queue(ctx, alarm);
+    } else {
+        FWK_LOG_ERR(
+            "[Timer] Error: Periodic alarm could not be added "
+            "back into queue.");
+    }
+}
+
 static void timer_isr(uintptr_t ctx_ptr)
 {
     int status;
     struct alarm_sub_element_ctx *alarm;
+    struct alarm_sub_element_ctx *rearm_list = NULL;
     struct timer_dev_ctx *ctx = (struct timer_dev_ctx *)ctx_ptr;
-    uint64_t timestamp = 0;
+    uint64_t counter;
 
     fwk_assert(ctx != NULL);
 
@@ -553,8 +751,7 @@ static void timer_isr(uintptr_t ctx_ptr)
         FWK_LOG_DEBUG("[Timer] %s @%d", __func__, __LINE__);
     }
 
-    alarm =
-        (struct alarm_sub_element_ctx *)fwk_list_pop_head(&ctx->alarms_active);
+    alarm = _get_next_alarm(ctx);
 
     if (alarm == NULL) {
         if (ctx->driver->overflow_handler != NULL) {
@@ -569,22 +766,44 @@ static void timer_isr(uintptr_t ctx_ptr)
         return;
     }
 
-    alarm->activated = false;
+    status = ctx->driver->get_counter(ctx->driver_dev_id, &counter);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[Timer] %s @%d", __func__, __LINE__);
+        counter = 0;
+    }
 
-    /* Execute the callback function */
-    alarm->callback(alarm->param);
+    /*
+     * Handle the alarm the timer was configured for, then the following alarms
+     * of the queue that can already trigger, so that the alarms whose slack
+     * windows overlap share a single interrupt. The queue is ordered by latest
+     * trigger time, so an alarm that can trigger but follows one that cannot
+     * is left for a later interrupt, at the latest at its deadline.
+     */
+    do {
+        _remove_alarm_ctx_from_active_queue(ctx, alarm);
 
-    if (alarm->periodic && alarm->started) {
-        /* Put this alarm back into the active queue */
-        status = _time_to_timestamp(ctx, alarm->microseconds, &timestamp);
+        _signal_alarm(ctx, alarm);
 
-        if (status == FWK_SUCCESS) {
-            alarm->timestamp += timestamp;
-            _insert_alarm_ctx_into_active_queue(ctx, alarm);
-        } else {
-            FWK_LOG_ERR(
-                "[Timer] Error: Periodic alarm could not be added "
-                "back into queue.");
+        /*
+         * Periodic alarms are re-armed once all the alarms of this interrupt
+         * have been handled, so that each one triggers at most once per
+         * interrupt, even when its period has already elapsed again.
+         */
+        if (alarm->periodic && alarm->started) {
+            alarm->rearm_next = rearm_list;
+            rearm_list = alarm;
+        }
+
+        alarm = _get_next_alarm(ctx);
+    } while ((alarm != NULL) && (alarm->timestamp <= counter));
+
+    while (rearm_list != NULL) {
+        alarm = rearm_list;
+        rearm_list = alarm->rearm_next;
+
+        /* The alarm may have been stopped by a later callback */
+        if (alarm->started) {
+            _rearm_periodic_alarm(ctx, alarm);
         }
     }
 
@@ -617,6 +836,8 @@ static int timer_device_init(fwk_id_t element_id, unsigned int alarm_count,
     if (alarm_count > 0) {
         ctx->alarm_pool =
             fwk_mm_calloc(alarm_count, sizeof(struct alarm_sub_element_ctx));
+        ctx->alarms_active =
+            fwk_mm_calloc(alarm_count, sizeof(ctx->alarms_active[0]));
     }
 
     return FWK_SUCCESS;
@@ -700,6 +921,44 @@ static int timer_process_bind_request(fwk_id_t requester_id,
     return FWK_SUCCESS;
 }
 
+static int timer_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *resp_event)
+{
+    int status;
+    struct timer_dev_ctx *ctx;
+    struct alarm_sub_element_ctx *alarm;
+    bool callback_pending;
+
+    if (!fwk_id_is_equal(event->id, timer_event_id_deferred_alarm)) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = ctx_table + fwk_id_get_element_idx(event->target_id);
+    alarm = &ctx->alarm_pool[fwk_id_get_sub_element_idx(event->target_id)];
+
+    /* Prevent possible data races with the timer interrupt */
+    status = ctx->driver->disable(ctx->driver_dev_id);
+    if (status != FWK_SUCCESS) {
+        return FWK_E_DEVICE;
+    }
+
+    /*
+     * The callback is not pending anymore if the alarm has been stopped or
+     * restarted since it triggered.
+     */
+    callback_pending = alarm->callback_pending;
+    alarm->callback_pending = false;
+
+    _configure_timer_with_next_alarm(ctx);
+
+    if (callback_pending) {
+        alarm->callback(alarm->param);
+    }
+
+    return FWK_SUCCESS;
+}
+
 static int timer_start(fwk_id_t id)
 {
     int status;
@@ -711,7 +970,7 @@ static int timer_start(fwk_id_t id)
 
     ctx = ctx_table + fwk_id_get_element_idx(id);
 
-    fwk_list_init(&ctx->alarms_active);
+    ctx->active_count = 0;
 
     status = fwk_interrupt_set_isr_param(
         ctx->config->timer_irq, timer_isr, (uintptr_t)ctx);
@@ -725,10 +984,12 @@ static int timer_start(fwk_id_t id)
 /* Module descriptor */
 const struct fwk_module module_timer = {
     .api_count = (unsigned int)MOD_TIMER_API_COUNT,
+    .event_count = (unsigned int)TIMER_EVENT_IDX_COUNT,
     .type = FWK_MODULE_TYPE_HAL,
     .init = timer_init,
     .element_init = timer_device_init,
     .bind = timer_bind,
     .process_bind_request = timer_process_bind_request,
+    .process_event = timer_process_event,
     .start = timer_start,
 };
@@ -0,0 +1,282 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Host benchmark of the alarm queue of the timer module. Reports the time
+ *     spent starting and stopping alarms, and in the timer ISR with callbacks
+ *     called from the ISR or deferred to thread context.
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_interrupt.h>
+#include <Mockfwk_module.h>
+
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_timer.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include UNIT_TEST_SRC
+
+#define FAKE_TIMER_FREQUENCY_HZ 1000000UL
+#define FAKE_TIMER_IRQ          42
+
+/* The sub-element index of an identifier limits a device to 256 alarms */
+#define FAKE_ALARM_COUNT 256
+
+#define ROUND_COUNT 64
+
+/* Work done by a callback before returning */
+#define CALLBACK_WORK 2000
+
+static uint64_t fake_counter;
+static uint64_t fake_timer_timestamp;
+
+static struct alarm_sub_element_ctx fake_alarm_pool[FAKE_ALARM_COUNT];
+static struct alarm_sub_element_ctx *fake_alarms_active[FAKE_ALARM_COUNT];
+static struct timer_dev_ctx fake_ctx;
+
+static unsigned int fired_count;
+static unsigned int deferred_event_count;
+
+static const struct mod_timer_dev_config fake_dev_config = {
+    .id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_TIMER_DRIVER, 0),
+    .timer_irq = FAKE_TIMER_IRQ,
+};
+
+static int fake_enable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int fake_disable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int fake_set_timer(fwk_id_t dev_id, uint64_t timestamp)
+{
+    fake_timer_timestamp = timestamp;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_get_counter(fwk_id_t dev_id, uint64_t *counter)
+{
+    *counter = fake_counter;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_get_frequency(fwk_id_t dev_id, uint32_t *frequency)
+{
+    *frequency = FAKE_TIMER_FREQUENCY_HZ;
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_timer_driver_api fake_driver = {
+    .enable = fake_enable,
+    .disable = fake_disable,
+    .set_timer = fake_set_timer,
+    .get_counter = fake_get_counter,
+    .get_frequency = fake_get_frequency,
+};
+
+static void fake_alarm_callback(uintptr_t param)
+{
+    fired_count++;
+}
+
+/* Callback doing some work before recording that it has been called */
+static void fake_heavy_alarm_callback(uintptr_t param)
+{
+    volatile unsigned int work;
+
+    for (work = 0; work < CALLBACK_WORK; work++) {
+        continue;
+    }
+
+    fake_alarm_callback(param);
+}
+
+static int fake_put_event_light(
+    struct fwk_event_light *event,
+    int cmock_num_calls)
+{
+    deferred_event_count++;
+
+    return FWK_SUCCESS;
+}
+
+static fwk_id_t alarm_id(unsigned int alarm_idx)
+{
+    return FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_TIMER, 0, alarm_idx);
+}
+
+static uint64_t get_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/* Advance the counter to each programmed timestamp until the queue is empty */
+static void drain_alarms(void)
+{
+    while (fake_ctx.active_count != 0) {
+        fake_counter = fake_timer_timestamp;
+        timer_isr((uintptr_t)&fake_ctx);
+    }
+}
+
+void setUp(void)
+{
+    memset(fake_alarm_pool, 0, sizeof(fake_alarm_pool));
+
+    fake_ctx.config = &fake_dev_config;
+    fake_ctx.driver = &fake_driver;
+    fake_ctx.driver_dev_id = fake_dev_config.id;
+    fake_ctx.alarm_pool = fake_alarm_pool;
+    fake_ctx.alarms_active = fake_alarms_active;
+    fake_ctx.active_count = 0;
+    ctx_table = &fake_ctx;
+
+    fake_counter = 0;
+    fake_timer_timestamp = 0;
+    fired_count = 0;
+    deferred_event_count = 0;
+
+    fwk_module_is_valid_sub_element_id_IgnoreAndReturn(true);
+    fwk_interrupt_get_current_IgnoreAndReturn(FWK_E_STATE);
+    fwk_interrupt_clear_pending_IgnoreAndReturn(FWK_SUCCESS);
+    __fwk_put_event_light_StubWithCallback(fake_put_event_light);
+}
+
+void tearDown(void)
+{
+    fwk_module_is_valid_sub_element_id_StopIgnore();
+    fwk_interrupt_get_current_StopIgnore();
+    fwk_interrupt_clear_pending_StopIgnore();
+}
+
+/*
+ * Repeatedly start every alarm of the device with a pseudo-random delay, stop
+ * a third of them and drain the queue through the timer ISR.
+ */
+void bench_alarm_queue(void)
+{
+    uint32_t seed = 0x1234567;
+    unsigned int round, alarm_idx;
+    unsigned int started_count = 0;
+    uint64_t start, start_time = 0, isr_time = 0;
+
+    for (round = 0; round < ROUND_COUNT; round++) {
+        start = get_time_ns();
+
+        for (alarm_idx = 0; alarm_idx < FAKE_ALARM_COUNT; alarm_idx++) {
+            seed = (seed * 1103515245UL) + 12345UL;
+            alarm_start(
+                alarm_id(alarm_idx),
+                (seed >> 16) % 10000,
+                MOD_TIMER_ALARM_TYPE_ONCE,
+                fake_alarm_callback,
+                alarm_idx);
+        }
+
+        for (alarm_idx = round % 3; alarm_idx < FAKE_ALARM_COUNT;
+             alarm_idx += 3) {
+            alarm_stop(alarm_id(alarm_idx));
+        }
+
+        start_time += get_time_ns() - start;
+        started_count += fake_ctx.active_count;
+
+        start = get_time_ns();
+        drain_alarms();
+        isr_time += get_time_ns() - start;
+    }
+
+    TEST_ASSERT_EQUAL(started_count, fired_count);
+
+    printf(
+        "\n    %u alarms started: start/stop %" PRIu64 " ns, "
+        "ISR %" PRIu64 " ns per alarm\n",
+        ROUND_COUNT * FAKE_ALARM_COUNT,
+        start_time / (ROUND_COUNT * FAKE_ALARM_COUNT),
+        isr_time / fired_count);
+}
+
+/* Time the ISR handling every alarm of the device started with a given type */
+static uint64_t time_heavy_alarms(enum mod_timer_alarm_type type)
+{
+    uint32_t seed = 0x7654321;
+    unsigned int alarm_idx;
+    uint64_t start;
+
+    for (alarm_idx = 0; alarm_idx < FAKE_ALARM_COUNT; alarm_idx++) {
+        seed = (seed * 1103515245UL) + 12345UL;
+        alarm_start(
+            alarm_id(alarm_idx),
+            (seed >> 16) % 10000,
+            type,
+            fake_heavy_alarm_callback,
+            alarm_idx);
+    }
+
+    start = get_time_ns();
+    drain_alarms();
+
+    return get_time_ns() - start;
+}
+
+/*
+ * Compare the time spent in the timer ISR when the callbacks are called from
+ * the ISR and when they are deferred to thread context.
+ */
+void bench_deferred_alarm_isr_time(void)
+{
+    uint64_t direct_time, deferred_time;
+
+    direct_time = time_heavy_alarms(MOD_TIMER_ALARM_TYPE_ONCE);
+    TEST_ASSERT_EQUAL(FAKE_ALARM_COUNT, fired_count);
+
+    deferred_time = time_heavy_alarms(MOD_TIMER_ALARM_TYPE_ONCE_DEFERRED);
+    TEST_ASSERT_EQUAL(FAKE_ALARM_COUNT, deferred_event_count);
+
+    printf(
+        "\n    ISR time per alarm: %" PRIu64 " ns with direct callbacks, "
+        "%" PRIu64 " ns deferred\n",
+        direct_time / FAKE_ALARM_COUNT,
+        deferred_time / FAKE_ALARM_COUNT);
+}
+
+int timer_bench_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(bench_alarm_queue);
+    RUN_TEST(bench_deferred_alarm_isr_time);
+
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return timer_bench_main();
+}
@@ -0,0 +1,701 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_interrupt.h>
+#include <Mockfwk_module.h>
+
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_timer.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+
+#include UNIT_TEST_SRC
+
+#define FAKE_TIMER_FREQUENCY_HZ 1000000UL
+#define FAKE_TIMER_IRQ          42
+#define FAKE_STRESS_ROUND_COUNT 64
+
+/* The sub-element index of an identifier limits a device to 256 alarms */
+#define FAKE_ALARM_COUNT     256
+#define FAKE_FIRED_COUNT_MAX FAKE_ALARM_COUNT
+
+static uint64_t fake_counter;
+static uint64_t fake_timer_timestamp;
+
+static struct alarm_sub_element_ctx fake_alarm_pool[FAKE_ALARM_COUNT];
+static struct alarm_sub_element_ctx *fake_alarms_active[FAKE_ALARM_COUNT];
+static struct timer_dev_ctx fake_ctx;
+
+static uintptr_t fired_params[FAKE_FIRED_COUNT_MAX];
+static uint64_t fired_counters[FAKE_FIRED_COUNT_MAX];
+static unsigned int fired_count;
+
+static struct fwk_event_light deferred_events[FAKE_ALARM_COUNT];
+static unsigned int deferred_event_count;
+
+static const struct mod_timer_dev_config fake_dev_config = {
+    .id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_TIMER_DRIVER, 0),
+    .timer_irq = FAKE_TIMER_IRQ,
+};
+
+static int fake_enable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int fake_disable(fwk_id_t dev_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int fake_set_timer(fwk_id_t dev_id, uint64_t timestamp)
+{
+    fake_timer_timestamp = timestamp;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_get_counter(fwk_id_t dev_id, uint64_t *counter)
+{
+    *counter = fake_counter;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_get_frequency(fwk_id_t dev_id, uint32_t *frequency)
+{
+    *frequency = FAKE_TIMER_FREQUENCY_HZ;
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_timer_driver_api fake_driver = {
+    .enable = fake_enable,
+    .disable = fake_disable,
+    .set_timer = fake_set_timer,
+    .get_counter = fake_get_counter,
+    .get_frequency = fake_get_frequency,
+};
+
+static void fake_alarm_callback(uintptr_t param)
+{
+    TEST_ASSERT_LESS_THAN(FAKE_FIRED_COUNT_MAX, fired_count);
+
+    fired_params[fired_count] = param;
+    fired_counters[fired_count] = fake_counter;
+    fired_count++;
+}
+
+static int fake_put_event_light(
+    struct fwk_event_light *event,
+    int cmock_num_calls)
+{
+    TEST_ASSERT_LESS_THAN(FAKE_ALARM_COUNT, deferred_event_count);
+
+    deferred_events[deferred_event_count++] = *event;
+
+    return FWK_SUCCESS;
+}
+
+/* Process the queued deferred alarm events in order */
+static void process_deferred_events(void)
+{
+    unsigned int event_idx;
+    struct fwk_event event, resp_event;
+
+    for (event_idx = 0; event_idx < deferred_event_count; event_idx++) {
+        event = (struct fwk_event){
+            .id = deferred_events[event_idx].id,
+            .source_id = deferred_events[event_idx].source_id,
+            .target_id = deferred_events[event_idx].target_id,
+        };
+
+        TEST_ASSERT_EQUAL(
+            FWK_SUCCESS, timer_process_event(&event, &resp_event));
+    }
+
+    deferred_event_count = 0;
+}
+
+static fwk_id_t alarm_id(unsigned int alarm_idx)
+{
+    return FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_TIMER, 0, alarm_idx);
+}
+
+/* Advance the counter to the programmed timestamp and run the timer ISR */
+static void fire_next_alarm(void)
+{
+    fake_counter = fake_timer_timestamp;
+    timer_isr((uintptr_t)&fake_ctx);
+}
+
+void setUp(void)
+{
+    memset(fake_alarm_pool, 0, sizeof(fake_alarm_pool));
+
+    fake_ctx.config = &fake_dev_config;
+    fake_ctx.driver = &fake_driver;
+    fake_ctx.driver_dev_id = fake_dev_config.id;
+    fake_ctx.alarm_pool = fake_alarm_pool;
+    fake_ctx.alarms_active = fake_alarms_active;
+    fake_ctx.active_count = 0;
+    ctx_table = &fake_ctx;
+
+    fake_counter = 0;
+    fake_timer_timestamp = 0;
+    fired_count = 0;
+    deferred_event_count = 0;
+
+    fwk_module_is_valid_sub_element_id_IgnoreAndReturn(true);
+    fwk_interrupt_get_current_IgnoreAndReturn(FWK_E_STATE);
+    fwk_interrupt_clear_pending_IgnoreAndReturn(FWK_SUCCESS);
+    __fwk_put_event_light_StubWithCallback(fake_put_event_light);
+}
+
+void tearDown(void)
+{
+    fwk_module_is_valid_sub_element_id_StopIgnore();
+    fwk_interrupt_get_current_StopIgnore();
+    fwk_interrupt_clear_pending_StopIgnore();
+}
+
+void test_alarm_start_fires_in_timestamp_order(void)
+{
+    static const unsigned int delays_ms[] = { 5, 1, 4, 2, 3, 1 };
+    unsigned int alarm_idx;
+
+    for (alarm_idx = 0; alarm_idx < FWK_ARRAY_SIZE(delays_ms); alarm_idx++) {
+        TEST_ASSERT_EQUAL(
+            FWK_SUCCESS,
+            alarm_start(
+                alarm_id(alarm_idx),
+                delays_ms[alarm_idx],
+                MOD_TIMER_ALARM_TYPE_ONCE,
+                fake_alarm_callback,
+                alarm_idx));
+    }
+
+    TEST_ASSERT_EQUAL(FWK_ARRAY_SIZE(delays_ms), fake_ctx.active_count);
+    TEST_ASSERT_EQUAL(1000, fake_timer_timestamp);
+
+    while (fake_ctx.active_count != 0) {
+        fire_next_alarm();
+    }
+
+    TEST_ASSERT_EQUAL(FWK_ARRAY_SIZE(delays_ms), fired_count);
+    for (alarm_idx = 0; alarm_idx < fired_count; alarm_idx++) {
+        TEST_ASSERT_EQUAL(
+            delays_ms[fired_params[alarm_idx]] * 1000,
+            fired_counters[alarm_idx]);
+        if (alarm_idx > 0) {
+            TEST_ASSERT_TRUE(
+                fired_counters[alarm_idx - 1] <= fired_counters[alarm_idx]);
+        }
+    }
+}
+
+void test_alarm_stop_removes_alarm_from_queue(void)
+{
+    unsigned int alarm_idx;
+
+    for (alarm_idx = 0; alarm_idx < 8; alarm_idx++) {
+        TEST_ASSERT_EQUAL(
+            FWK_SUCCESS,
+            alarm_start(
+                alarm_id(alarm_idx),
+                alarm_idx + 1,
+                MOD_TIMER_ALARM_TYPE_ONCE,
+                fake_alarm_callback,
+                alarm_idx));
+    }
+
+    /* Stop the head, an alarm in the middle and the last alarm */
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(0)));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(4)));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(7)));
+    TEST_ASSERT_EQUAL(FWK_E_STATE, alarm_stop(alarm_id(4)));
+
+    TEST_ASSERT_EQUAL(5, fake_ctx.active_count);
+    TEST_ASSERT_EQUAL(2000, fake_timer_timestamp);
+
+    while (fake_ctx.active_count != 0) {
+        fire_next_alarm();
+    }
+
+    TEST_ASSERT_EQUAL(5, fired_count);
+    TEST_ASSERT_EQUAL(1, fired_params[0]);
+    TEST_ASSERT_EQUAL(2, fired_params[1]);
+    TEST_ASSERT_EQUAL(3, fired_params[2]);
+    TEST_ASSERT_EQUAL(5, fired_params[3]);
+    TEST_ASSERT_EQUAL(6, fired_params[4]);
+}
+
+void test_alarm_restart_moves_alarm_in_queue(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(0), 1, MOD_TIMER_ALARM_TYPE_ONCE, fake_alarm_callback, 0));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(1), 2, MOD_TIMER_ALARM_TYPE_ONCE, fake_alarm_callback, 1));
+
+    /* Restarting an active alarm moves it rather than duplicating it */
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(0), 3, MOD_TIMER_ALARM_TYPE_ONCE, fake_alarm_callback, 0));
+
+    TEST_ASSERT_EQUAL(2, fake_ctx.active_count);
+    TEST_ASSERT_EQUAL(2000, fake_timer_timestamp);
+
+    fire_next_alarm();
+    fire_next_alarm();
+
+    TEST_ASSERT_EQUAL(2, fired_count);
+    TEST_ASSERT_EQUAL(1, fired_params[0]);
+    TEST_ASSERT_EQUAL(0, fired_params[1]);
+}
+
+void test_periodic_alarm_is_rearmed(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(0),
+            2,
+            MOD_TIMER_ALARM_TYPE_PERIODIC,
+            fake_alarm_callback,
+            0));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(1), 3, MOD_TIMER_ALARM_TYPE_ONCE, fake_alarm_callback, 1));
+
+    fire_next_alarm();
+    fire_next_alarm();
+    fire_next_alarm();
+
+    TEST_ASSERT_EQUAL(3, fired_count);
+    TEST_ASSERT_EQUAL(0, fired_params[0]);
+    TEST_ASSERT_EQUAL(2000, fired_counters[0]);
+    TEST_ASSERT_EQUAL(1, fired_params[1]);
+    TEST_ASSERT_EQUAL(3000, fired_counters[1]);
+    TEST_ASSERT_EQUAL(0, fired_params[2]);
+    TEST_ASSERT_EQUAL(4000, fired_counters[2]);
+
+    /* Only the periodic alarm remains */
+    TEST_ASSERT_EQUAL(1, fake_ctx.active_count);
+    TEST_ASSERT_EQUAL(6000, fake_timer_timestamp);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(0)));
+    TEST_ASSERT_EQUAL(0, fake_ctx.active_count);
+}
+
+void test_timer_isr_drains_expired_alarms(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(0), 1, MOD_TIMER_ALARM_TYPE_ONCE, fake_alarm_callback, 0));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(1), 2, MOD_TIMER_ALARM_TYPE_ONCE, fake_alarm_callback, 1));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(2), 4, MOD_TIMER_ALARM_TYPE_ONCE, fake_alarm_callback, 2));
+
+    /* The interrupt is handled late, both expired alarms are handled */
+    fake_counter = 3000;
+    timer_isr((uintptr_t)&fake_ctx);
+
+    TEST_ASSERT_EQUAL(2, fired_count);
+    TEST_ASSERT_EQUAL(0, fired_params[0]);
+    TEST_ASSERT_EQUAL(1, fired_params[1]);
+    TEST_ASSERT_EQUAL(1, fake_ctx.active_count);
+    TEST_ASSERT_EQUAL(4000, fake_timer_timestamp);
+}
+
+void test_alarm_slack_shares_interrupt(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start_with_slack(
+            alarm_id(0),
+            10,
+            5,
+            MOD_TIMER_ALARM_TYPE_ONCE,
+            fake_alarm_callback,
+            0));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(1), 12, MOD_TIMER_ALARM_TYPE_ONCE, fake_alarm_callback, 1));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start_with_slack(
+            alarm_id(2),
+            13,
+            10,
+            MOD_TIMER_ALARM_TYPE_ONCE,
+            fake_alarm_callback,
+            2));
+
+    /* The timer is configured for the earliest deadline */
+    TEST_ASSERT_EQUAL(12000, fake_timer_timestamp);
+
+    /*
+     * The first alarm is delayed to share the interrupt of the second one. The
+     * third one is not due yet.
+     */
+    fire_next_alarm();
+
+    TEST_ASSERT_EQUAL(2, fired_count);
+    TEST_ASSERT_EQUAL(1, fired_params[0]);
+    TEST_ASSERT_EQUAL(0, fired_params[1]);
+    TEST_ASSERT_EQUAL(12000, fired_counters[1]);
+    TEST_ASSERT_EQUAL(1, fake_ctx.active_count);
+    TEST_ASSERT_EQUAL(23000, fake_timer_timestamp);
+}
+
+void test_periodic_alarm_slack_does_not_drift(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start_with_slack(
+            alarm_id(0),
+            10,
+            5,
+            MOD_TIMER_ALARM_TYPE_PERIODIC,
+            fake_alarm_callback,
+            0));
+
+    TEST_ASSERT_EQUAL(15000, fake_timer_timestamp);
+
+    fire_next_alarm();
+
+    /* The next period is measured from the earliest trigger time */
+    TEST_ASSERT_EQUAL(1, fired_count);
+    TEST_ASSERT_EQUAL(25000, fake_timer_timestamp);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(0)));
+}
+
+void test_alarm_slack_stops_at_first_pending_alarm(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(0), 12, MOD_TIMER_ALARM_TYPE_ONCE, fake_alarm_callback, 0));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(1), 15, MOD_TIMER_ALARM_TYPE_ONCE, fake_alarm_callback, 1));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start_with_slack(
+            alarm_id(2),
+            5,
+            20,
+            MOD_TIMER_ALARM_TYPE_ONCE,
+            fake_alarm_callback,
+            2));
+
+    /*
+     * The third alarm can trigger with the first one, but it follows the
+     * second one in the queue, which cannot trigger yet.
+     */
+    fire_next_alarm();
+
+    TEST_ASSERT_EQUAL(1, fired_count);
+    TEST_ASSERT_EQUAL(0, fired_params[0]);
+    TEST_ASSERT_EQUAL(15000, fake_timer_timestamp);
+
+    fire_next_alarm();
+
+    TEST_ASSERT_EQUAL(3, fired_count);
+    TEST_ASSERT_EQUAL(1, fired_params[1]);
+    TEST_ASSERT_EQUAL(2, fired_params[2]);
+    TEST_ASSERT_EQUAL(15000, fired_counters[2]);
+    TEST_ASSERT_EQUAL(0, fake_ctx.active_count);
+}
+
+void test_zero_period_alarm_triggers_once_per_interrupt(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(0),
+            0,
+            MOD_TIMER_ALARM_TYPE_PERIODIC,
+            fake_alarm_callback,
+            0));
+
+    fire_next_alarm();
+    TEST_ASSERT_EQUAL(1, fired_count);
+    TEST_ASSERT_EQUAL(1, fake_ctx.active_count);
+
+    fire_next_alarm();
+    TEST_ASSERT_EQUAL(2, fired_count);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(0)));
+    TEST_ASSERT_EQUAL(0, fake_ctx.active_count);
+}
+
+void test_late_periodic_alarm_triggers_once_per_interrupt(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(0),
+            1,
+            MOD_TIMER_ALARM_TYPE_PERIODIC,
+            fake_alarm_callback,
+            0));
+
+    /* Several periods elapsed before the interrupt is handled */
+    fake_counter = 3500;
+    timer_isr((uintptr_t)&fake_ctx);
+
+    TEST_ASSERT_EQUAL(1, fired_count);
+    TEST_ASSERT_EQUAL(1, fake_ctx.active_count);
+    TEST_ASSERT_EQUAL(2000, fake_timer_timestamp);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(0)));
+}
+
+/* Callback stopping the first alarm */
+static void fake_stopping_alarm_callback(uintptr_t param)
+{
+    fake_alarm_callback(param);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(0)));
+}
+
+void test_periodic_alarm_stopped_in_interrupt_is_not_rearmed(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(0),
+            1,
+            MOD_TIMER_ALARM_TYPE_PERIODIC,
+            fake_alarm_callback,
+            0));
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(1),
+            1,
+            MOD_TIMER_ALARM_TYPE_ONCE,
+            fake_stopping_alarm_callback,
+            1));
+
+    fire_next_alarm();
+
+    TEST_ASSERT_EQUAL(2, fired_count);
+    TEST_ASSERT_EQUAL(0, fired_params[0]);
+    TEST_ASSERT_EQUAL(1, fired_params[1]);
+    TEST_ASSERT_EQUAL(0, fake_ctx.active_count);
+}
+
+void test_deferred_alarm_callback_runs_in_thread_context(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(3),
+            10,
+            MOD_TIMER_ALARM_TYPE_ONCE_DEFERRED,
+            fake_alarm_callback,
+            3));
+
+    fire_next_alarm();
+
+    /* The ISR only queues an event targeting the alarm */
+    TEST_ASSERT_EQUAL(0, fired_count);
+    TEST_ASSERT_EQUAL(1, deferred_event_count);
+    TEST_ASSERT_TRUE(fwk_id_is_equal(
+        deferred_events[0].id, timer_event_id_deferred_alarm));
+    TEST_ASSERT_TRUE(
+        fwk_id_is_equal(deferred_events[0].target_id, alarm_id(3)));
+    TEST_ASSERT_EQUAL(0, fake_ctx.active_count);
+
+    process_deferred_events();
+
+    TEST_ASSERT_EQUAL(1, fired_count);
+    TEST_ASSERT_EQUAL(3, fired_params[0]);
+}
+
+void test_deferred_periodic_alarm_coalesces_and_stops(void)
+{
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        alarm_start(
+            alarm_id(0),
+            10,
+            MOD_TIMER_ALARM_TYPE_PERIODIC_DEFERRED,
+            fake_alarm_callback,
+            0));
+
+    /* Triggers while the callback is pending share the same event */
+    fire_next_alarm();
+    fire_next_alarm();
+    TEST_ASSERT_EQUAL(1, deferred_event_count);
+    TEST_ASSERT_EQUAL(1, fake_ctx.active_count);
+
+    process_deferred_events();
+    TEST_ASSERT_EQUAL(1, fired_count);
+
+    /* A callback pending when the alarm is stopped is dropped */
+    fire_next_alarm();
+    TEST_ASSERT_EQUAL(1, deferred_event_count);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(0)));
+
+    process_deferred_events();
+    TEST_ASSERT_EQUAL(1, fired_count);
+    TEST_ASSERT_EQUAL(0, fake_ctx.active_count);
+}
+
+/* Start every alarm of the device and drain the queue through the timer ISR */
+static void run_alarms(enum mod_timer_alarm_type type)
+{
+    uint32_t seed = 0x7654321;
+    unsigned int alarm_idx;
+
+    fired_count = 0;
+
+    for (alarm_idx = 0; alarm_idx < FAKE_ALARM_COUNT; alarm_idx++) {
+        seed = (seed * 1103515245UL) + 12345UL;
+        TEST_ASSERT_EQUAL(
+            FWK_SUCCESS,
+            alarm_start(
+                alarm_id(alarm_idx),
+                (seed >> 16) % 10000,
+                type,
+                fake_alarm_callback,
+                alarm_idx));
+    }
+
+    while (fake_ctx.active_count != 0) {
+        fire_next_alarm();
+    }
+}
+
+/*
+ * Check that the timer ISR calls the callbacks of direct alarms, and only
+ * queues an event for each deferred alarm.
+ */
+void test_deferred_alarms_queue_events_from_isr(void)
+{
+    run_alarms(MOD_TIMER_ALARM_TYPE_ONCE);
+
+    TEST_ASSERT_EQUAL(FAKE_ALARM_COUNT, fired_count);
+    TEST_ASSERT_EQUAL(0, deferred_event_count);
+
+    run_alarms(MOD_TIMER_ALARM_TYPE_ONCE_DEFERRED);
+
+    TEST_ASSERT_EQUAL(0, fired_count);
+    TEST_ASSERT_EQUAL(FAKE_ALARM_COUNT, deferred_event_count);
+
+    process_deferred_events();
+    TEST_ASSERT_EQUAL(FAKE_ALARM_COUNT, fired_count);
+}
+
+/*
+ * Repeatedly start every alarm of the device with a pseudo-random delay, stop
+ * a third of them and drain the queue through the timer ISR.
+ */
+void test_alarm_queue_stress(void)
+{
+    uint32_t seed = 0x1234567;
+    unsigned int round, alarm_idx;
+    unsigned int started_count;
+
+    for (round = 0; round < FAKE_STRESS_ROUND_COUNT; round++) {
+        fired_count = 0;
+        started_count = 0;
+
+        for (alarm_idx = 0; alarm_idx < FAKE_ALARM_COUNT; alarm_idx++) {
+            seed = (seed * 1103515245UL) + 12345UL;
+            TEST_ASSERT_EQUAL(
+                FWK_SUCCESS,
+                alarm_start(
+                    alarm_id(alarm_idx),
+                    (seed >> 16) % 10000,
+                    MOD_TIMER_ALARM_TYPE_ONCE,
+                    fake_alarm_callback,
+                    alarm_idx));
+        }
+
+        /* Stop one alarm out of three */
+        for (alarm_idx = round % 3; alarm_idx < FAKE_ALARM_COUNT;
+             alarm_idx += 3) {
+            TEST_ASSERT_EQUAL(FWK_SUCCESS, alarm_stop(alarm_id(alarm_idx)));
+        }
+
+        for (alarm_idx = 0; alarm_idx < FAKE_ALARM_COUNT; alarm_idx++) {
+            if (fake_alarm_pool[alarm_idx].activated) {
+                started_count++;
+            }
+        }
+        TEST_ASSERT_EQUAL(started_count, fake_ctx.active_count);
+
+        while (fake_ctx.active_count != 0) {
+            fire_next_alarm();
+        }
+
+        TEST_ASSERT_EQUAL(started_count, fired_count);
+        for (alarm_idx = 0; alarm_idx < fired_count; alarm_idx++) {
+            TEST_ASSERT_NOT_EQUAL(round % 3, fired_params[alarm_idx] % 3);
+            if (alarm_idx > 0) {
+                TEST_ASSERT_TRUE(
+                    fired_counters[alarm_idx - 1] <=
+                    fired_counters[alarm_idx]);
+            }
+        }
+    }
+}
+
+int timer_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_alarm_start_fires_in_timestamp_order);
+    RUN_TEST(test_alarm_stop_removes_alarm_from_queue);
+    RUN_TEST(test_alarm_restart_moves_alarm_in_queue);
+    RUN_TEST(test_periodic_alarm_is_rearmed);
+    RUN_TEST(test_timer_isr_drains_expired_alarms);
+    RUN_TEST(test_alarm_slack_shares_interrupt);
+    RUN_TEST(test_periodic_alarm_slack_does_not_drift);
+    RUN_TEST(test_alarm_slack_stops_at_first_pending_alarm);
+    RUN_TEST(test_zero_period_alarm_triggers_once_per_interrupt);
+    RUN_TEST(test_late_periodic_alarm_triggers_once_per_interrupt);
+    RUN_TEST(test_periodic_alarm_stopped_in_interrupt_is_not_rearmed);
+    RUN_TEST(test_deferred_alarm_callback_runs_in_thread_context);
+    RUN_TEST(test_deferred_periodic_alarm_coalesces_and_stops);
+    RUN_TEST(test_deferred_alarms_queue_events_from_isr);
+    RUN_TEST(test_alarm_queue_stress);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return timer_test_main();
+}
+#endif
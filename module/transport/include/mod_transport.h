@@ -85,6 +85,14 @@ struct mod_transport_buffer {
  */
 #define MOD_TRANSPORT_POLICY_INIT_MAILBOX ((uint32_t)(1U << 1))
 
+/*!
+ * Responses on this channel are written in place in the shared mailbox rather
+ * than copied from an internal buffer. Requests are still copied to an internal
+ * buffer, sized by the channel's zero_copy_request_size. Only relevant for
+ * out-band completer channels.
+ */
+#define MOD_TRANSPORT_POLICY_ZERO_COPY ((uint32_t)(1U << 2))
+
 /*!
  * @}
  */
@@ -210,12 +218,32 @@ struct mod_transport_channel_config {
      */
     size_t out_band_mailbox_size;
 
+    /*!
+     * Largest request payload size in bytes accepted on the channel when the
+     * ::MOD_TRANSPORT_POLICY_ZERO_COPY policy is set. Requests are copied to
+     * an internal buffer of this size before they are processed, so that they
+     * cannot be changed by the agent in the meantime. Must not be zero or
+     * larger than the mailbox payload. Only relevant for out-band completer
+     * channels with this policy.
+     */
+    size_t zero_copy_request_size;
+
     /*!
      * Internal read & write mailbox size in bytes. Only relevant for
      * in-band transport type.
      */
     size_t in_band_mailbox_size;
 
+    /*!
+     * Number of messages that can be queued while the channel is processing
+     * a message. Queued messages are processed in the order they were
+     * received, once the message being processed has been responded to. Only
+     * relevant for in-band transport type, as an out-band shared mailbox
+     * holds a single message. Messages received while the queue is full, or
+     * when the depth is zero, are rejected.
+     */
+    unsigned int queue_depth;
+
     /*!
      * Identifier of the power domain that this channel depends on.
      * Applicable for out-band transport channels only.
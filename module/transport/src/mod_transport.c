@@ -34,6 +34,7 @@
 #include <fwk_string.h>
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #define MOD_NAME "[TRANSPORT]"
 
@@ -52,12 +53,32 @@ struct transport_channel_ctx {
     /* Channel read and write buffer areas */
     struct mod_transport_buffer *in, *out;
 
+    /*
+     * Payload of the response being written. It points to the shared mailbox
+     * on zero-copy channels, and to the write buffer area otherwise.
+     */
+    void *out_payload;
+
     /* Flag to indicate message processing in progress */
     volatile bool locked;
 
+#if defined(BUILD_HAS_INBAND_MSG_SUPPORT)
+    /* Messages received while the channel was locked */
+    uint8_t *queue;
+
+    /* Index of the oldest queued message */
+    unsigned int queue_head;
+
+    /* Number of queued messages */
+    volatile unsigned int queue_count;
+#endif
+
     /* Maximum payload size of the channel */
     size_t max_payload_size;
 
+    /* Maximum payload size of the messages received on the channel */
+    size_t max_request_size;
+
     /* Service bound to the channel */
     fwk_id_t service_id;
 
@@ -97,6 +118,48 @@ struct transport_context {
 
 static struct transport_context transport_ctx;
 
+static int transport_process_message(struct transport_channel_ctx *channel_ctx);
+
+#if defined(BUILD_HAS_INBAND_MSG_SUPPORT)
+static struct mod_transport_buffer *transport_queue_slot(
+    struct transport_channel_ctx *channel_ctx,
+    unsigned int idx)
+{
+    size_t offset = idx * channel_ctx->config->in_band_mailbox_size;
+
+    return (struct mod_transport_buffer *)&channel_ctx->queue[offset];
+}
+#endif
+
+/*
+ * Release the channel, or hand it over to the oldest queued message if any.
+ * Must be called with interrupts disabled.
+ *
+ * Returns true if a queued message was moved to the read buffer, in which case
+ * the channel remains locked and the message must be processed.
+ */
+static bool transport_unlock_channel(struct transport_channel_ctx *channel_ctx)
+{
+#if defined(BUILD_HAS_INBAND_MSG_SUPPORT)
+    if (channel_ctx->queue_count != 0) {
+        fwk_str_memcpy(
+            channel_ctx->in,
+            transport_queue_slot(channel_ctx, channel_ctx->queue_head),
+            channel_ctx->config->in_band_mailbox_size);
+
+        channel_ctx->queue_head =
+            (channel_ctx->queue_head + 1) % channel_ctx->config->queue_depth;
+        channel_ctx->queue_count--;
+
+        return true;
+    }
+#endif
+
+    channel_ctx->locked = false;
+
+    return false;
+}
+
 /*
  * SCMI module Transport API
  */
@@ -217,7 +280,7 @@ static int transport_write_payload(
     }
 
     fwk_str_memcpy(
-        ((uint8_t *)channel_ctx->out->payload) + offset, payload, size);
+        ((uint8_t *)channel_ctx->out_payload) + offset, payload, size);
 
     return FWK_SUCCESS;
 }
@@ -231,7 +294,12 @@ static int transport_respond(
     struct mod_transport_buffer *buffer = NULL;
     enum mod_transport_channel_transport_type transport_type;
     int status = FWK_SUCCESS;
+    int process_status;
     unsigned int flags;
+    bool dequeued;
+#if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
+    const void *source;
+#endif
 
     channel_ctx =
         &transport_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
@@ -246,18 +314,24 @@ static int transport_respond(
         buffer = ((struct mod_transport_buffer *)
                       channel_ctx->config->out_band_mailbox_address);
 
-        /* Copy the header and other fields from the write buffer */
+        /*
+         * Copy the header and other fields from the write buffer. The size of
+         * the structure may include padding that overlaps the payload, which
+         * is only copied below.
+         */
         fwk_str_memcpy(
-            buffer, channel_ctx->out, sizeof(struct mod_transport_buffer));
+            buffer,
+            channel_ctx->out,
+            offsetof(struct mod_transport_buffer, payload));
 
         /*
          * Copy the payload from either the write buffer or the payload
-         * parameter.
+         * parameter. Zero-copy channels have written it in place already.
          */
-        fwk_str_memcpy(
-            buffer->payload,
-            (payload == NULL ? channel_ctx->out->payload : payload),
-            size);
+        source = (payload == NULL) ? channel_ctx->out_payload : payload;
+        if (source != buffer->payload) {
+            fwk_str_memcpy(buffer->payload, source, size);
+        }
     }
 #else
 #    if defined(BUILD_HAS_INBAND_MSG_SUPPORT)
@@ -288,30 +362,39 @@ static int transport_respond(
      */
     flags = fwk_interrupt_global_disable();
 
-    channel_ctx->locked = false;
+    dequeued = transport_unlock_channel(channel_ctx);
     buffer->length = (volatile uint32_t)(sizeof(buffer->message_header) + size);
     /* The mailbox status is relevant for out-band transport only */
     buffer->status |= MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK;
 
-    fwk_interrupt_global_enable(flags);
+    (void)fwk_interrupt_global_enable(flags);
 
 #if defined(BUILD_HAS_INBAND_MSG_SUPPORT)
     if (transport_type == MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_IN_BAND) {
         /* Send the response message using driver module API */
         status = channel_ctx->driver_api->send_message(
             buffer, channel_ctx->config->driver_id);
-
-        if (status != FWK_SUCCESS) {
-            return status;
-        }
     }
 #endif
 
-    if (buffer->flags & MOD_TRANSPORT_MAILBOX_FLAGS_IENABLED_MASK) {
+    if ((status == FWK_SUCCESS) &&
+        (buffer->flags & MOD_TRANSPORT_MAILBOX_FLAGS_IENABLED_MASK)) {
         status = channel_ctx->driver_api->trigger_event(
             channel_ctx->config->driver_id);
     }
 
+    if (dequeued) {
+        /*
+         * The channel has been handed over to the next queued message. It must
+         * be processed even if the response could not be sent, otherwise the
+         * message would be lost and the channel would remain locked.
+         */
+        process_status = transport_process_message(channel_ctx);
+        if (status == FWK_SUCCESS) {
+            status = process_status;
+        }
+    }
+
     return status;
 }
 
@@ -409,6 +492,8 @@ static int transport_transmit(
 static int transport_release_channel_lock(fwk_id_t channel_id)
 {
     struct transport_channel_ctx *channel_ctx;
+    unsigned int flags;
+    bool dequeued;
 
     channel_ctx =
         &transport_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
@@ -422,7 +507,14 @@ static int transport_release_channel_lock(fwk_id_t channel_id)
      * where the channel context is locked and never released since it is the
      * transport_respond() function that releases the channel context.
      */
-    channel_ctx->locked = false;
+    flags = fwk_interrupt_global_disable();
+    dequeued = transport_unlock_channel(channel_ctx);
+    (void)fwk_interrupt_global_enable(flags);
+
+    if (dequeued) {
+        return transport_process_message(channel_ctx);
+    }
+
     return FWK_SUCCESS;
 }
 
@@ -586,25 +678,38 @@ static const struct mod_transport_fast_channels_api
 
 static int transport_message_handler(struct transport_channel_ctx *channel_ctx)
 {
-    struct mod_transport_buffer *in, *out;
-    int status;
+    struct mod_transport_buffer *in;
 
 #if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
     struct mod_transport_buffer *shared_memory;
-    size_t payload_size;
 #endif
 
     enum mod_transport_channel_transport_type transport_type;
 
+    transport_type = channel_ctx->config->transport_type;
+
     /* Check if we are already processing */
     if (channel_ctx->locked) {
+#if defined(BUILD_HAS_INBAND_MSG_SUPPORT)
+        if ((transport_type == MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_IN_BAND) &&
+            (channel_ctx->queue_count < channel_ctx->config->queue_depth)) {
+            /* Queue the message until the channel is released */
+            channel_ctx->driver_api->get_message(
+                transport_queue_slot(
+                    channel_ctx,
+                    (channel_ctx->queue_head + channel_ctx->queue_count) %
+                        channel_ctx->config->queue_depth),
+                channel_ctx->config->driver_id);
+            channel_ctx->queue_count++;
+
+            return FWK_SUCCESS;
+        }
+#endif
         return FWK_E_STATE;
     }
 
     in = channel_ctx->in;
-    out = channel_ctx->out;
 
-    transport_type = channel_ctx->config->transport_type;
 #if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
     if (transport_type == MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND) {
         shared_memory = ((struct mod_transport_buffer *)
@@ -669,6 +774,27 @@ static int transport_message_handler(struct transport_channel_ctx *channel_ctx)
             in, channel_ctx->config->driver_id);
     }
 #endif
+
+    return transport_process_message(channel_ctx);
+}
+
+/*
+ * Validate the message in the read buffer of a locked channel and signal it to
+ * the bound service.
+ */
+static int transport_process_message(struct transport_channel_ctx *channel_ctx)
+{
+    struct mod_transport_buffer *in, *out;
+    int status;
+
+#if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
+    struct mod_transport_buffer *shared_memory;
+    size_t payload_size;
+#endif
+
+    in = channel_ctx->in;
+    out = channel_ctx->out;
+
     /* mirror contents in the read & write buffers (Payload not copied) */
     fwk_str_memcpy(out, in, sizeof(struct mod_transport_buffer));
 
@@ -685,7 +811,7 @@ static int transport_message_handler(struct transport_channel_ctx *channel_ctx)
      */
     if ((in->length < sizeof(in->message_header)) ||
         ((in->length - sizeof(in->message_header)) >
-         channel_ctx->max_payload_size)) {
+         channel_ctx->max_request_size)) {
         out->status |= MOD_TRANSPORT_MAILBOX_STATUS_ERROR_MASK;
 
         if (channel_ctx->is_scmi) {
@@ -706,13 +832,18 @@ static int transport_message_handler(struct transport_channel_ctx *channel_ctx)
     }
 
 #if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
-    if (transport_type == MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND) {
+    if (channel_ctx->config->transport_type ==
+        MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND) {
         shared_memory = ((struct mod_transport_buffer *)
                              channel_ctx->config->out_band_mailbox_address);
 
         payload_size = in->length - sizeof(in->message_header);
-        if (payload_size != 0) {
-            /* Copy payload from shared memory to read buffer */
+        if ((payload_size != 0) &&
+            ((out->status & MOD_TRANSPORT_MAILBOX_STATUS_ERROR_MASK) == 0)) {
+            /*
+             * Copy payload from shared memory to read buffer, unless it does
+             * not fit in it.
+             */
             fwk_str_memcpy(in->payload, shared_memory->payload, payload_size);
         }
     }
@@ -879,13 +1010,47 @@ static int transport_channel_init(
     switch (channel_ctx->config->transport_type) {
 #if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
     case MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND:
-        channel_ctx->in =
-            fwk_mm_alloc(1, channel_ctx->config->out_band_mailbox_size);
-        channel_ctx->out =
-            fwk_mm_alloc(1, channel_ctx->config->out_band_mailbox_size);
         channel_ctx->max_payload_size =
             channel_ctx->config->out_band_mailbox_size -
             sizeof(struct mod_transport_buffer);
+
+        if (((channel_ctx->config->policies &
+              MOD_TRANSPORT_POLICY_ZERO_COPY) != (uint32_t)0) &&
+            (channel_ctx->config->channel_type ==
+             MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER)) {
+            if ((channel_ctx->config->zero_copy_request_size == 0) ||
+                (channel_ctx->config->zero_copy_request_size >
+                 channel_ctx->max_payload_size)) {
+                fwk_unexpected();
+                return FWK_E_DATA;
+            }
+
+            /*
+             * The request is copied to the read buffer, where it cannot be
+             * changed by the agent while it is processed. The response is
+             * written in place in the shared mailbox, so the write buffer only
+             * holds its header.
+             */
+            channel_ctx->max_request_size =
+                channel_ctx->config->zero_copy_request_size;
+            channel_ctx->in = fwk_mm_alloc(
+                1,
+                sizeof(struct mod_transport_buffer) +
+                    channel_ctx->max_request_size);
+            channel_ctx->out =
+                fwk_mm_alloc(1, sizeof(struct mod_transport_buffer));
+            channel_ctx->out_payload =
+                ((struct mod_transport_buffer *)
+                     channel_ctx->config->out_band_mailbox_address)
+                    ->payload;
+        } else {
+            channel_ctx->max_request_size = channel_ctx->max_payload_size;
+            channel_ctx->in =
+                fwk_mm_alloc(1, channel_ctx->config->out_band_mailbox_size);
+            channel_ctx->out =
+                fwk_mm_alloc(1, channel_ctx->config->out_band_mailbox_size);
+            channel_ctx->out_payload = channel_ctx->out->payload;
+        }
         break;
 #endif
 
@@ -898,6 +1063,13 @@ static int transport_channel_init(
         channel_ctx->max_payload_size =
             channel_ctx->config->in_band_mailbox_size -
             sizeof(struct mod_transport_buffer);
+        channel_ctx->max_request_size = channel_ctx->max_payload_size;
+        channel_ctx->out_payload = channel_ctx->out->payload;
+        if (channel_ctx->config->queue_depth != 0) {
+            channel_ctx->queue = fwk_mm_alloc(
+                channel_ctx->config->queue_depth,
+                channel_ctx->config->in_band_mailbox_size);
+        }
         break;
 #endif
 
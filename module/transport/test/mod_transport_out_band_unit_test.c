@@ -0,0 +1,264 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+
+#include <mod_transport.h>
+
+#include <fwk_element.h>
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+
+#define PAYLOAD_SIZE 64
+#define REQUEST_SIZE 8
+#define MAILBOX_SIZE (sizeof(struct mod_transport_buffer) + PAYLOAD_SIZE)
+#define CANARY       0xA5A5A5A5U
+
+enum fake_channel_idx {
+    FAKE_CHANNEL_IDX_ZERO_COPY,
+    FAKE_CHANNEL_IDX_COUNT,
+};
+
+static const fwk_id_t channel_id =
+    FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_TRANSPORT, FAKE_CHANNEL_IDX_ZERO_COPY);
+
+static uint64_t mailbox_area[MAILBOX_SIZE / sizeof(uint64_t)];
+static struct mod_transport_buffer *const mailbox =
+    (struct mod_transport_buffer *)mailbox_area;
+
+static struct mod_transport_channel_config zero_copy_config = {
+    .transport_type = MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND,
+    .channel_type = MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER,
+    .out_band_mailbox_address = (uintptr_t)mailbox_area,
+    .out_band_mailbox_size = MAILBOX_SIZE,
+    .zero_copy_request_size = REQUEST_SIZE,
+    .policies = MOD_TRANSPORT_POLICY_ZERO_COPY,
+    .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_DRIVER, 0),
+};
+
+static struct transport_channel_ctx channel_ctx_table[FAKE_CHANNEL_IDX_COUNT];
+
+/* The read buffer is followed by a canary to catch overflows */
+static struct {
+    uint64_t buffer[(sizeof(struct mod_transport_buffer) + REQUEST_SIZE) /
+                    sizeof(uint64_t)];
+    uint32_t canary;
+} in_area;
+
+static uint64_t out_area[sizeof(struct mod_transport_buffer) /
+                         sizeof(uint64_t)];
+
+static unsigned int signal_error_count;
+static unsigned int signal_message_count;
+
+/* Request payload seen by the service */
+static uint32_t request[REQUEST_SIZE / sizeof(uint32_t)];
+
+static int fake_trigger_event(fwk_id_t device_id)
+{
+    return FWK_SUCCESS;
+}
+
+static struct mod_transport_driver_api driver_api = {
+    .trigger_event = fake_trigger_event,
+};
+
+static int fake_signal_error(fwk_id_t service_id)
+{
+    signal_error_count++;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_signal_message(fwk_id_t service_id)
+{
+    int status;
+    const void *payload;
+    size_t size;
+
+    signal_message_count++;
+
+    status = transport_get_payload(channel_id, &payload, &size);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    if (size == sizeof(request)) {
+        /* The request is not read from the shared mailbox */
+        TEST_ASSERT_NOT_EQUAL((uintptr_t)mailbox->payload, (uintptr_t)payload);
+        memcpy(request, payload, sizeof(request));
+    }
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_transport_firmware_signal_api signal_api = {
+    .signal_error = fake_signal_error,
+    .signal_message = fake_signal_message,
+};
+
+static void post_request(uint32_t header, size_t payload_size)
+{
+    unsigned int i;
+
+    mailbox->status = 0;
+    mailbox->flags = 0;
+    mailbox->length = sizeof(mailbox->message_header) + payload_size;
+    mailbox->message_header = header;
+
+    for (i = 0; i < (PAYLOAD_SIZE / sizeof(uint32_t)); i++) {
+        mailbox->payload[i] = i + 1;
+    }
+}
+
+void setUp(void)
+{
+    struct transport_channel_ctx *channel_ctx =
+        &channel_ctx_table[FAKE_CHANNEL_IDX_ZERO_COPY];
+    int status;
+
+    memset(channel_ctx_table, 0, sizeof(channel_ctx_table));
+    memset(&in_area, 0, sizeof(in_area));
+    memset(mailbox_area, 0, sizeof(mailbox_area));
+    memset(request, 0, sizeof(request));
+    in_area.canary = CANARY;
+
+    transport_ctx.channel_ctx_table = channel_ctx_table;
+    transport_ctx.channel_count = FAKE_CHANNEL_IDX_COUNT;
+
+    /* Zero-copy channels do not need buffers for the whole mailbox */
+    fwk_mm_alloc_ExpectAndReturn(
+        1, sizeof(struct mod_transport_buffer) + REQUEST_SIZE, in_area.buffer);
+    fwk_mm_alloc_ExpectAndReturn(
+        1, sizeof(struct mod_transport_buffer), out_area);
+
+    status = transport_channel_init(channel_id, 0, &zero_copy_config);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    channel_ctx->driver_api = &driver_api;
+    channel_ctx->transport_signal.firmware_signal_api = &signal_api;
+    channel_ctx->out_band_mailbox_ready = true;
+
+    signal_error_count = 0;
+    signal_message_count = 0;
+}
+
+void tearDown(void)
+{
+}
+
+void test_transport_zero_copy_channel_init(void)
+{
+    struct transport_channel_ctx *channel_ctx =
+        &channel_ctx_table[FAKE_CHANNEL_IDX_ZERO_COPY];
+
+    TEST_ASSERT_EQUAL(PAYLOAD_SIZE, channel_ctx->max_payload_size);
+    TEST_ASSERT_EQUAL(REQUEST_SIZE, channel_ctx->max_request_size);
+    TEST_ASSERT_EQUAL_PTR(mailbox->payload, channel_ctx->out_payload);
+}
+
+void test_transport_zero_copy_channel_init_invalid_request_size(void)
+{
+    struct mod_transport_channel_config config = zero_copy_config;
+    int status;
+
+    config.zero_copy_request_size = 0;
+    status = transport_channel_init(channel_id, 0, &config);
+    TEST_ASSERT_EQUAL(FWK_E_DATA, status);
+
+    config.zero_copy_request_size = PAYLOAD_SIZE + 1;
+    status = transport_channel_init(channel_id, 0, &config);
+    TEST_ASSERT_EQUAL(FWK_E_DATA, status);
+}
+
+void test_transport_zero_copy_request_snapshot(void)
+{
+    int status;
+    const void *payload;
+    size_t size;
+
+    post_request(0x10, REQUEST_SIZE);
+
+    status = transport_signal_message(channel_id);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, signal_message_count);
+    TEST_ASSERT_EQUAL(0, signal_error_count);
+    TEST_ASSERT_EQUAL(1, request[0]);
+    TEST_ASSERT_EQUAL(2, request[1]);
+
+    /* A change of the mailbox by the agent is not seen by the service */
+    mailbox->payload[0] = 0xFF;
+    mailbox->length = MAILBOX_SIZE;
+
+    status = transport_get_payload(channel_id, &payload, &size);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(REQUEST_SIZE, size);
+    TEST_ASSERT_EQUAL(1, ((const uint32_t *)payload)[0]);
+    TEST_ASSERT_EQUAL(CANARY, in_area.canary);
+}
+
+void test_transport_zero_copy_response_in_place(void)
+{
+    static const uint32_t response[PAYLOAD_SIZE / sizeof(uint32_t)] = {
+        [0] = 0xC0DE,
+        [(PAYLOAD_SIZE / sizeof(uint32_t)) - 1] = 0xCAFE,
+    };
+    int status;
+
+    post_request(0x20, REQUEST_SIZE);
+
+    status = transport_signal_message(channel_id);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* The response may use the whole mailbox payload */
+    status = transport_write_payload(channel_id, 0, response, sizeof(response));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_MEMORY(response, mailbox->payload, sizeof(response));
+
+    status = transport_respond(channel_id, NULL, sizeof(response));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0x20, mailbox->message_header);
+    TEST_ASSERT_EQUAL(
+        sizeof(mailbox->message_header) + sizeof(response), mailbox->length);
+    TEST_ASSERT_EQUAL_MEMORY(response, mailbox->payload, sizeof(response));
+    TEST_ASSERT_TRUE(
+        (mailbox->status & MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK) != 0);
+    TEST_ASSERT_FALSE(channel_ctx_table[0].locked);
+}
+
+void test_transport_zero_copy_request_too_large(void)
+{
+    int status;
+
+    post_request(0x30, REQUEST_SIZE + sizeof(uint32_t));
+
+    status = transport_signal_message(channel_id);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, signal_error_count);
+    TEST_ASSERT_EQUAL(CANARY, in_area.canary);
+}
+
+int transport_out_band_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_transport_zero_copy_channel_init);
+    RUN_TEST(test_transport_zero_copy_channel_init_invalid_request_size);
+    RUN_TEST(test_transport_zero_copy_request_snapshot);
+    RUN_TEST(test_transport_zero_copy_response_in_place);
+    RUN_TEST(test_transport_zero_copy_request_too_large);
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return transport_out_band_test_main();
+}
+#endif
@@ -0,0 +1,263 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_module.h>
+
+#include <mod_transport.h>
+
+#include <fwk_element.h>
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+
+#define QUEUE_DEPTH   2
+#define PAYLOAD_SIZE  16
+#define MAILBOX_SIZE  (sizeof(struct mod_transport_buffer) + PAYLOAD_SIZE)
+#define MESSAGE_COUNT 8
+
+enum fake_channel_idx {
+    FAKE_CHANNEL_IDX_IN_BAND,
+    FAKE_CHANNEL_IDX_COUNT,
+};
+
+static const fwk_id_t channel_id =
+    FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_TRANSPORT, FAKE_CHANNEL_IDX_IN_BAND);
+
+static struct mod_transport_channel_config in_band_config = {
+    .transport_type = MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_IN_BAND,
+    .channel_type = MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER,
+    .in_band_mailbox_size = MAILBOX_SIZE,
+    .queue_depth = QUEUE_DEPTH,
+    .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_DRIVER, 0),
+};
+
+static struct transport_channel_ctx channel_ctx_table[FAKE_CHANNEL_IDX_COUNT];
+
+static uint64_t in_buffer[MAILBOX_SIZE / sizeof(uint64_t)];
+static uint64_t out_buffer[MAILBOX_SIZE / sizeof(uint64_t)];
+static uint64_t queue_buffer[QUEUE_DEPTH * MAILBOX_SIZE / sizeof(uint64_t)];
+
+/* Header of the next message the fake driver hands over */
+static uint32_t next_message_header;
+
+/* Headers of the messages signalled to the service, in order */
+static uint32_t signalled_headers[MESSAGE_COUNT];
+static unsigned int signalled_count;
+
+static unsigned int get_message_count;
+static unsigned int send_message_count;
+static int send_message_status;
+
+static int fake_send_message(
+    struct mod_transport_buffer *message,
+    fwk_id_t device_id)
+{
+    send_message_count++;
+
+    return send_message_status;
+}
+
+static int fake_get_message(
+    struct mod_transport_buffer *message,
+    fwk_id_t device_id)
+{
+    *message = (struct mod_transport_buffer){
+        .length = sizeof(message->message_header),
+        .message_header = next_message_header++,
+    };
+    get_message_count++;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_trigger_event(fwk_id_t device_id)
+{
+    return FWK_SUCCESS;
+}
+
+static struct mod_transport_driver_api driver_api = {
+    .send_message = fake_send_message,
+    .get_message = fake_get_message,
+    .trigger_event = fake_trigger_event,
+};
+
+static int fake_signal_error(fwk_id_t service_id)
+{
+    return FWK_SUCCESS;
+}
+
+static int fake_signal_message(fwk_id_t service_id)
+{
+    struct transport_channel_ctx *channel_ctx =
+        &channel_ctx_table[FAKE_CHANNEL_IDX_IN_BAND];
+
+    TEST_ASSERT_TRUE(channel_ctx->locked);
+    TEST_ASSERT_LESS_THAN(MESSAGE_COUNT, signalled_count);
+
+    signalled_headers[signalled_count++] = channel_ctx->in->message_header;
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_transport_firmware_signal_api signal_api = {
+    .signal_error = fake_signal_error,
+    .signal_message = fake_signal_message,
+};
+
+void setUp(void)
+{
+    struct transport_channel_ctx *channel_ctx =
+        &channel_ctx_table[FAKE_CHANNEL_IDX_IN_BAND];
+
+    memset(channel_ctx_table, 0, sizeof(channel_ctx_table));
+    transport_ctx.channel_ctx_table = channel_ctx_table;
+    transport_ctx.channel_count = FAKE_CHANNEL_IDX_COUNT;
+
+    channel_ctx->id = channel_id;
+    channel_ctx->config = &in_band_config;
+    channel_ctx->in = (struct mod_transport_buffer *)in_buffer;
+    channel_ctx->out = (struct mod_transport_buffer *)out_buffer;
+    channel_ctx->out_payload = channel_ctx->out->payload;
+    channel_ctx->queue = (uint8_t *)queue_buffer;
+    channel_ctx->max_payload_size = PAYLOAD_SIZE;
+    channel_ctx->max_request_size = PAYLOAD_SIZE;
+    channel_ctx->driver_api = &driver_api;
+    channel_ctx->transport_signal.firmware_signal_api = &signal_api;
+
+    next_message_header = 1;
+    signalled_count = 0;
+    get_message_count = 0;
+    send_message_count = 0;
+    send_message_status = FWK_SUCCESS;
+}
+
+void tearDown(void)
+{
+}
+
+void test_transport_queue_order(void)
+{
+    int status;
+    unsigned int i;
+
+    /* The first message is processed, the next ones are queued */
+    for (i = 0; i < (QUEUE_DEPTH + 1); i++) {
+        status = transport_signal_message(channel_id);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    TEST_ASSERT_EQUAL(QUEUE_DEPTH + 1, get_message_count);
+    TEST_ASSERT_EQUAL(1, signalled_count);
+    TEST_ASSERT_EQUAL(QUEUE_DEPTH, channel_ctx_table[0].queue_count);
+
+    /* Each response hands the channel over to the oldest queued message */
+    for (i = 0; i < QUEUE_DEPTH; i++) {
+        status = transport_respond(channel_id, NULL, 0);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+        TEST_ASSERT_TRUE(channel_ctx_table[0].locked);
+    }
+
+    status = transport_respond(channel_id, NULL, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_FALSE(channel_ctx_table[0].locked);
+
+    TEST_ASSERT_EQUAL(QUEUE_DEPTH + 1, signalled_count);
+    for (i = 0; i < signalled_count; i++) {
+        TEST_ASSERT_EQUAL(i + 1, signalled_headers[i]);
+    }
+}
+
+void test_transport_queue_full(void)
+{
+    int status;
+    unsigned int i;
+
+    for (i = 0; i < (QUEUE_DEPTH + 1); i++) {
+        status = transport_signal_message(channel_id);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    /* The queue is full, the message is left with the driver */
+    status = transport_signal_message(channel_id);
+    TEST_ASSERT_EQUAL(FWK_E_STATE, status);
+    TEST_ASSERT_EQUAL(QUEUE_DEPTH + 1, get_message_count);
+    TEST_ASSERT_EQUAL(QUEUE_DEPTH, channel_ctx_table[0].queue_count);
+
+    /* Room is made in the queue once a queued message is processed */
+    status = transport_respond(channel_id, NULL, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = transport_signal_message(channel_id);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(QUEUE_DEPTH, channel_ctx_table[0].queue_count);
+}
+
+void test_transport_queue_respond_failure(void)
+{
+    int status;
+
+    status = transport_signal_message(channel_id);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    status = transport_signal_message(channel_id);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* The response cannot be sent, the queued message is still processed */
+    send_message_status = FWK_E_DEVICE;
+    status = transport_respond(channel_id, NULL, 0);
+    TEST_ASSERT_EQUAL(FWK_E_DEVICE, status);
+    TEST_ASSERT_EQUAL(1, send_message_count);
+    TEST_ASSERT_EQUAL(2, signalled_count);
+    TEST_ASSERT_EQUAL(2, signalled_headers[1]);
+    TEST_ASSERT_EQUAL(0, channel_ctx_table[0].queue_count);
+    TEST_ASSERT_TRUE(channel_ctx_table[0].locked);
+
+    /* The channel is released by the response to the queued message */
+    send_message_status = FWK_SUCCESS;
+    status = transport_respond(channel_id, NULL, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_FALSE(channel_ctx_table[0].locked);
+}
+
+void test_transport_queue_release_channel_lock(void)
+{
+    int status;
+
+    status = transport_signal_message(channel_id);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    status = transport_signal_message(channel_id);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = transport_release_channel_lock(channel_id);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, signalled_count);
+    TEST_ASSERT_TRUE(channel_ctx_table[0].locked);
+
+    status = transport_release_channel_lock(channel_id);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_FALSE(channel_ctx_table[0].locked);
+    TEST_ASSERT_EQUAL(0, send_message_count);
+}
+
+int transport_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_transport_queue_order);
+    RUN_TEST(test_transport_queue_full);
+    RUN_TEST(test_transport_queue_respond_failure);
+    RUN_TEST(test_transport_queue_release_channel_lock);
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return transport_test_main();
+}
+#endif
@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+#
+# Arm SCP/MCP Software
+# Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""
+Decode the output of a firmware built with the SCP_ENABLE_FWK_LOG_BINARY and
+SCP_ENABLE_FWK_LOG_BINARY_RAW options.
+
+The firmware writes each log message as a binary record holding the address
+of its format string and the raw value of its arguments. The format strings
+are read back from the ELF image of the firmware. Any text found between the
+records, such as the banner, is passed through unchanged.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+RECORD_MAGIC = 0x1E
+
+PT_LOAD = 1
+
+SPEC_REGEX = re.compile(
+    rb'%([-+ #0]*)(\*|[0-9]*)(?:\.(\*|[0-9]*))?(hh|h|ll|l|j|z|t|L)?(.?)')
+
+
+class Elf:
+    """ Minimal ELF reader mapping addresses to the content of the image """
+
+    def __init__(self, path):
+        with open(path, 'rb') as file:
+            self.data = file.read()
+
+        if self.data[:4] != b'\x7fELF':
+            raise ValueError('{} is not an ELF file'.format(path))
+
+        self.is_64bit = self.data[4] == 2
+        self.endian = '<' if self.data[5] == 1 else '>'
+        self.pointer_size = 8 if self.is_64bit else 4
+
+        if self.is_64bit:
+            phoff, = self.unpack('Q', 0x20)
+            phentsize, phnum = self.unpack('HH', 0x36)
+            phdr_format = 'IIQQQQ'
+        else:
+            phoff, = self.unpack('I', 0x1C)
+            phentsize, phnum = self.unpack('HH', 0x2A)
+            phdr_format = 'IIIIII'
+
+        self.segments = []
+        for i in range(phnum):
+            fields = self.unpack(phdr_format, phoff + (i * phentsize))
+            if self.is_64bit:
+                p_type, _, p_offset, p_vaddr, _, p_filesz = fields
+            else:
+                p_type, p_offset, p_vaddr, _, p_filesz, _ = fields
+
+            if p_type == PT_LOAD:
+                self.segments.append((p_vaddr, p_filesz, p_offset))
+
+    def unpack(self, fmt, offset):
+        return struct.unpack_from(self.endian + fmt, self.data, offset)
+
+    def read_string(self, address):
+        for vaddr, size, offset in self.segments:
+            if vaddr <= address < (vaddr + size):
+                start = offset + (address - vaddr)
+                end = self.data.index(b'\0', start)
+                return self.data[start:end]
+
+        raise KeyError('No format string at 0x{:x}'.format(address))
+
+
+class Decoder:
+    """ Decoder of the binary log records of a given firmware image """
+
+    def __init__(self, elf):
+        self.elf = elf
+
+        self.sizes = {
+            None: 4,
+            'hh': 4,
+            'h': 4,
+            'l': elf.pointer_size,
+            'll': 8,
+            'j': 8,
+            'z': elf.pointer_size,
+            't': elf.pointer_size,
+        }
+
+    def read(self, fmt, size, record, offset):
+        codes = {1: 'b', 2: 'h', 4: 'i', 8: 'q'}
+        code = codes[size] if fmt == 'signed' else codes[size].upper()
+        if fmt == 'double':
+            code = 'd'
+
+        value, = struct.unpack_from(self.elf.endian + code, record, offset)
+        return value, offset + size
+
+    def read_int(self, record, offset):
+        return self.read('signed', 4, record, offset)
+
+    def format_arg(self, spec, stars, record, offset):
+        flags, width, precision, length, conversion = spec
+        if not conversion:
+            raise ValueError('Missing conversion')
+
+        py_spec = '%' + flags
+        py_spec += '*' if width == '*' else width
+        if precision is not None:
+            py_spec += '.' + ('*' if precision == '*' else precision)
+
+        if conversion in 'diouxXc':
+            signed = conversion in 'dic'
+            size = self.sizes[length]
+            value, offset = self.read(
+                'signed' if signed else 'unsigned', size, record, offset)
+
+            # Apply the truncation of the `hh` and `h` length modifiers
+            bits = {'hh': 8, 'h': 16}.get(length)
+            if bits is not None:
+                value &= (1 << bits) - 1
+                if signed and (value >= (1 << (bits - 1))):
+                    value -= 1 << bits
+
+            py_conversion = 'd' if conversion in 'iu' else conversion
+            text = (py_spec + py_conversion) % tuple(stars + [value])
+        elif conversion == 'p':
+            value, offset = self.read(
+                'unsigned', self.elf.pointer_size, record, offset)
+            text = (py_spec + 's') % tuple(stars + ['0x{:x}'.format(value)])
+        elif conversion in 'aAeEfFgG':
+            value, offset = self.read('double', 8, record, offset)
+            if conversion in 'aA':
+                text = (py_spec + 's') % tuple(stars + [value.hex()])
+            else:
+                text = (py_spec + conversion) % tuple(stars + [value])
+        elif conversion == 's':
+            end = record.index(b'\0', offset)
+            value = record[offset:end].decode('utf-8', 'replace')
+            offset = end + 1
+            text = (py_spec + 's') % tuple(stars + [value])
+        else:
+            raise ValueError('Unsupported conversion %' + conversion)
+
+        return text, offset
+
+    def decode(self, record):
+        timestamp, = struct.unpack_from(self.elf.endian + 'Q', record, 0)
+        offset = 8
+        pointer_code = 'Q' if self.elf.pointer_size == 8 else 'I'
+        address, = struct.unpack_from(
+            self.elf.endian + pointer_code, record, offset)
+        offset += self.elf.pointer_size
+
+        fmt = self.elf.read_string(address)
+        message = ''
+        position = 0
+
+        try:
+            for match in SPEC_REGEX.finditer(fmt):
+                message += fmt[position:match.start()].decode(
+                    'utf-8', 'replace')
+                position = match.end()
+
+                spec = [
+                    group.decode() if group is not None else None
+                    for group in match.groups()
+                ]
+                if spec[4] == '%':
+                    message += '%'
+                    continue
+
+                stars = []
+                for field in (spec[1], spec[2]):
+                    if field == '*':
+                        star, offset = self.read_int(record, offset)
+                        stars.append(star)
+
+                text, offset = self.format_arg(spec, stars, record, offset)
+                message += text
+
+            message += fmt[position:].decode('utf-8', 'replace')
+        except (struct.error, ValueError):
+            message += ' <truncated record>'
+
+        seconds = (timestamp // 1000000000) & 0xFFFFFFFF
+        microseconds = (timestamp % 1000000000) // 1000
+
+        return '[{:5d}.{:06d}] {}\n'.format(seconds, microseconds, message)
+
+
+def decode_stream(decoder, data, output):
+    position = 0
+    while position < len(data):
+        magic = data.find(bytes([RECORD_MAGIC]), position)
+        if magic < 0:
+            magic = len(data)
+
+        output.write(data[position:magic].decode('utf-8', 'replace'))
+        if (magic + 2) > len(data):
+            break
+
+        size = data[magic + 1]
+        record = data[magic + 2:magic + 2 + size]
+        position = magic + 2 + size
+
+        if len(record) < size:
+            output.write('<incomplete record>\n')
+            break
+
+        try:
+            output.write(decoder.decode(record))
+        except KeyError as error:
+            output.write('<{}>\n'.format(error.args[0]))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Decode the binary log output of a firmware.')
+    parser.add_argument('elf', help='ELF image of the firmware')
+    parser.add_argument(
+        'input',
+        nargs='?',
+        help='Captured log output, standard input if omitted')
+    args = parser.parse_args()
+
+    decoder = Decoder(Elf(args.elf))
+
+    if args.input is None:
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.input, 'rb') as file:
+            data = file.read()
+
+    decode_stream(decoder, data, sys.stdout)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())